@@ -5041,6 +5041,14 @@ class VariableState:
                 Reset internal variable state for relevant infer request,
                 to a value specified as default for according node.
         """
+    def trim(self, count: typing.SupportsInt) -> None:
+        """
+                Removes the last elements of the state along its sequence axis,
+                e.g. the last tokens of a KV cache.
+        
+                :param count: The number of elements to remove.
+                :type count: int
+        """
     @property
     def name(self) -> str:
         """
@@ -26,6 +26,17 @@ void regclass_VariableState(py::module m) {
         to a value specified as default for according node.
     )");
 
+    variable_st.def("trim",
+                    &ov::VariableState::trim,
+                    py::arg("count"),
+                    R"(
+        Removes the last elements of the state along its sequence axis,
+        e.g. the last tokens of a KV cache.
+
+        :param count: The number of elements to remove.
+        :type count: int
+    )");
+
     variable_st.def_property_readonly("name",
                                       &ov::VariableState::get_name,
                                       R"(
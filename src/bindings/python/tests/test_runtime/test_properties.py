@@ -258,6 +258,8 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (props.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (props.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (props.cache_deduplication, "CACHE_DEDUPLICATION", ((True, True), (False, False))),
+        (props.cache_size_limit, "CACHE_SIZE_LIMIT", ((0, 0), (1 << 30, 1 << 30))),
         (
             props.weights_path,
             "WEIGHTS_PATH",
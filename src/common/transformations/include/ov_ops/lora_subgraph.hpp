@@ -19,6 +19,9 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): per-row indices of the adapters, in this case the LoRA_matrices are the stacked banks
+ *    of the adapters ([num_adapters, ...]) gathered by the indices in the body, so the rows of the same batch may use
+ *    different adapters.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/node_output.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API SliceBeforeLMHead;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @brief Only the logits of the last token of a sequence are used to generate the next token, however the LM head
+ * MatMul to the vocabulary is computed for all the prompt tokens during the prefill. The transformation selects the
+ * hidden states of the last tokens before the LM head, so the [seq_len x hidden x vocab] MatMul becomes a
+ * [1 x hidden x vocab] one.
+ *
+ * The LM head is a MatMul producing the model output named "logits", possibly through Convert, Tanh and eltwise
+ * operations with scalar constants (e.g. the logits soft-capping).
+ *
+ * Stateful model, hidden states [batch, seq_len, hidden_size]:
+ *      hidden_states -> Slice(start = -1, axis = 1) -> MatMul
+ * PagedAttention model, hidden states [total_tokens, 1, hidden_size], the last token of each sequence is selected by
+ * the subsequence_begins input:
+ *      hidden_states -> Gather(subsequence_begins[1:] - 1, axis = 0) -> MatMul
+ *
+ * The logits shape changes to [batch, 1, vocab_size] and [num_sequences, 1, vocab_size] respectively.
+ *
+ * The pass is meant for the generation loops only: the caller registers it for the stateful (ReadValue/Assign) or
+ * the PagedAttention models, a stateless model may need the logits of all the tokens.
+ */
+class ov::pass::SliceBeforeLMHead : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("SliceBeforeLMHead");
+    SliceBeforeLMHead();
+    explicit SliceBeforeLMHead(const Output<Node>& subsequence_begins);
+};
@@ -11,6 +11,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/convolution.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
@@ -28,17 +29,24 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
     auto transpose_const1_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose1_m = optional<ov::op::v1::Transpose>({lora_input_m, transpose_const1_m}, consumers_count(1));
 
+    // multi-adapter LoRA: the states are the stacked banks of the adapters gathered by the per-row adapter indices
     auto read_value1_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert1_m = optional<ov::op::v0::Convert>(read_value1_m, consumers_count(1));
-    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, convert1_m}, consumers_count(1));
+    auto gather_axis1_m = wrap_type<ov::op::v0::Constant>(value_matches("0"));
+    auto gather1_m = optional<ov::op::v8::Gather>({convert1_m, any_input(), gather_axis1_m}, consumers_count(1));
+    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, gather1_m}, consumers_count(1));
 
     auto read_value2_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert2_m = optional<ov::op::v0::Convert>(read_value2_m, consumers_count(1));
-    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, convert2_m}, consumers_count(1));
+    auto gather_axis2_m = wrap_type<ov::op::v0::Constant>(value_matches("0"));
+    auto gather2_m = optional<ov::op::v8::Gather>({convert2_m, any_input(), gather_axis2_m}, consumers_count(1));
+    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, gather2_m}, consumers_count(1));
 
     auto read_value3_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert3_m = optional<ov::op::v0::Convert>(read_value3_m, consumers_count(1));
-    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, convert3_m}, consumers_count(1));
+    auto gather_axis3_m = wrap_type<ov::op::v0::Constant>(value_matches("0"));
+    auto gather3_m = optional<ov::op::v8::Gather>({convert3_m, any_input(), gather_axis3_m}, consumers_count(1));
+    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, gather3_m}, consumers_count(1));
 
     auto transpose_const2_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose2_m = optional<ov::op::v1::Transpose>({matmul2_m, transpose_const2_m}, consumers_count(1));
@@ -65,6 +73,26 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             return false;
         }
 
+        // the adapters are selected either for all the LoRA matrices by the same indices or for none of them
+        std::vector<std::shared_ptr<ov::op::v8::Gather>> gathers;
+        for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+            if (pattern_map.count(gather_m)) {
+                gathers.push_back(ov::as_type_ptr<ov::op::v8::Gather>(pattern_map.at(gather_m).get_node_shared_ptr()));
+            }
+        }
+        const bool multi_adapter = !gathers.empty();
+        if (multi_adapter) {
+            if (gathers.size() != 3 || pattern_map.count(transpose1_m) || pattern_map.count(transpose2_m)) {
+                return false;
+            }
+            const auto& adapter_indices = gathers.front()->input_value(1);
+            for (const auto& gather : gathers) {
+                if (gather->get_batch_dims() != 0 || gather->input_value(1) != adapter_indices) {
+                    return false;
+                }
+            }
+        }
+
         auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
             for (size_t i = 0; i < child->get_input_size(); ++i) {
                 auto input = child->input(i);
@@ -80,11 +108,11 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             find_connected_input(add.get_node(), main_flow.get_node()),
             pattern_map.count(transpose1_m) ? pattern_map.at(transpose1_m).get_node()->input(0)
                                             : matmul1.get_node()->input(0),
-            matmul1.get_node()->input(1),
-            find_connected_input(multiply.get_node(), state_2.get_node()),
-            matmul2.get_node()->input(1),
+            multi_adapter ? gathers[0]->input(0) : matmul1.get_node()->input(1),
+            multi_adapter ? gathers[1]->input(0) : find_connected_input(multiply.get_node(), state_2.get_node()),
+            multi_adapter ? gathers[2]->input(0) : matmul2.get_node()->input(1),
         };
-        const ov::OutputVector external_connections{
+        ov::OutputVector external_connections{
             main_flow,
             lora_input,
             state_1,
@@ -93,12 +121,23 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
         };
 
         ov::ParameterVector subgraph_parameters;
-        subgraph_parameters.reserve(internal_inputs.size());
+        subgraph_parameters.reserve(internal_inputs.size() + 1);
         for (auto& in : internal_inputs) {
             auto new_parameter = std::make_shared<ov::op::v0::Parameter>(in.get_element_type(), in.get_partial_shape());
             subgraph_parameters.push_back(new_parameter);
             in.replace_source_output(new_parameter);
         }
+        if (multi_adapter) {
+            // the adapter indices are shared by all the Gathers of the body
+            const auto adapter_indices = gathers.front()->input_value(1);
+            auto indices_parameter = std::make_shared<ov::op::v0::Parameter>(adapter_indices.get_element_type(),
+                                                                             adapter_indices.get_partial_shape());
+            subgraph_parameters.push_back(indices_parameter);
+            for (const auto& gather : gathers) {
+                gather->input(1).replace_source_output(indices_parameter);
+            }
+            external_connections.push_back(adapter_indices);
+        }
         // Note: lora consumers should be taken before lora_subgraph creation,
         // because only original consumers should be replaced with lora's output
         const auto& lora_consumers = add.get_target_inputs();
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/sdpa_to_paged_attention/slice_before_lm_head.hpp"
+
+#include <limits>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/tanh.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::op;
+using namespace ov::pass::pattern;
+
+namespace {
+
+constexpr auto logits_name = "logits";
+
+// Convert, Tanh and the eltwise operations with a scalar constant keep the positions of the logits
+bool is_position_wise(const std::shared_ptr<ov::Node>& node) {
+    if (ov::is_type_any_of<v0::Convert, v0::Tanh>(node)) {
+        return true;
+    }
+    if (!ov::is_type_any_of<v1::Add, v1::Subtract, v1::Multiply, v1::Divide>(node)) {
+        return false;
+    }
+    for (const auto& input : node->input_values()) {
+        const auto constant = ov::as_type_ptr<v0::Constant>(input.get_node_shared_ptr());
+        if (constant && ov::shape_size(constant->get_shape()) == 1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the nodes from the MatMul to the "logits" Result, or an empty vector if the MatMul is not the LM head
+ov::NodeVector get_path_to_logits(const std::shared_ptr<ov::Node>& matmul) {
+    ov::NodeVector path{matmul};
+    while (true) {
+        const auto& node = path.back();
+        const auto& consumers = node->get_output_target_inputs(0);
+        if (node->get_output_size() != 1 || consumers.size() != 1) {
+            return {};
+        }
+        auto consumer = consumers.begin()->get_node()->shared_from_this();
+        if (ov::is_type<v0::Result>(consumer)) {
+            return node->output(0).get_names().count(logits_name) ? path : ov::NodeVector{};
+        }
+        if (!is_position_wise(consumer)) {
+            return {};
+        }
+        path.push_back(consumer);
+    }
+}
+
+// Checks whether the hidden states are already gathered by the last tokens of the sequences
+bool is_gathered_by(const ov::Output<ov::Node>& hidden, const ov::Output<ov::Node>& subsequence_begins) {
+    if (!ov::is_type<v8::Gather>(hidden.get_node())) {
+        return false;
+    }
+    const auto last_indices = hidden.get_node()->get_input_node_ptr(1);
+    if (!ov::is_type<v1::Subtract>(last_indices)) {
+        return false;
+    }
+    const auto ends = last_indices->get_input_node_ptr(0);
+    return ov::is_type<v8::Slice>(ends) && ends->input_value(0) == subsequence_begins;
+}
+
+}  // namespace
+
+ov::pass::SliceBeforeLMHead::SliceBeforeLMHead() : SliceBeforeLMHead(Output<Node>()) {}
+
+ov::pass::SliceBeforeLMHead::SliceBeforeLMHead(const Output<Node>& subsequence_begins) {
+    MATCHER_SCOPE(SliceBeforeLMHead);
+
+    auto hidden_states = any_input(rank_equals(3));
+    auto lm_head = wrap_type<v0::MatMul>({hidden_states, any_input()});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul = ov::as_type_ptr<v0::MatMul>(m.get_match_root());
+        if (!matmul || matmul->get_transpose_a() || transformation_callback(matmul)) {
+            return false;
+        }
+        const auto path = get_path_to_logits(matmul);
+        if (path.empty()) {
+            return false;
+        }
+
+        const auto hidden = pattern_map.at(hidden_states);
+        std::shared_ptr<ov::Node> last_tokens;
+        ov::NodeVector new_nodes;
+        if (subsequence_begins.get_node()) {
+            if (is_gathered_by(hidden, subsequence_begins)) {
+                return false;
+            }
+            // the tokens of the sequences are concatenated along the first axis
+            auto one = v0::Constant::create(subsequence_begins.get_element_type(), Shape{1}, {1});
+            auto zero = v0::Constant::create(element::i64, Shape{1}, {0});
+            auto stop = v0::Constant::create(element::i64, Shape{1}, {std::numeric_limits<int64_t>::max()});
+            auto step = v0::Constant::create(element::i64, Shape{1}, {1});
+            auto ends = std::make_shared<v8::Slice>(subsequence_begins, step, stop, step, zero);
+            auto last_indices = std::make_shared<v1::Subtract>(ends, one);
+            auto axis = v0::Constant::create(element::i64, Shape{}, {0});
+            last_tokens = std::make_shared<v8::Gather>(hidden, last_indices, axis);
+            new_nodes = {ends, last_indices, last_tokens};
+        } else {
+            if (hidden.get_partial_shape()[1] == 1) {
+                return false;
+            }
+            auto start = v0::Constant::create(element::i64, Shape{1}, {-1});
+            auto stop = v0::Constant::create(element::i64, Shape{1}, {std::numeric_limits<int64_t>::max()});
+            auto step = v0::Constant::create(element::i64, Shape{1}, {1});
+            auto axis = v0::Constant::create(element::i64, Shape{1}, {1});
+            last_tokens = std::make_shared<v8::Slice>(hidden, start, stop, step, axis);
+            new_nodes = {last_tokens};
+        }
+        last_tokens->set_friendly_name(matmul->get_friendly_name() + "/last_tokens");
+        ov::copy_runtime_info(matmul, new_nodes);
+        matmul->input(0).replace_source_output(last_tokens);
+        for (const auto& node : path) {
+            node->validate_and_infer_types();
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(lm_head, matcher_name);
+    register_matcher(m, callback);
+}
@@ -12,6 +12,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -74,6 +75,15 @@ std::shared_ptr<ov::Node> create_lora_subgraph(const ov::Output<ov::Node>& main_
     return std::make_shared<ov::op::v1::Add>(add_in_0, add_in_1);
 }
 
+ov::OutputVector gather_adapters(const ov::OutputVector& states, const ov::Output<ov::Node>& adapter_indices) {
+    ov::OutputVector gathered;
+    for (const auto& state : states) {
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        gathered.push_back(std::make_shared<ov::op::v8::Gather>(state, adapter_indices, axis));
+    }
+    return gathered;
+}
+
 class LoraSubgraphFusionTests : public TransformationTestsF {
 public:
     LoraSubgraphFusionTests() : TransformationTestsF() {
@@ -225,6 +235,84 @@ TEST_F(LoraSubgraphFusionMatMulTests, ReshaffledEltwiseInputs) {
     }
 }
 
+TEST_F(LoraSubgraphFusionMatMulTests, MultiAdapterPattern) {
+    // the stacked adapter banks: [num_adapters, rank, K], [num_adapters, 1, rank] and [num_adapters, N, rank]
+    const ov::PartialShape shape_bank_1 = {-1, -1, K};
+    const ov::PartialShape shape_bank_2 = {-1, 1, -1};
+    const ov::PartialShape shape_bank_3 = {-1, N, -1};
+    const ov::PartialShape shape_indices = {-1};
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3}, ov::element::f16);
+        auto lora_subgraph =
+            create_lora_subgraph(main_mm, param_lora, gather_adapters(states.first, param_indices), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        states.second,
+                                        ParameterVector{param_lora, param_w, param_indices});
+    }
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto inner_state_1 = std::make_shared<ov::op::v0::Parameter>(netType, shape_bank_1);
+        auto inner_state_2 = std::make_shared<ov::op::v0::Parameter>(netType, shape_bank_2);
+        auto inner_state_3 = std::make_shared<ov::op::v0::Parameter>(netType, shape_bank_3);
+        auto inner_param_mm = std::make_shared<ov::op::v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+
+        ov::OutputVector states_outs{inner_state_1, inner_state_2, inner_state_3};
+        auto gathered_states = gather_adapters(states_outs, inner_param_indices);
+        auto lora_subgraph = create_lora_subgraph(inner_param_mm, inner_param_lora, gathered_states, false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_state_1,
+                                         inner_state_2,
+                                         inner_state_3,
+                                         inner_param_indices};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3}, ov::element::f16);
+        ov::OutputVector lora_inputs{main_mm,
+                                     param_lora,
+                                     states.first[0],
+                                     states.first[1],
+                                     states.first[2],
+                                     param_indices};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            states.second,
+                                            ParameterVector{param_lora, param_w, param_indices});
+    }
+}
+
+TEST_F(LoraSubgraphFusionMatMulTests, MultiAdapterPatternDifferentIndices) {
+    const ov::PartialShape shape_indices = {-1};
+    auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+    auto param_indices_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+    auto param_indices_2 = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+    auto states = create_states({{-1, -1, K}, {-1, 1, -1}, {-1, N, -1}});
+    auto gathered = gather_adapters({states.first[0], states.first[1]}, param_indices_1);
+    gathered.push_back(gather_adapters({states.first[2]}, param_indices_2).front());
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, gathered, false);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    states.second,
+                                    ParameterVector{param_lora, param_w, param_indices_1, param_indices_2});
+}
+
 class LoraSubgraphFusionConvolutionTests : public LoraSubgraphFusionTests {
 public:
     const ov::Dimension num_channels = 320;
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/sdpa_to_paged_attention/slice_before_lm_head.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/tanh.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+std::shared_ptr<Node> make_lm_head(const Output<Node>& hidden_states, bool soft_capping = false) {
+    auto weights = op::v0::Constant::create(element::f32, Shape{32, 16}, {0.1f});
+    std::shared_ptr<Node> logits = std::make_shared<op::v0::MatMul>(hidden_states, weights, false, true);
+    if (soft_capping) {
+        auto cap = op::v0::Constant::create(element::f32, Shape{}, {30.f});
+        auto divide = std::make_shared<op::v1::Divide>(logits, cap);
+        auto tanh = std::make_shared<op::v0::Tanh>(divide);
+        logits = std::make_shared<op::v1::Multiply>(tanh, cap);
+    }
+    logits->output(0).set_names({"logits"});
+    return logits;
+}
+
+std::shared_ptr<Node> make_last_token_slice(const Output<Node>& hidden_states) {
+    auto start = op::v0::Constant::create(element::i64, Shape{1}, {-1});
+    auto stop = op::v0::Constant::create(element::i64, Shape{1}, {std::numeric_limits<int64_t>::max()});
+    auto step = op::v0::Constant::create(element::i64, Shape{1}, {1});
+    auto axis = op::v0::Constant::create(element::i64, Shape{1}, {1});
+    return std::make_shared<op::v8::Slice>(hidden_states, start, stop, step, axis);
+}
+
+}  // namespace
+
+TEST_F(TransformationTestsF, SliceBeforeLMHead) {
+    {
+        auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 16});
+        auto logits = make_lm_head(hidden_states);
+        model = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states});
+        manager.register_pass<pass::SliceBeforeLMHead>();
+    }
+    {
+        auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 16});
+        auto logits = make_lm_head(make_last_token_slice(hidden_states));
+        model_ref = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, SliceBeforeLMHeadSoftCapping) {
+    {
+        auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 16});
+        auto logits = make_lm_head(hidden_states, true);
+        model = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states});
+        manager.register_pass<pass::SliceBeforeLMHead>();
+    }
+    {
+        auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 16});
+        auto logits = make_lm_head(make_last_token_slice(hidden_states), true);
+        model_ref = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, SliceBeforeLMHeadPagedAttention) {
+    {
+        auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 1, 16});
+        auto subsequence_begins = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1});
+        auto logits = make_lm_head(hidden_states);
+        model = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states, subsequence_begins});
+        manager.register_pass<pass::SliceBeforeLMHead>(subsequence_begins);
+    }
+    {
+        auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 1, 16});
+        auto subsequence_begins = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1});
+        auto one = op::v0::Constant::create(element::i64, Shape{1}, {1});
+        auto ends = std::make_shared<op::v8::Slice>(subsequence_begins,
+                                                    one,
+                                                    op::v0::Constant::create(element::i64,
+                                                                             Shape{1},
+                                                                             {std::numeric_limits<int64_t>::max()}),
+                                                    one,
+                                                    op::v0::Constant::create(element::i64, Shape{1}, {0}));
+        auto last_indices =
+            std::make_shared<op::v1::Subtract>(ends, op::v0::Constant::create(element::i32, Shape{1}, {1}));
+        auto last_tokens = std::make_shared<op::v8::Gather>(hidden_states,
+                                                            last_indices,
+                                                            op::v0::Constant::create(element::i64, Shape{}, {0}));
+        auto logits = make_lm_head(last_tokens);
+        model_ref = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states, subsequence_begins});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, SliceBeforeLMHeadNotLogits) {
+    auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 16});
+    auto weights = op::v0::Constant::create(element::f32, Shape{32, 16}, {0.1f});
+    auto matmul = std::make_shared<op::v0::MatMul>(hidden_states, weights, false, true);
+    matmul->output(0).set_names({"hidden_states"});
+    model = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{hidden_states});
+    manager.register_pass<pass::SliceBeforeLMHead>();
+}
+
+TEST_F(TransformationTestsF, SliceBeforeLMHeadSingleToken) {
+    auto hidden_states = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 1, 16});
+    auto logits = make_lm_head(hidden_states);
+    model = std::make_shared<Model>(OutputVector{logits}, ParameterVector{hidden_states});
+    manager.register_pass<pass::SliceBeforeLMHead>();
+}
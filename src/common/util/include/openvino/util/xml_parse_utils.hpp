@@ -249,6 +249,53 @@ inline ParseResult parse_xml(const char* file_path) {
         return {std::move(nullptr), std::string("Error loading XML file: ") + e.what()};
     }
 }
+
+/**
+ * @brief      Checks whether the data starts with the binary XML encoding header
+ * @ingroup    ov_dev_api_xml
+ *
+ * @param[in]  data  The data
+ * @param[in]  size  The data size
+ * @return     true if the data is the binary encoded XML document
+ */
+bool is_binary(const char* data, size_t size);
+
+/**
+ * @brief      Reads the version attribute of the root element from the binary XML encoding header
+ * @ingroup    ov_dev_api_xml
+ *
+ * The version is stored in the fixed size header, so the document itself is not decoded.
+ *
+ * @param[in]  data  The data, at least the header of the binary encoded document
+ * @param[in]  size  The data size
+ * @return     The version, 0 if the data is not binary encoded or the root element has no version attribute
+ */
+uint64_t get_binary_version(const char* data, size_t size);
+
+/**
+ * @brief      Writes the XML document in the compact binary encoding
+ * @ingroup    ov_dev_api_xml
+ *
+ * The encoding consists of the header with the version attribute of the root element, the string table holding the
+ * unique element names, attribute names and values and the flat table of the elements in document order, referencing
+ * the parent element and the strings by indices, so it is written and read without any text formatting, escaping and
+ * parsing. The numbers are little endian regardless of the host byte order.
+ *
+ * @param[in]  doc     The XML document, only elements, their attributes and text are encoded
+ * @param      stream  The output stream
+ */
+void save_binary(const pugi::xml_document& doc, std::ostream& stream);
+
+/**
+ * @brief      Reads the XML document written by save_binary
+ * @ingroup    ov_dev_api_xml
+ *
+ * @param      doc   The XML document to fill
+ * @param[in]  data  The binary encoded document
+ * @param[in]  size  The data size
+ * @throws     std::runtime_error if the data is not a valid binary encoded document
+ */
+void load_binary(pugi::xml_document& doc, const char* data, size_t size);
 }  // namespace pugixml
 }  // namespace util
 }  // namespace ov
@@ -6,9 +6,80 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <limits>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// Binary encoding layout, the numbers are little endian, 32-bit except the 64-bit root element version:
+//   magic, format version, root element version,
+//   strings number, {length, characters, '\0'}...,
+//   elements number, {name, parent element, text, attributes number, {name, value}...}...
+// The elements are stored in document order, so the parent element always precedes its children.
+constexpr char binary_magic[8] = {'O', 'V', 'B', 'T', 'O', 'P', 'O', '\0'};
+constexpr uint32_t binary_format_version = 1;
+constexpr size_t binary_version_offset = sizeof(binary_magic) + sizeof(uint32_t);
+constexpr size_t binary_header_size = binary_version_offset + sizeof(uint64_t);
+constexpr uint32_t binary_npos = std::numeric_limits<uint32_t>::max();
+
+template <typename T>
+void put_le(std::string& buffer, T value) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+template <typename T>
+T get_le(const char* data) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<uint8_t>(data[i])) << (8 * i);
+    }
+    return value;
+}
+
+class BinaryReader {
+public:
+    BinaryReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    uint32_t read() {
+        check(sizeof(uint32_t));
+        const auto value = get_le<uint32_t>(m_data + m_pos);
+        m_pos += sizeof(uint32_t);
+        return value;
+    }
+
+    const char* read_string() {
+        const auto length = static_cast<size_t>(read());
+        check(length + 1);
+        const char* str = m_data + m_pos;
+        if (str[length] != '\0') {
+            throw std::runtime_error("Corrupted binary XML document: unterminated string");
+        }
+        m_pos += length + 1;
+        return str;
+    }
+
+    void skip(size_t size) {
+        check(size);
+        m_pos += size;
+    }
+
+private:
+    void check(size_t size) const {
+        if (size > m_size - m_pos) {
+            throw std::runtime_error("Corrupted binary XML document: unexpected end of data");
+        }
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+}  // namespace
 
 namespace ov {
 namespace util {
@@ -232,5 +303,122 @@ int pugixml::get_int_child(const pugi::xml_node& node, const char* str, int defV
     return atoi(child.child_value());
 }
 
+bool pugixml::is_binary(const char* data, size_t size) {
+    return size >= sizeof(binary_magic) && std::memcmp(data, binary_magic, sizeof(binary_magic)) == 0;
+}
+
+uint64_t pugixml::get_binary_version(const char* data, size_t size) {
+    if (!is_binary(data, size) || size < binary_header_size) {
+        return 0;
+    }
+    return get_le<uint64_t>(data + binary_version_offset);
+}
+
+void pugixml::save_binary(const pugi::xml_document& doc, std::ostream& stream) {
+    std::vector<const char*> strings;
+    std::unordered_map<std::string, uint32_t> string_ids;
+    const auto string_id = [&](const char* str) {
+        const auto inserted = string_ids.emplace(str, static_cast<uint32_t>(strings.size()));
+        if (inserted.second) {
+            strings.push_back(inserted.first->first.c_str());
+        }
+        return inserted.first->second;
+    };
+
+    std::string elements;
+    const auto put = [](std::string& buffer, uint32_t value) {
+        put_le(buffer, value);
+    };
+
+    // depth-first traversal in document order
+    uint32_t elements_num = 0;
+    std::vector<std::pair<pugi::xml_node, uint32_t>> stack;
+    for (auto node = doc.last_child(); node; node = node.previous_sibling()) {
+        stack.emplace_back(node, binary_npos);
+    }
+    while (!stack.empty()) {
+        const auto [node, parent] = stack.back();
+        stack.pop_back();
+        if (node.type() != pugi::node_element) {
+            continue;
+        }
+        uint32_t text = binary_npos;
+        for (const auto& child : node.children()) {
+            if (child.type() == pugi::node_pcdata || child.type() == pugi::node_cdata) {
+                text = string_id(child.value());
+                break;
+            }
+        }
+        put(elements, string_id(node.name()));
+        put(elements, parent);
+        put(elements, text);
+        put(elements, static_cast<uint32_t>(std::distance(node.attributes_begin(), node.attributes_end())));
+        for (const auto& attribute : node.attributes()) {
+            put(elements, string_id(attribute.name()));
+            put(elements, string_id(attribute.value()));
+        }
+        for (auto child = node.last_child(); child; child = child.previous_sibling()) {
+            stack.emplace_back(child, elements_num);
+        }
+        ++elements_num;
+    }
+
+    std::string header(binary_magic, sizeof(binary_magic));
+    put(header, binary_format_version);
+    put_le(header, get_uint64_attr(doc.document_element(), "version", 0));
+    put(header, static_cast<uint32_t>(strings.size()));
+    for (const auto& str : strings) {
+        const auto length = std::strlen(str);
+        put(header, static_cast<uint32_t>(length));
+        header.append(str, length + 1);
+    }
+    put(header, elements_num);
+    stream.write(header.data(), header.size());
+    stream.write(elements.data(), elements.size());
+}
+
+void pugixml::load_binary(pugi::xml_document& doc, const char* data, size_t size) {
+    if (!is_binary(data, size)) {
+        throw std::runtime_error("Binary XML document header is not found");
+    }
+    BinaryReader reader(data, size);
+    reader.skip(sizeof(binary_magic));
+    const auto version = reader.read();
+    if (version != binary_format_version) {
+        throw std::runtime_error("Unsupported binary XML document version: " + std::to_string(version));
+    }
+    reader.skip(sizeof(uint64_t));  // the root element version, it is read by get_binary_version
+
+    std::vector<const char*> strings(reader.read());
+    for (auto& str : strings) {
+        str = reader.read_string();
+    }
+    const auto get_string = [&strings](uint32_t id) {
+        if (id >= strings.size()) {
+            throw std::runtime_error("Corrupted binary XML document: wrong string index");
+        }
+        return strings[id];
+    };
+
+    std::vector<pugi::xml_node> elements(reader.read());
+    for (size_t i = 0; i < elements.size(); ++i) {
+        const auto name = get_string(reader.read());
+        const auto parent = reader.read();
+        const auto text = reader.read();
+        if (parent != binary_npos && parent >= i) {
+            throw std::runtime_error("Corrupted binary XML document: wrong parent element index");
+        }
+        auto& element = elements[i];
+        element = (parent == binary_npos ? static_cast<pugi::xml_node>(doc) : elements[parent]).append_child(name);
+        for (auto attributes_num = reader.read(); attributes_num > 0; --attributes_num) {
+            const auto attribute_name = get_string(reader.read());
+            element.append_attribute(attribute_name).set_value(get_string(reader.read()));
+        }
+        if (text != binary_npos) {
+            element.append_child(pugi::node_pcdata).set_value(get_string(text));
+        }
+    }
+}
+
 }  // namespace util
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
@@ -30,20 +30,33 @@ public:
         IR_V10 = 10,      // v10 IR
         IR_V11 = 11       // v11 IR
     };
+
+    enum class Format : uint8_t {
+        XML = 0,    // XML text topology
+        BINARY = 1  // Compact binary encoding of the topology, the weights are stored in the same way
+    };
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
     Serialize(std::ostream& xmlFile, std::ostream& binFile, Version version = Version::UNSPECIFIED);
 
+    Serialize(std::ostream& xmlFile, std::ostream& binFile, Version version, Format format);
+
     Serialize(const std::filesystem::path& xmlPath,
               const std::filesystem::path& binPath,
               Version version = Version::UNSPECIFIED);
 
+    Serialize(const std::filesystem::path& xmlPath,
+              const std::filesystem::path& binPath,
+              Version version,
+              Format format);
+
 private:
     std::ostream* m_xmlFile;
     std::ostream* m_binFile;
     const std::filesystem::path m_xmlPath;
     const std::filesystem::path m_binPath;
     const Version m_version;
+    const Format m_format = Format::XML;
     const std::map<std::string, ov::OpSet> m_custom_opsets;
 };
 
@@ -6,8 +6,13 @@
 
 #include <array>
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <thread>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +44,7 @@
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/xml_parse_utils.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/disable_fp16_compression.hpp"
@@ -95,12 +101,105 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
+// Writes the data to the output stream in a background thread preserving the order of the writes.
+class OrderedStreamWriter {
+public:
+    explicit OrderedStreamWriter(std::ostream& stream) : m_stream(stream), m_thread([this] {
+        run();
+    }) {}
+
+    ~OrderedStreamWriter() {
+        finish();
+    }
+
+    /**
+     * @brief Queues the write of the data
+     * @param ptr The data, must be valid until the write is finished unless it is owned by the buffer
+     * @param size The data size
+     * @param buffer The buffer owning the data, if any
+     */
+    void write(const char* ptr, size_t size, std::unique_ptr<char[]> buffer) {
+        const size_t owned_size = buffer ? size : 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // limit the memory held by the copies waiting for the write, the slow disk throttles the producer
+        m_cv.wait(lock, [&] {
+            return m_owned_size == 0 || m_owned_size + owned_size <= max_owned_size;
+        });
+        m_owned_size += owned_size;
+        m_queue.push_back({ptr, size, std::move(buffer)});
+        m_cv.notify_all();
+    }
+
+    /**
+     * @brief Waits for all the queued writes and stops the thread
+     */
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished = true;
+        }
+        m_cv.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+private:
+    struct Job {
+        const char* ptr;
+        size_t size;
+        std::unique_ptr<char[]> buffer;
+    };
+
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_cv.wait(lock, [&] {
+                return !m_queue.empty() || m_finished;
+            });
+            if (m_queue.empty()) {
+                return;
+            }
+            auto job = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+            m_stream.write(job.ptr, job.size);
+            lock.lock();
+            if (job.buffer) {
+                m_owned_size -= job.size;
+                m_cv.notify_all();
+            }
+        }
+    }
+
+    static constexpr size_t max_owned_size = 256 * 1024 * 1024;
+
+    std::ostream& m_stream;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Job> m_queue;
+    size_t m_owned_size = 0;
+    bool m_finished = false;
+    std::thread m_thread;
+};
+
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
 
+    // The data written to the stream, the candidates of the same hash are compared with it byte by byte
+    struct WrittenData {
+        FilePosition offset;
+        const char* ptr;                    // the source data, i.e. the data before the compression to fp16
+        size_t size;                        // the size of the source data
+        size_t written_size;                // the size of the data in the stream
+        ov::element::Type compressed_from;  // ov::element::dynamic when the data is written as is
+        std::unique_ptr<char[]> copy;       // the source data copy when the source is temporary
+    };
+    using DataWritePositions = std::unordered_multimap<HashValue, WrittenData>;
+
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
@@ -113,22 +212,24 @@ public:
                        size_t& new_size,
                        bool compress_to_fp16 = false,
                        ov::element::Type src_type = ov::element::dynamic,
-                       bool ptr_is_temporary = false) {  // when true, do not rely on ptr after this function call, data
-                                                         // is temporary allocated
-        const FilePosition write_pos = m_binary_output.tellp();
+                       bool ptr_is_temporary = false,  // when true, do not rely on ptr after this function call, data
+                                                       // is temporary allocated
+                       bool deduplicate = true) {  // false for the parts of the data which must be stored contiguously
+        const FilePosition write_pos = m_writer ? m_writer_position : static_cast<FilePosition>(m_binary_output.tellp());
         const auto offset = write_pos - m_blob_offset;
         new_size = size;
 
-        if (!m_enable_compression) {
+        if (!m_enable_compression || !deduplicate) {
             if (!compress_to_fp16) {
-                m_binary_output.write(ptr, size);
+                write_data(ptr, size, nullptr, ptr_is_temporary);
             } else {
                 OPENVINO_ASSERT(size % src_type.size() == 0);
                 auto fp16_buffer = compress_data_to_fp16(ptr, size, src_type, new_size);
-                m_binary_output.write(fp16_buffer.get(), new_size);
+                const auto fp16_ptr = fp16_buffer.get();
+                write_data(fp16_ptr, new_size, std::move(fp16_buffer), true);
             }
             return offset;
-        } else {
+        } else if (m_write_hash_value) {
             std::unique_ptr<char[]> fp16_buffer = nullptr;
             if (compress_to_fp16) {
                 OPENVINO_ASSERT(size % src_type.size() == 0);
@@ -159,27 +260,109 @@ public:
                 // ostream, we store pointer to the original uncompressed blob.
                 m_hash_to_file_positions.insert({hash, {offset, static_cast<const void*>(ptr)}});
             }
-            if (m_write_hash_value) {
-                m_binary_output.write(reinterpret_cast<const char*>(&hash), sizeof(uint64_t));
+            m_binary_output.write(reinterpret_cast<const char*>(&hash), sizeof(uint64_t));
+        } else {
+            // The source data is hashed and compared, so the data compressed to fp16 is deduplicated before the
+            // compression. The equal hashes are not trusted, the candidates are compared byte by byte.
+            const auto compressed_from = compress_to_fp16 ? src_type : ov::element::dynamic;
+            const HashValue hash = ov::runtime::compute_hash(ptr, size);
+
+            auto found = m_data_to_file_positions.equal_range(hash);
+            for (auto it = found.first; it != found.second; ++it) {
+                const auto& written = it->second;
+                if (written.size == size && written.compressed_from == compressed_from &&
+                    std::memcmp(ptr, written.ptr, size) == 0) {
+                    new_size = written.written_size;
+                    return written.offset;
+                }
+            }
+
+            std::unique_ptr<char[]> fp16_buffer = nullptr;
+            if (compress_to_fp16) {
+                OPENVINO_ASSERT(size % src_type.size() == 0);
+                fp16_buffer = compress_data_to_fp16(ptr, size, src_type, new_size);
+            }
+
+            // The temporary source data is kept as a copy to be compared with the next candidates, the copies are
+            // limited by max_copied_size, the data above the limit is written but it is not reused.
+            std::unique_ptr<char[]> copy = nullptr;
+            if (ptr_is_temporary && m_copied_size + size <= max_copied_size) {
+                copy.reset(new char[size]);
+                std::memcpy(copy.get(), ptr, size);
+                m_copied_size += size;
+            }
+            if (!ptr_is_temporary || copy) {
+                const char* source = copy ? copy.get() : ptr;
+                WrittenData written{offset, source, size, new_size, compressed_from, std::move(copy)};
+                m_data_to_file_positions.emplace(hash, std::move(written));
+            }
+
+            if (fp16_buffer) {
+                const auto fp16_ptr = fp16_buffer.get();
+                write_data(fp16_ptr, new_size, std::move(fp16_buffer), true);
             } else {
-                m_binary_output.write(ptr_to_write, new_size);
+                write_data(ptr, size, nullptr, ptr_is_temporary);
             }
         }
         return offset;
     }
 
+    /**
+     * @brief Waits for the data written in background, the output stream may be used directly after that
+     */
+    void finish() {
+        if (m_writer) {
+            m_writer->finish();
+            m_writer.reset();
+            // the background writes can not report the failures, e.g. of the full disk, the stream keeps them
+            OPENVINO_ASSERT(m_binary_output.good(), "Failed to write the constants to the weights stream");
+        }
+    }
+
 private:
+    // The large constants are written in background, so the disk writes overlap with hashing, comparison and
+    // compression of the next constants. The small ones are written directly until the first large one appears.
+    // The hash stream is written synchronously, since the hashes of the deduplicated constants go to it directly.
+    static constexpr size_t async_write_threshold = 1024 * 1024;
+    // The limit of the temporary data copies kept for the deduplication
+    static constexpr size_t max_copied_size = 256 * 1024 * 1024;
+
+    void write_data(const char* ptr, size_t size, std::unique_ptr<char[]> buffer, bool ptr_is_temporary) {
+        if (!m_writer && !m_write_hash_value && size >= async_write_threshold) {
+            m_writer_position = m_binary_output.tellp();
+            m_writer = std::make_unique<OrderedStreamWriter>(m_binary_output);
+        }
+        if (!m_writer) {
+            m_binary_output.write(ptr, size);
+            return;
+        }
+        if (!buffer && ptr_is_temporary) {
+            buffer.reset(new char[size]);
+            std::memcpy(buffer.get(), ptr, size);
+            ptr = buffer.get();
+        }
+        m_writer->write(ptr, size, std::move(buffer));
+        m_writer_position += static_cast<FilePosition>(size);
+    }
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          ov::element::Type src_type,
                                                          size_t& compressed_size) {
         auto num_src_elements = size / src_type.size();
         compressed_size = num_src_elements * ov::element::f16.size();
+        // the large constants are converted by blocks in parallel
+        constexpr size_t block_size = 64 * 1024;
+        const size_t blocks_num = (num_src_elements + block_size - 1) / block_size;
         if (src_type == ov::element::f32) {
             auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
             auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
             auto src_data = reinterpret_cast<const float*>(ptr);
-            ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
+            ov::parallel_for(blocks_num, [&](size_t block) {
+                const size_t begin = block * block_size;
+                const size_t count = std::min(block_size, num_src_elements - begin);
+                ov::reference::convert_from_f32_to_f16_with_clamp(src_data + begin, dst_data + begin, count);
+            });
             return new_ptr;
         } else if (src_type == ov::element::f64) {
             auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
@@ -187,18 +370,21 @@ private:
             auto src_data = reinterpret_cast<const double*>(ptr);
 
             // Reference implementation for fp64 to fp16 conversoin
-            for (size_t i = 0; i < num_src_elements; ++i) {
-                // if abs value is smaller than the smallest positive fp16, but not zero
-                if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
-                    dst_data[i] = 0;
-                } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
-                    dst_data[i] = std::numeric_limits<ov::float16>::max();
-                } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
-                    dst_data[i] = std::numeric_limits<ov::float16>::lowest();
-                } else {
-                    dst_data[i] = static_cast<ov::float16>(src_data[i]);
+            ov::parallel_for(blocks_num, [&](size_t block) {
+                const size_t end = std::min((block + 1) * block_size, num_src_elements);
+                for (size_t i = block * block_size; i < end; ++i) {
+                    // if abs value is smaller than the smallest positive fp16, but not zero
+                    if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
+                        dst_data[i] = 0;
+                    } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
+                        dst_data[i] = std::numeric_limits<ov::float16>::max();
+                    } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
+                        dst_data[i] = std::numeric_limits<ov::float16>::lowest();
+                    } else {
+                        dst_data[i] = static_cast<ov::float16>(src_data[i]);
+                    }
                 }
-            }
+            });
             return new_ptr;
         } else {
             OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
@@ -206,10 +392,14 @@ private:
     }
 
     ConstWritePositions m_hash_to_file_positions;
+    DataWritePositions m_data_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
     bool m_write_hash_value = false;
     FilePosition m_blob_offset;  // blob offset inside output stream
+    std::unique_ptr<OrderedStreamWriter> m_writer;
+    FilePosition m_writer_position = 0;  // output stream position after the queued writes
+    size_t m_copied_size = 0;            // the size of the temporary data copies in m_data_to_file_positions
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -559,7 +749,8 @@ public:
                     inter_size,
                     m_compress_to_fp16,
                     m_output_element_type,
-                    true);  // header_ptr is allocated in AttributeAdapter that has limited life time
+                    true,    // header_ptr is allocated in AttributeAdapter that has limited life time
+                    false);  // the header and the strings must be stored contiguously
                 new_size += inter_size;
 
                 // write raw strings part
@@ -583,7 +774,8 @@ public:
                                                    inter_size,
                                                    m_compress_to_fp16,
                                                    m_output_element_type,
-                                                   m_data_is_temporary);
+                                                   m_data_is_temporary,
+                                                   false);
 
                     new_size += inter_size;
                 }
@@ -1246,7 +1438,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::ostream& bin_file,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   ov::pass::Serialize::Format format = ov::pass::Serialize::Format::XML) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -1270,8 +1463,13 @@ void serializeFunc(std::ostream& xml_file,
     ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
+    constant_write_handler.finish();
 
-    xml_doc.save(xml_file);
+    if (format == ov::pass::Serialize::Format::BINARY) {
+        ov::util::pugixml::save_binary(xml_doc, xml_file);
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1292,7 +1490,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
             disable_fp16_compression(node);
 
     if (m_xmlFile && m_binFile) {
-        serializeFunc(*m_xmlFile, *m_binFile, model, m_version);
+        serializeFunc(*m_xmlFile, *m_binFile, model, m_version, false, m_format);
     } else {
         ov::util::create_directory_recursive(m_xmlPath);
 
@@ -1300,11 +1498,11 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", m_binPath, "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath);
+        std::ofstream xml_file(m_xmlPath, m_format == Format::BINARY ? std::ios::binary : std::ios::out);
         OPENVINO_ASSERT(xml_file, "Can't open xml file: \"", m_xmlPath, "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, model, m_version);
+            serializeFunc(xml_file, bin_file, model, m_version, false, m_format);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1335,6 +1533,25 @@ pass::Serialize::Serialize(const std::filesystem::path& xmlPath, const std::file
       m_binPath{provide_bin_path(xmlPath, binPath)},
       m_version{version} {}
 
+pass::Serialize::Serialize(std::ostream& xmlFile, std::ostream& binFile, Version version, Format format)
+    : m_xmlFile{&xmlFile},
+      m_binFile{&binFile},
+      m_xmlPath{},
+      m_binPath{},
+      m_version{version},
+      m_format{format} {}
+
+pass::Serialize::Serialize(const std::filesystem::path& xmlPath,
+                           const std::filesystem::path& binPath,
+                           Version version,
+                           Format format)
+    : m_xmlFile{nullptr},
+      m_binFile{nullptr},
+      m_xmlPath{valid_xml_path(xmlPath)},
+      m_binPath{provide_bin_path(xmlPath, binPath)},
+      m_version{version},
+      m_format{format} {}
+
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        const std::function<void(std::ostream&)>& custom_data_serializer,
                                        const std::function<std::string(const std::string&)>& cache_encrypt,
@@ -1400,6 +1617,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     XmlSerializer visitor(net_node, name, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor.on_attribute(name, fun);
+    constant_write_handler.finish();
 
     // IR
     hdr.model_offset = static_cast<size_t>(m_stream.tellp()) - header_offset;
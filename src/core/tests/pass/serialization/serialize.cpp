@@ -6,8 +6,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iterator>
+#include <numeric>
+#include <sstream>
+#include <streambuf>
 
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
@@ -93,6 +97,122 @@ TEST_P(SerializePassTestP, serialize_simple_model_with_constant) {
     const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
     EXPECT_TRUE(is_valid) << error_msg;
 }
+
+TEST_F(SerializePassTest, serialize_model_with_large_constants) {
+    // the large constants are written in background, check their order and deduplication
+    const auto p1 = std::make_shared<Parameter>(element::f32, PartialShape{4 * 1024 * 1024});
+    std::vector<float> values(4 * 1024 * 1024);
+    std::iota(values.begin(), values.end(), 0.0f);
+    const auto c1 = std::make_shared<Constant>(element::f32, Shape{values.size()}, values);
+    std::reverse(values.begin(), values.end());
+    const auto c2 = std::make_shared<Constant>(element::f32, Shape{values.size()}, values);
+    const auto c3 = std::make_shared<Constant>(element::f32, Shape{values.size()}, values);
+    const auto add1 = std::make_shared<Add>(p1, c1);
+    const auto add2 = std::make_shared<Add>(add1, c2);
+    const auto add3 = std::make_shared<Add>(add2, c3);
+    m_model = std::make_shared<Model>(OutputVector{add3}, ParameterVector{p1}, "large_constants");
+
+    OV_ASSERT_NO_THROW(pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(m_model));
+
+    EXPECT_EQ(std::filesystem::file_size(m_out_bin_path), 2 * values.size() * sizeof(float));
+    const auto serialized_model = test::readModel(m_out_xml_path.string(), m_out_bin_path.string());
+    const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
+    EXPECT_TRUE(is_valid) << error_msg;
+}
+
+TEST_F(SerializePassTest, serialize_compressed_model_deduplicates_constants) {
+    // the equal constants compressed to fp16 on the fly are deduplicated before the compression
+    const auto p1 = std::make_shared<Parameter>(element::f32, PartialShape{1024});
+    std::vector<float> values(1024);
+    std::iota(values.begin(), values.end(), 0.0f);
+    const auto c1 = std::make_shared<Constant>(element::f32, Shape{values.size()}, values);
+    const auto c2 = std::make_shared<Constant>(element::f32, Shape{values.size()}, values);
+    const auto add1 = std::make_shared<Add>(p1, c1);
+    const auto add2 = std::make_shared<Add>(add1, c2);
+    m_model = std::make_shared<Model>(OutputVector{add2}, ParameterVector{p1}, "tied_constants");
+
+    OV_ASSERT_NO_THROW(ov::save_model(m_model, m_out_xml_path, true));
+
+    EXPECT_EQ(std::filesystem::file_size(m_out_bin_path), values.size() * element::f16.size());
+}
+
+TEST_F(SerializePassTest, serialize_model_does_not_deduplicate_constants_by_hash_only) {
+    // compute_hash gives the same hash for these arrays, the data must be compared before the deduplication
+    const auto p1 = std::make_shared<Parameter>(element::u8, PartialShape{2});
+    const auto c1 = std::make_shared<Constant>(element::u8, Shape{2}, std::vector<uint8_t>{2, 2});
+    const auto c2 = std::make_shared<Constant>(element::u8, Shape{2}, std::vector<uint8_t>{0, 128});
+    const auto add1 = std::make_shared<Add>(p1, c1);
+    const auto add2 = std::make_shared<Add>(add1, c2);
+    m_model = std::make_shared<Model>(OutputVector{add2}, ParameterVector{p1}, "colliding_constants");
+
+    OV_ASSERT_NO_THROW(ov::save_model(m_model, m_out_xml_path, false));
+
+    EXPECT_EQ(std::filesystem::file_size(m_out_bin_path), 4u);
+    const auto serialized_model = test::readModel(m_out_xml_path.string(), m_out_bin_path.string());
+    const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
+    EXPECT_TRUE(is_valid) << error_msg;
+}
+
+TEST_F(SerializePassTest, serialize_binary_topology_header) {
+    const auto p1 = std::make_shared<Parameter>(element::f32, PartialShape{2});
+    const auto c1 = std::make_shared<Constant>(element::f32, Shape{2}, std::vector<float>{1.0f, 2.0f});
+    const auto add = std::make_shared<Add>(p1, c1);
+    m_model = std::make_shared<Model>(OutputVector{add}, ParameterVector{p1}, "binary_topology");
+
+    ov::pass::Serialize(m_out_xml_path,
+                        m_out_bin_path,
+                        ov::pass::Serialize::Version::IR_V11,
+                        ov::pass::Serialize::Format::BINARY)
+        .run_on_model(m_model);
+
+    // magic, 32-bit format version and 64-bit IR version, little endian regardless of the host byte order
+    std::ifstream xml_file(m_out_xml_path, std::ios::binary);
+    std::vector<char> header(20);
+    xml_file.read(header.data(), header.size());
+    ASSERT_EQ(xml_file.gcount(), static_cast<std::streamsize>(header.size()));
+    const std::vector<char> expected{'O', 'V', 'B', 'T', 'O', 'P', 'O', '\0', 1, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_EQ(header, expected);
+
+    const auto serialized_model = test::readModel(m_out_xml_path.string(), m_out_bin_path.string());
+    const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
+    EXPECT_TRUE(is_valid) << error_msg;
+}
+
+TEST_F(SerializePassTest, serialize_throws_on_failed_weights_write) {
+    // the weights stream of the limited capacity, e.g. of the full disk
+    class LimitedStreamBuf : public std::streambuf {
+    public:
+        explicit LimitedStreamBuf(std::streamsize capacity) : m_capacity(capacity) {}
+
+    protected:
+        std::streamsize xsputn(const char*, std::streamsize count) override {
+            const auto written = std::min(count, m_capacity - m_size);
+            m_size += written;
+            return written;
+        }
+        int_type overflow(int_type ch) override {
+            return xsputn(nullptr, 1) == 1 ? traits_type::not_eof(ch) : traits_type::eof();
+        }
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override {
+            return off == 0 && dir == std::ios_base::cur ? pos_type(m_size) : pos_type(off_type(-1));
+        }
+
+    private:
+        std::streamsize m_capacity;
+        std::streamsize m_size = 0;
+    };
+
+    // the constant is large enough to be written in background
+    const auto p1 = std::make_shared<Parameter>(element::f32, PartialShape{1024 * 1024});
+    const auto c1 = std::make_shared<Constant>(element::f32, Shape{1024 * 1024}, std::vector<float>(1024 * 1024, 1.0f));
+    const auto add = std::make_shared<Add>(p1, c1);
+    m_model = std::make_shared<Model>(OutputVector{add}, ParameterVector{p1}, "large_constant");
+
+    std::stringstream xml_stream;
+    LimitedStreamBuf bin_buf(1024);
+    std::ostream bin_stream(&bin_buf);
+    EXPECT_THROW(pass::Serialize(xml_stream, bin_stream).run_on_model(m_model), ov::Exception);
+}
 }  // namespace ov::test
 
 using SerializationParams = std::tuple<std::string, std::string>;
@@ -163,6 +283,16 @@ TEST_P(SerializationTest, CompareFunctionsByPath) {
     });
 }
 
+TEST_P(SerializationTest, CompareFunctionsBinaryTopology) {
+    CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
+        ov::pass::Serialize(m_out_xml_path,
+                            m_out_bin_path,
+                            ov::pass::Serialize::Version::UNSPECIFIED,
+                            ov::pass::Serialize::Format::BINARY)
+            .run_on_model(m);
+    });
+}
+
 TEST_P(SerializationTest, SaveModelByPath) {
     const auto out_xml_path = std::filesystem::path(m_out_xml_path);
     CompareSerialized([&out_xml_path](const auto& m) {
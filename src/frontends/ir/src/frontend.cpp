@@ -45,6 +45,11 @@ constexpr size_t HEADER_SIZE_LIM = 512lu;
  * @return IR version, 0 if model does represent IR
  */
 size_t get_ir_version(const char* model, size_t model_size) {
+    if (ov::util::pugixml::is_binary(model, model_size)) {
+        // The binary topology keeps the version in its header
+        return static_cast<size_t>(ov::util::pugixml::get_binary_version(model, model_size));
+    }
+
     // IR version is a value of root tag attribuite thought not need to parse the whole stream.
 
     size_t header_size = model_size > HEADER_SIZE_LIM ? HEADER_SIZE_LIM : model_size;
@@ -75,9 +80,14 @@ size_t get_ir_version(std::istream& model) {
 
     model.seekg(0, model.beg);
     model.read(header, HEADER_SIZE_LIM);
+    const auto header_size = static_cast<size_t>(model.gcount());
     model.clear();
     model.seekg(0, model.beg);
 
+    if (ov::util::pugixml::is_binary(header, header_size)) {
+        return get_ir_version(header, header_size);
+    }
+
     auto ir_version = get_ir_version(header, HEADER_SIZE_LIM);
     if (ir_version == 0lu) {
         pugi::xml_document doc;
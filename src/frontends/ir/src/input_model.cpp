@@ -5,6 +5,7 @@
 #include "input_model.hpp"
 
 #include <pugixml.hpp>
+#include <vector>
 
 #include "ir_deserializer.hpp"
 #include "openvino/core/except.hpp"
@@ -215,8 +216,24 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        pugi::xml_parse_result res = m_xml_doc.load(model);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        char magic[8] = {};
+        model.read(magic, sizeof(magic));
+        const auto magic_size = static_cast<size_t>(model.gcount());
+        model.clear();
+        model.seekg(0, model.beg);
+        if (ov::util::pugixml::is_binary(magic, magic_size)) {
+            // the binary topology is decoded from memory, so the stream is read at once
+            model.seekg(0, model.end);
+            std::vector<char> data(static_cast<size_t>(model.tellg()));
+            model.seekg(0, model.beg);
+            model.read(data.data(), static_cast<std::streamsize>(data.size()));
+            OPENVINO_ASSERT(model.gcount() == static_cast<std::streamsize>(data.size()),
+                            "Failed to read the binary topology");
+            load_binary_topology(data.data(), data.size());
+        } else {
+            pugi::xml_parse_result res = m_xml_doc.load(model);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        }
         init_opset();
     }
 
@@ -227,14 +244,27 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        if (ov::util::pugixml::is_binary(model->get_ptr<char>(), model->size())) {
+            load_binary_topology(model->get_ptr<char>(), model->size());
+        } else {
+            auto res =
+                m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        }
         init_opset();
     }
 
     std::shared_ptr<ov::Model> convert();
 
 private:
+    void load_binary_topology(const char* data, size_t size) {
+        try {
+            ov::util::pugixml::load_binary(m_xml_doc, data, size);
+        } catch (const std::runtime_error& e) {
+            OPENVINO_THROW(e.what());
+        }
+    }
+
     void init_opset() {
         m_root = m_xml_doc.document_element();
         for (const auto& it : ov::get_available_opsets()) {
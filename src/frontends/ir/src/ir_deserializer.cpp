@@ -12,6 +12,7 @@
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -506,9 +507,25 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
     // Read all layers and store their parameters in params map
+    // The layers are independent at this stage, so their parameters are parsed in parallel
+    std::vector<NodeParams> layers;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
+        layers.push_back({node, {}});
+    }
+    std::vector<std::exception_ptr> layer_errors(layers.size());
+    ov::parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers[i].params = parse_generic_params(layers[i].xml);
+        } catch (...) {
+            layer_errors[i] = std::current_exception();
+        }
+    });
+    for (size_t i = 0; i < layers.size(); ++i) {
+        if (layer_errors[i]) {
+            std::rethrow_exception(layer_errors[i]);
+        }
+        const auto& node_param = layers[i].params;
+        params[node_param.layerId] = std::move(layers[i]);
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -558,6 +575,32 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    // Constants do not depend on other nodes and make up the most of the large models, so they are created in
+    // parallel beforehand. The other nodes are created sequentially in the topological order, as the creation connects
+    // them to the producers and their shape inference may evaluate the bounds on the shared upstream tensors.
+    struct CreatedNode {
+        std::shared_ptr<ov::Node> node;
+        std::exception_ptr error;
+    };
+    std::unordered_map<size_t /*layer-id*/, CreatedNode> created_constants;
+    std::vector<std::pair<const NodeParams*, CreatedNode*>> constants;
+    for (const auto& layer_id : order) {
+        const auto& p = params[layer_id];
+        if (p.params.type != "Const" || !edges[layer_id].empty() || !m_opsets.count(p.params.version) ||
+            m_extensions.count(ov::DiscreteTypeInfo("Constant", p.params.version.c_str()))) {
+            continue;
+        }
+        constants.emplace_back(&p, &created_constants[layer_id]);
+    }
+    ov::parallel_for(constants.size(), [&](size_t i) {
+        const auto& [p, created] = constants[i];
+        try {
+            created->node = create_node({}, p->xml, weights, p->params);
+        } catch (...) {
+            created->error = std::current_exception();
+        }
+    });
+
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
@@ -586,7 +629,15 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        std::shared_ptr<ov::Node> node;
+        if (const auto created = created_constants.find(layer_id); created != created_constants.end()) {
+            if (created->second.error) {
+                std::rethrow_exception(created->second.error);
+            }
+            node = created->second.node;
+        } else {
+            node = create_node(inputs, p.xml, weights, p.params);
+        }
         id_to_node[layer_id] = node;
 
         if (const auto& parameter_node = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
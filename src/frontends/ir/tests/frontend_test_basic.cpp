@@ -1805,3 +1805,62 @@ TEST_F(IRFrontendTests, VeryShortValidModel) {
     OV_ASSERT_NO_THROW(version = model->get_rt_info().at("version").as<int64_t>());
     ASSERT_EQ(11, version);
 }
+
+TEST_F(IRFrontendTests, model_with_many_constants) {
+    // the constants are created in parallel, check that they are connected in the original order
+    constexpr size_t constants_num = 128;
+    std::stringstream layers, edges;
+    for (size_t i = 0; i < constants_num; ++i) {
+        layers << "<layer id=\"" << i << "\" name=\"const_" << i << "\" type=\"Const\" version=\"opset1\">"
+               << "<data element_type=\"f32\" shape=\"1\" offset=\"" << i * sizeof(float) << "\" size=\"4\"/>"
+               << "<output><port id=\"0\" precision=\"FP32\"><dim>1</dim></port></output></layer>";
+        edges << "<edge from-layer=\"" << i << "\" from-port=\"0\" to-layer=\"" << constants_num << "\" to-port=\"" << i
+              << "\"/>";
+    }
+    layers << "<layer id=\"" << constants_num << "\" name=\"concat\" type=\"Concat\" version=\"opset1\">"
+           << "<data axis=\"0\"/><input>";
+    for (size_t i = 0; i < constants_num; ++i) {
+        layers << "<port id=\"" << i << "\" precision=\"FP32\"><dim>1</dim></port>";
+    }
+    layers << "</input><output><port id=\"" << constants_num << "\" precision=\"FP32\"><dim>" << constants_num
+           << "</dim></port></output></layer>";
+    layers << "<layer id=\"" << constants_num + 1 << "\" name=\"output\" type=\"Result\" version=\"opset1\">"
+           << "<input><port id=\"0\" precision=\"FP32\"><dim>" << constants_num << "</dim></port></input></layer>";
+    edges << "<edge from-layer=\"" << constants_num << "\" from-port=\"" << constants_num << "\" to-layer=\""
+          << constants_num + 1 << "\" to-port=\"0\"/>";
+    const auto testModel = "<net name=\"Network\" version=\"11\"><layers>" + layers.str() + "</layers><edges>" +
+                           edges.str() + "</edges></net>";
+
+    ov::Tensor weights(ov::element::f32, ov::Shape{constants_num});
+    for (size_t i = 0; i < constants_num; ++i) {
+        weights.data<float>()[i] = static_cast<float>(i);
+    }
+
+    std::shared_ptr<ov::Model> model;
+    OV_ASSERT_NO_THROW(model = core.read_model(testModel, weights));
+    ASSERT_TRUE(!!model);
+
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        ov::OutputVector constants;
+        for (size_t i = 0; i < constants_num; ++i) {
+            auto constant =
+                std::make_shared<ov::opset1::Constant>(ov::element::f32, ov::Shape{1}, std::vector<float>{float(i)});
+            constant->set_friendly_name("const_" + std::to_string(i));
+            constants.push_back(constant);
+        }
+        auto concat = std::make_shared<ov::opset1::Concat>(constants, 0);
+        concat->set_friendly_name("concat");
+        auto result = std::make_shared<ov::opset1::Result>(concat);
+        result->set_friendly_name("output");
+        modelRef = std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{});
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
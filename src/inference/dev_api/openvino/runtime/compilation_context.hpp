@@ -9,6 +9,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "openvino/core/any.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
@@ -22,6 +23,21 @@ public:
 
     static std::string compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions);
 
+    /**
+     * @brief The parts of the model hash which do not depend on the compile options
+     */
+    struct ModelHash {
+        uint64_t graph = 0;                     //!< hash of the serialized model
+        std::vector<std::string> runtimeInfo;  //!< names and values of the runtime attributes which are not serialized
+    };
+
+    /**
+     * @brief Computes the parts of the model hash which do not depend on the compile options, so they may be
+     * computed before the options are known (e.g. concurrently with the compile options query)
+     */
+    static ModelHash compute_model_hash(const std::shared_ptr<const ov::Model>& model);
+    static std::string compute_hash(const ModelHash& modelHash, const ov::AnyMap& compileOptions);
+
     static std::string compute_hash(const std::string& modelName, const ov::AnyMap& compileOptions);
     static std::string compute_hash(const std::string& modeStr,
                                     const ov::Tensor& data,
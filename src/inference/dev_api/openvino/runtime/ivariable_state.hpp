@@ -51,6 +51,12 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Removes the last elements of the state along its sequence axis (e.g. the last tokens of a KV cache)
+     * @param count The number of elements to remove
+     */
+    virtual void trim(size_t count);
+
 protected:
     /**
      * @brief A default dtor
@@ -23,7 +23,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Every stream thread pulls tasks from its own queue and steals them from the queues of the other streams,
+ *        preferring the streams on the same NUMA node.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -59,6 +60,23 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Counters of the stream task queues accumulated over the executor lifetime
+     */
+    struct TaskQueueStats {
+        size_t enqueued = 0;       //!< Tasks put into the stream queues by `run()`
+        size_t stolen = 0;         //!< Tasks taken by a stream from the queue of another stream
+        size_t stolen_remote = 0;  //!< Stolen tasks which moved to a stream on another NUMA node
+        size_t contended = 0;      //!< Queue lock acquisitions which had to wait for another thread
+        size_t wakeups = 0;        //!< Notifications of the sleeping streams
+    };
+
+    /**
+     * @brief Returns the task queue counters
+     * @return TaskQueueStats
+     */
+    TaskQueueStats get_task_queue_stats() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -377,6 +378,36 @@ public:
 #endif
     /// @}
 
+    /**
+     * @brief Asynchronously creates a compiled model from a source model object.
+     *
+     * The compilation is started in a separate thread, so several models can be compiled concurrently or the
+     * compilation can be overlapped with other work of the application. The compilation keeps the Core resources
+     * alive until it is finished.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future holding the compiled model or the exception thrown by the compilation.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Asynchronously reads a model and creates a compiled model from the IR/ONNX/PDPD file.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future holding the compiled model or the exception thrown by the compilation.
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
     /**
      * @brief Reads a model and creates a compiled model from the IR/ONNX/PDPD memory.
      * @param model String with a model in IR/ONNX/PDPD format.
@@ -57,6 +57,12 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  * from DDR/L3 cache in the packed format this significantly decreases memory consumption and as a consequence improve
  * inference performance. The following code allows to set the sparse rate value.
  *
+ * For the integer activations the rate is the share of the zero weights values. For the f32 activations the weights,
+ * including the int8/int4 compressed ones, are split into blocks of 32 input channels and the rate is the share of the
+ * blocks which are zero after the decompression, these blocks are skipped during the execution. The block sparse
+ * kernel pays off against the dense one only for highly sparse weights, the break-even rate depends on the shapes and
+ * the platform, so it is worth measuring the model with a few rate values.
+ *
  * @code
  * core.set_property(ov::intel_cpu::sparse_weights_decompression_rate(0.8));
  * @endcode
@@ -721,6 +721,36 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief Read-write property to enable the deduplicated storage of the compiled blobs in the cache directory.
+ * Disabled by default.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The blobs are split into content-defined chunks, each unique chunk is stored only once, so the blobs of the same
+ * model compiled with the different configurations share the storage of their common data (e.g. weights).
+ *
+ * value type: boolean
+ *   - True store the blobs as the sets of shared chunks
+ *   - False store each blob as a single file
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_deduplication{"CACHE_DEDUPLICATION"};
+
+/**
+ * @brief Read-write property to set the size limit of the cache directory in bytes. 0 (default) means unlimited.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When the limit is exceeded after a new blob is written, the least recently used blobs are removed. There is no
+ * index of the access times: a blob read from the cache gets the modification time of its file set to the current
+ * time, and the eviction orders the blobs by this time. The cache directory may be shared by several processes, the
+ * writes are serialized by a lock file, while the reads take no lock. So with several processes:
+ *   - a blob may be removed by another process right before it is read, the read is then a cache miss and the model
+ *     is compiled again;
+ *   - the order is only as precise as the modification time of the file system and its clock, e.g. on a network file
+ *     system shared by several hosts;
+ *   - a blob whose file time cannot be set (e.g. written by another user) keeps its write time and is removed earlier.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_size_limit{"CACHE_SIZE_LIMIT"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
@@ -876,6 +906,43 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the latency target (in ms) for the auto-batching
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The value 0 (default) keeps the fixed ov::auto_batch_timeout to collect the batch. With a non-zero value the
+ * auto-batching tracks the requests arrival rate and the execution time of the batched and the batch1 requests, waits for
+ * the batch only while it is expected to fill within the target, and executes the partially collected batch with the
+ * batched request when it is cheaper than the batch1 requests. The ov::auto_batch_timeout still limits the waiting.
+ * The partially collected batch still executes the full compiled batch, so the property only changes the scheduling of
+ * the requests and saves no compute.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
+/**
+ * @brief Read-write property to set the sequence length buckets for the auto-batching of the dynamic models
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The model inputs are expected to be batched by the 0th dimension (of size 1 or dynamic) and to have the sequence
+ * length in the dynamic 1st dimension. For every bucket the model is compiled with the batch size given explicitly via
+ * the device name (e.g. BATCH:CPU(4)) and the bucket sequence length. The requests are collected to the smallest
+ * bucket fitting their sequence length, the inputs are zero padded to the bucket length, and the outputs with the
+ * dynamic 1st dimension are cut back to the request sequence length. The requests longer than the largest bucket are
+ * executed without batching. The empty list (default) disables the bucketing.
+ */
+static constexpr Property<std::vector<uint32_t>, PropertyMutability::RW> auto_batch_seq_len_buckets{
+    "AUTO_BATCH_SEQ_LEN_BUCKETS"};
+
+/**
+ * @brief Read-only property to get the utilization of the auto-batching sequence length buckets
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * For every bucket of ov::auto_batch_seq_len_buckets the share of the request tokens among all the token slots of the
+ * executed batches (the rest is the batch and sequence padding), 0 for the buckets not executed yet.
+ */
+static constexpr Property<std::vector<float>, PropertyMutability::RO> auto_batch_buckets_utilization{
+    "AUTO_BATCH_BUCKETS_UTILIZATION"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -74,6 +74,15 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Removes the last elements of the state along its sequence axis, e.g. the last tokens of a KV cache.
+     * It allows to roll back the tokens rejected in speculative decoding without setting the whole state again.
+     * If the states of a model are coupled (e.g. keys and values of the same attention), all of them should be trimmed
+     * by the same count.
+     * @param count The number of elements to remove.
+     */
+    void trim(size_t count);
 };
 
 }  // namespace ov
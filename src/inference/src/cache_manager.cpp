@@ -0,0 +1,500 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_manager.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#endif
+
+namespace ov {
+namespace {
+
+// Content-defined chunking: the chunk boundaries depend on the data only, so the same data (e.g. weights) produces
+// the same chunks regardless of its offset in the blob.
+constexpr size_t min_chunk_size = 256 * 1024;
+constexpr size_t max_chunk_size = 4 * 1024 * 1024;
+// the boundary is placed where the masked bits of the rolling hash are zero, 20 bits give ~1MB average chunk size
+constexpr uint64_t chunk_boundary_mask = ((uint64_t{1} << 20) - 1) << 44;
+// the gear rolling hash effectively covers the last 64 bytes
+constexpr size_t rolling_window_size = 64;
+
+constexpr const char* manifest_signature = "OV_CHUNKED_BLOB";
+constexpr int manifest_version = 1;
+
+constexpr std::array<uint64_t, 256> make_gear_table() {
+    // splitmix64 sequence with the fixed seed, the table must not change between releases to keep chunks reusable
+    std::array<uint64_t, 256> table{};
+    uint64_t state = 0x4f70656e56494e4full;
+    for (auto& value : table) {
+        state += 0x9e3779b97f4a7c15ull;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        value = z ^ (z >> 31);
+    }
+    return table;
+}
+
+constexpr auto gear_table = make_gear_table();
+
+size_t find_chunk_boundary(const char* data, size_t size) {
+    if (size <= min_chunk_size) {
+        return size;
+    }
+    const auto limit = std::min(size, max_chunk_size);
+    uint64_t fingerprint = 0;
+    for (size_t i = min_chunk_size - rolling_window_size; i < limit; ++i) {
+        fingerprint = (fingerprint << 1) + gear_table[static_cast<uint8_t>(data[i])];
+        if (i >= min_chunk_size && (fingerprint & chunk_boundary_mask) == 0) {
+            return i + 1;
+        }
+    }
+    return limit;
+}
+
+/**
+ * @brief Output stream buffer which splits the written data into chunks.
+ * The buffered data is processed only when at least max_chunk_size bytes are available (or on finish), so the chunk
+ * boundaries do not depend on the way the data is written.
+ */
+class ChunkingStreamBuf : public std::streambuf {
+public:
+    using ChunkHandler = std::function<void(const char*, size_t)>;
+
+    explicit ChunkingStreamBuf(ChunkHandler handler)
+        : m_buffer(2 * max_chunk_size),
+          m_handler(std::move(handler)) {
+        setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+    }
+
+    void finish() {
+        emit_chunks(true);
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        emit_chunks(false);
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    void emit_chunks(bool last) {
+        auto* begin = m_buffer.data();
+        const auto size = static_cast<size_t>(pptr() - begin);
+        size_t offset = 0;
+        while (size - offset >= max_chunk_size || (last && offset < size)) {
+            const auto chunk_size = find_chunk_boundary(begin + offset, size - offset);
+            m_handler(begin + offset, chunk_size);
+            offset += chunk_size;
+        }
+        std::memmove(begin, begin + offset, size - offset);
+        setp(begin, begin + m_buffer.size());
+        pbump(static_cast<int>(size - offset));
+    }
+
+    std::vector<char> m_buffer;
+    ChunkHandler m_handler;
+};
+
+/**
+ * @brief Input stream buffer which reads the sequence of the mapped chunks as a single blob.
+ */
+class ChunkedBlobStreamBuf : public std::streambuf {
+public:
+    explicit ChunkedBlobStreamBuf(std::vector<ov::Tensor> chunks) : m_chunks(std::move(chunks)) {
+        m_offsets.reserve(m_chunks.size() + 1);
+        m_offsets.push_back(0);
+        for (const auto& chunk : m_chunks) {
+            m_offsets.push_back(m_offsets.back() + chunk.get_byte_size());
+        }
+        set_chunk(0, 0);
+    }
+
+protected:
+    int_type underflow() override {
+        while (gptr() == egptr()) {
+            if (m_current + 1 >= m_chunks.size()) {
+                return traits_type::eof();
+            }
+            set_chunk(m_current + 1, 0);
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = static_cast<off_type>(current_position());
+        } else if (dir == std::ios_base::end) {
+            base = static_cast<off_type>(m_offsets.back());
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const auto position = static_cast<off_type>(pos);
+        if (!(which & std::ios_base::in) || position < 0 || static_cast<size_t>(position) > m_offsets.back()) {
+            return pos_type(off_type(-1));
+        }
+        // the last chunk which starts at or before the position
+        const auto it = std::upper_bound(m_offsets.begin(), m_offsets.end() - 1, static_cast<size_t>(position));
+        const auto chunk = m_chunks.empty() ? 0 : static_cast<size_t>(std::distance(m_offsets.begin(), it)) - 1;
+        set_chunk(chunk, static_cast<size_t>(position) - m_offsets[chunk]);
+        return pos;
+    }
+
+private:
+    size_t current_position() const {
+        return m_offsets[m_current] + static_cast<size_t>(gptr() - eback());
+    }
+
+    void set_chunk(size_t index, size_t offset) {
+        m_current = index;
+        if (m_chunks.empty()) {
+            setg(nullptr, nullptr, nullptr);
+            return;
+        }
+        auto* data = static_cast<char*>(m_chunks[index].data());
+        setg(data, data + offset, data + m_chunks[index].get_byte_size());
+    }
+
+    std::vector<ov::Tensor> m_chunks;
+    std::vector<size_t> m_offsets;
+    size_t m_current = 0;
+};
+
+/**
+ * @brief Cross-process advisory lock of the file, the lock file is created if it does not exist.
+ * If the lock file cannot be created (e.g. read-only cache directory), the lock is not taken.
+ */
+class FileLock {
+public:
+    FileLock(const ov::util::Path& path, bool exclusive) {
+#ifdef _WIN32
+        m_handle = CreateFileW(path.wstring().c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped{};
+            LockFileEx(m_handle, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped);
+        }
+#else
+        m_fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        if (m_fd != -1) {
+            while (flock(m_fd, exclusive ? LOCK_EX : LOCK_SH) == -1 && errno == EINTR) {
+            }
+        }
+#endif
+    }
+
+    ~FileLock() {
+        // closing the file releases the lock
+#ifdef _WIN32
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_handle);
+        }
+#else
+        if (m_fd != -1) {
+            close(m_fd);
+        }
+#endif
+    }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle;
+#else
+    int m_fd;
+#endif
+};
+
+uint64_t current_process_id() {
+#ifdef _WIN32
+    return static_cast<uint64_t>(GetCurrentProcessId());
+#else
+    return static_cast<uint64_t>(getpid());
+#endif
+}
+
+bool is_temp_file(const ov::util::Path& path) {
+    return path.extension().string().rfind(".tmp", 0) == 0;
+}
+
+std::string unique_temp_suffix() {
+    std::ostringstream suffix;
+    suffix << ".tmp" << current_process_id() << '_' << std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return suffix.str();
+}
+
+void write_file_atomically(const ov::util::Path& path, const char* data, size_t size) {
+    auto temp_path = path;
+    temp_path += unique_temp_suffix();
+    {
+        std::ofstream stream(temp_path, std::ios_base::binary | std::ofstream::out);
+        stream.write(data, static_cast<std::streamsize>(size));
+        OPENVINO_ASSERT(stream.good(), "Failed to write the cache file: ", temp_path.string());
+    }
+    std::filesystem::rename(temp_path, path);
+}
+
+bool file_content_equals(const ov::util::Path& path, const char* data, size_t size) {
+    if (std::filesystem::file_size(path) != size) {
+        return false;
+    }
+    std::ifstream stream(path, std::ios_base::binary);
+    std::vector<char> content(size);
+    stream.read(content.data(), static_cast<std::streamsize>(size));
+    return stream.good() && std::memcmp(content.data(), data, size) == 0;
+}
+
+struct ChunkedBlobManifest {
+    size_t size = 0;
+    std::vector<std::string> chunks;
+};
+
+bool read_manifest(const ov::util::Path& path, ChunkedBlobManifest& manifest) {
+    std::ifstream stream(path);
+    std::string signature;
+    int version = 0;
+    stream >> signature >> version >> manifest.size;
+    if (!stream || signature != manifest_signature || version != manifest_version) {
+        return false;
+    }
+    for (std::string chunk; stream >> chunk;) {
+        manifest.chunks.push_back(std::move(chunk));
+    }
+    return true;
+}
+
+}  // namespace
+
+std::string FileStorageCacheManager::store_chunk(const char* data, size_t size) const {
+    const auto hash = ov::runtime::compute_hash(data, size);
+    // the chunk name is the content hash and size, the hash collisions are resolved by the name suffix
+    for (size_t collision = 0;; ++collision) {
+        std::ostringstream name;
+        name << std::hex << std::setw(16) << std::setfill('0') << hash << '_' << size;
+        if (collision != 0) {
+            name << '_' << collision;
+        }
+        const auto chunk_path = getChunksDir() / (name.str() + ".chunk");
+        if (!std::filesystem::exists(chunk_path)) {
+            write_file_atomically(chunk_path, data, size);
+            return name.str();
+        }
+        if (file_content_equals(chunk_path, data, size)) {
+            return name.str();
+        }
+    }
+}
+
+void FileStorageCacheManager::write_blob_cache_entry(const std::string& id, const StreamWriter& writer) {
+    // the blob is renamed once completely written, so the concurrent readers never see the partial blob
+    const auto blob_file_name = getBlobFile(id);
+    auto temp_file_name = blob_file_name;
+    temp_file_name += unique_temp_suffix();
+    try {
+        {
+            std::ofstream stream(temp_file_name, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+        }
+        std::filesystem::rename(temp_file_name, blob_file_name);
+    } catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(temp_file_name, ec);
+        throw;
+    }
+}
+
+void FileStorageCacheManager::write_chunked_cache_entry(const std::string& id, const StreamWriter& writer) {
+    // the chunks garbage collection is blocked until the manifest referencing the new chunks is written
+    FileLock lock(getCacheFile("chunks.lock"), false);
+    std::filesystem::create_directories(getChunksDir());
+
+    ChunkedBlobManifest manifest;
+    ChunkingStreamBuf buffer([&](const char* data, size_t size) {
+        manifest.chunks.push_back(store_chunk(data, size));
+        manifest.size += size;
+    });
+    std::ostream stream(&buffer);
+    writer(stream);
+    OPENVINO_ASSERT(stream.good(), "Failed to write the cache entry: ", id);
+    buffer.finish();
+
+    std::ostringstream content;
+    content << manifest_signature << ' ' << manifest_version << '\n' << manifest.size << '\n';
+    for (const auto& chunk : manifest.chunks) {
+        content << chunk << '\n';
+    }
+    const auto content_str = content.str();
+    write_file_atomically(getManifestFile(id), content_str.data(), content_str.size());
+
+    // the single file blob of the same entry takes precedence on read, so it must not shadow the new one
+    const auto blob_file_name = getBlobFile(id);
+    if (std::filesystem::exists(blob_file_name)) {
+        std::ignore = std::filesystem::remove(blob_file_name);
+    }
+}
+
+void FileStorageCacheManager::read_chunked_cache_entry(const std::string& id, const StreamReader& reader) {
+    ChunkedBlobManifest manifest;
+    std::vector<ov::Tensor> chunks;
+    {
+        FileLock lock(getCacheFile("chunks.lock"), false);
+        if (!read_manifest(getManifestFile(id), manifest)) {
+            return;
+        }
+        chunks.reserve(manifest.chunks.size());
+        size_t size = 0;
+        for (const auto& chunk : manifest.chunks) {
+            const auto chunk_path = getChunksDir() / (chunk + ".chunk");
+            if (!std::filesystem::exists(chunk_path)) {
+                // incomplete entry is treated as missing one
+                return;
+            }
+            chunks.push_back(ov::read_tensor_data(chunk_path));
+            size += chunks.back().get_byte_size();
+        }
+        if (size != manifest.size) {
+            return;
+        }
+    }
+
+    // the mapped chunks are read in place as a single stream, since they are not contiguous in memory
+    ChunkedBlobStreamBuf buffer(std::move(chunks));
+    std::istream stream(&buffer);
+    CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
+    reader(compiled_blob);
+}
+
+void FileStorageCacheManager::remove_chunked_cache_entry(const std::string& id) {
+    std::ignore = std::filesystem::remove(getManifestFile(id));
+    std::ignore = collect_garbage_chunks();
+}
+
+uint64_t FileStorageCacheManager::collect_garbage_chunks() {
+    FileLock lock(getCacheFile("chunks.lock"), true);
+    if (!std::filesystem::exists(getChunksDir())) {
+        return 0;
+    }
+
+    // remove the chunks which are not referenced by the remaining entries
+    std::unordered_set<std::string> referenced;
+    for (const auto& file : std::filesystem::directory_iterator(getCacheFile(""))) {
+        ChunkedBlobManifest manifest;
+        if (file.path().extension() == ".chunks" && read_manifest(file.path(), manifest)) {
+            referenced.insert(manifest.chunks.begin(), manifest.chunks.end());
+        }
+    }
+    uint64_t removed_size = 0;
+    for (const auto& file : std::filesystem::directory_iterator(getChunksDir())) {
+        if (file.path().extension() == ".chunk" && !referenced.count(file.path().stem().string())) {
+            std::error_code ec;
+            const auto size = file.file_size(ec);
+            if (std::filesystem::remove(file.path(), ec)) {
+                removed_size += size;
+            }
+        }
+    }
+    return removed_size;
+}
+
+void FileStorageCacheManager::touch_entry(const ov::util::Path& path) const {
+    // the entry may be removed by another process meanwhile, or the file may belong to another user,
+    // then it just keeps its previous time
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+}
+
+void FileStorageCacheManager::evict_entries(const std::string& id) {
+    FileLock lock(getCacheFile("cache.lock"), true);
+
+    struct Entry {
+        std::string id;
+        std::filesystem::file_time_type access_time;
+        ov::util::Path path;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    uint64_t total_size = 0;
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(getCacheFile(""))) {
+        if (!file.is_regular_file(ec) || is_temp_file(file.path())) {
+            continue;
+        }
+        auto size = file.file_size(ec);
+        size = ec ? 0 : size;
+        total_size += size;
+        const auto extension = file.path().extension();
+        if (extension != ".blob" && extension != ".chunks") {
+            continue;
+        }
+        // the reads touch the entry files, so their time is the last access time
+        entries.push_back({file.path().stem().string(), file.last_write_time(ec), file.path(), size});
+    }
+    if (std::filesystem::exists(getChunksDir())) {
+        for (const auto& file : std::filesystem::directory_iterator(getChunksDir())) {
+            if (file.path().extension() == ".chunk") {
+                const auto size = file.file_size(ec);
+                total_size += ec ? 0 : size;
+            }
+        }
+    }
+    if (total_size <= m_sizeLimit) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.access_time != rhs.access_time ? lhs.access_time < rhs.access_time : lhs.id < rhs.id;
+    });
+    // the entry just written is never evicted, even if it alone exceeds the limit
+    for (const auto& entry : entries) {
+        if (total_size <= m_sizeLimit) {
+            break;
+        }
+        if (entry.id == id || !std::filesystem::remove(entry.path, ec)) {
+            continue;
+        }
+        total_size -= std::min(total_size, entry.size);
+        if (entry.path.extension() == ".chunks") {
+            total_size -= std::min(total_size, collect_garbage_chunks());
+        }
+    }
+}
+
+}  // namespace ov
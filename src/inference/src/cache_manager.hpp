@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <functional>
@@ -105,25 +106,67 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * In the deduplication mode a blob is split into content-defined chunks stored once in the "chunks" subdirectory
+ * and referenced by the "<id>.chunks" manifest file, so the blobs sharing data (e.g. weights of the same model
+ * compiled with different configurations) share the storage.
+ * With the size limit set, a read touches the entry file, so its modification time is the last access time, and the
+ * least recently used entries are evicted by the writes once the cache directory exceeds the limit.
+ * The directory may be shared by several processes: the files are written to temporary files and renamed, and the
+ * chunks and the eviction are guarded by the cross-process file locks.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    bool m_deduplicate;
+    uint64_t m_sizeLimit;
 
-    ov::util::Path getBlobFile(const std::string& blobHash) const {
+    ov::util::Path getCacheFile(const std::string& fileName) const {
 #if defined(_WIN32) && defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
-        return ov::util::string_to_wstring(ov::util::make_path(m_cachePath, blobHash + ".blob"));
+        return ov::util::string_to_wstring(ov::util::make_path(m_cachePath, fileName));
 #else
-        return ov::util::make_path(m_cachePath, blobHash + ".blob");
+        return ov::util::make_path(m_cachePath, fileName);
 #endif
     }
 
+    ov::util::Path getBlobFile(const std::string& blobHash) const {
+        return getCacheFile(blobHash + ".blob");
+    }
+
+    ov::util::Path getManifestFile(const std::string& blobHash) const {
+        return getCacheFile(blobHash + ".chunks");
+    }
+
+    ov::util::Path getChunksDir() const {
+        return getCacheFile("chunks");
+    }
+
+    void write_blob_cache_entry(const std::string& id, const StreamWriter& writer);
+    void write_chunked_cache_entry(const std::string& id, const StreamWriter& writer);
+    void read_chunked_cache_entry(const std::string& id, const StreamReader& reader);
+    void remove_chunked_cache_entry(const std::string& id);
+    std::string store_chunk(const char* data, size_t size) const;
+    uint64_t collect_garbage_chunks();
+    /**
+     * @brief Sets the modification time of the entry file to now, it is the access time for the eviction
+     */
+    void touch_entry(const ov::util::Path& path) const;
+    /**
+     * @brief Evicts the least recently used entries (except the given one) until the cache size fits the limit
+     */
+    void evict_entries(const std::string& id);
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Path to the cache directory
+     * @param deduplicate Enables the deduplicated (chunked) storage of the new cache entries
+     * @param sizeLimit Limit of the cache directory size in bytes, 0 means unlimited
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, bool deduplicate = false, uint64_t sizeLimit = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_deduplicate(deduplicate),
+          m_sizeLimit(sizeLimit) {}
 
     /**
      * @brief Destructor
@@ -135,8 +178,14 @@ private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
         // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
         ScopedLocale plocal_C(LC_ALL, "C");
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        if (m_deduplicate) {
+            write_chunked_cache_entry(id, writer);
+        } else {
+            write_blob_cache_entry(id, writer);
+        }
+        if (m_sizeLimit != 0) {
+            evict_entries(id);
+        }
     }
 
     void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
@@ -144,6 +193,9 @@ private:
         ScopedLocale plocal_C(LC_ALL, "C");
         const auto blob_file_name = getBlobFile(id);
         if (std::filesystem::exists(blob_file_name)) {
+            if (m_sizeLimit != 0) {
+                touch_entry(blob_file_name);
+            }
             if (enable_mmap) {
                 CompiledBlobVariant compiled_blob{std::in_place_index<0>, ov::read_tensor_data(blob_file_name)};
                 reader(compiled_blob);
@@ -152,6 +204,11 @@ private:
                 CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
                 reader(compiled_blob);
             }
+        } else if (std::filesystem::exists(getManifestFile(id))) {
+            if (m_sizeLimit != 0) {
+                touch_entry(getManifestFile(id));
+            }
+            read_chunked_cache_entry(id, reader);
         }
     }
 
@@ -161,6 +218,10 @@ private:
         if (std::filesystem::exists(blobFileName)) {
             std::ignore = std::filesystem::remove(blobFileName);
         }
+        // in the deduplication mode a failed write may leave the chunks which are not referenced by any entry
+        if (m_deduplicate || std::filesystem::exists(getManifestFile(id))) {
+            remove_chunked_cache_entry(id);
+        }
     }
 };
 
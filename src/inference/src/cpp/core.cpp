@@ -137,6 +137,28 @@ CompiledModel Core::compile_model(const std::wstring& model_path,
 }
 #endif
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    return std::async(std::launch::async, [impl = _impl, model, device_name, config]() -> CompiledModel {
+        OV_CORE_CALL_STATEMENT({
+            auto exec = impl->compile_model(model, device_name, config);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& model_path,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    return std::async(std::launch::async, [impl = _impl, model_path, device_name, config]() -> CompiledModel {
+        OV_CORE_CALL_STATEMENT({
+            auto exec = impl->compile_model(model_path, device_name, config);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
 CompiledModel Core::compile_model(const std::string& model,
                                   const ov::Tensor& weights,
                                   const std::string& device_name,
@@ -49,4 +49,8 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::trim(size_t count) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->trim(count));
+}
+
 }  // namespace ov
@@ -53,34 +53,47 @@ std::string ModelCache::calculate_file_info(const std::string& filePath) {
 }
 
 std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions) {
-    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_hash - Model");
+    return compute_hash(compute_model_hash(model), compileOptions);
+}
+
+ModelCache::ModelHash ModelCache::compute_model_hash(const std::shared_ptr<const ov::Model>& model) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_model_hash - Model");
 
     OPENVINO_ASSERT(model);
 
-    uint64_t seed = 0;
+    ModelHash modelHash;
     // 1. Calculate hash on function
     ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(modelHash.graph);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
 
-    // 2. Compute hash on serialized data and options
-    for (const auto& [name, option] : compileOptions) {
-        seed = hash_combine(seed, name + option.as<std::string>());
-    }
-
-    // 3. Add runtime information which may not be serialized
+    // Collect runtime information which may not be serialized, it is hashed after the options
     for (const auto& op : model->get_ordered_ops()) {
         // Skip runtime attributes which are not hash-able
         for (const auto& [name, attribute] : op->get_rt_info()) {
             if (!attribute.is<ov::RuntimeAttribute>() || attribute.as<ov::RuntimeAttribute>().is_deterministic()) {
-                seed = hash_combine(seed, name);
+                modelHash.runtimeInfo.push_back(name);
                 std::stringstream strm;
                 attribute.print(strm);
-                seed = hash_combine(seed, strm.str());
+                modelHash.runtimeInfo.push_back(strm.str());
             }
         }
     }
 
+    return modelHash;
+}
+
+std::string ModelCache::compute_hash(const ModelHash& modelHash, const ov::AnyMap& compileOptions) {
+    uint64_t seed = modelHash.graph;
+    // 2. Compute hash on serialized data and options
+    for (const auto& [name, option] : compileOptions) {
+        seed = hash_combine(seed, name + option.as<std::string>());
+    }
+
+    // 3. Add runtime information which may not be serialized
+    for (const auto& info : modelHash.runtimeInfo) {
+        seed = hash_combine(seed, info);
+    }
     return std::to_string(seed);
 }
 
@@ -4,6 +4,7 @@
 
 #include "core_impl.hpp"
 
+#include <future>
 #include <memory>
 #include <variant>
 
@@ -205,10 +206,17 @@ void clean_batch_properties(const std::string& deviceName, ov::AnyMap& config, c
 }
 
 static const auto core_properties_names =
-    ov::util::make_array(ov::cache_dir.name(), ov::enable_mmap.name(), ov::force_tbb_terminate.name());
+    ov::util::make_array(ov::cache_dir.name(),
+                         ov::cache_deduplication.name(),
+                         ov::cache_size_limit.name(),
+                         ov::enable_mmap.name(),
+                         ov::force_tbb_terminate.name());
 
 static const auto auto_batch_properties_names =
-    ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
+    ov::util::make_array(ov::auto_batch_timeout.name(),
+                         ov::auto_batch_latency_slo.name(),
+                         ov::auto_batch_seq_len_buckets.name(),
+                         ov::hint::allow_auto_batching.name());
 
 ov::util::Path extract_weight_path(const std::string& compiled_properties) {
     if (auto start = compiled_properties.find(ov::weights_path.name()); start != std::string::npos) {
@@ -265,6 +273,22 @@ ov::SoPtr<ov::ICompiledModel> import_compiled_model(const ov::Plugin& plugin,
     std::visit(apply_model_hint, model_hint);
     return import_compiled_model(plugin, context, cfg);
 }
+
+/**
+ * @brief Starts the model hash computation in background if the model is going to be cached.
+ * The model part of the hash does not depend on the plugin, so it overlaps with the compiled blob import and the
+ * query of the compile options. The hash is not needed when the compiled blob is given, unless its import fails.
+ */
+std::future<ov::ModelCache::ModelHash> start_model_hash(const std::shared_ptr<const ov::Model>& model,
+                                                        bool model_caching,
+                                                        const ov::AnyMap& config) {
+    if (!model_caching || config.count(ov::hint::compiled_blob.name()) != 0) {
+        return {};
+    }
+    return std::async(std::launch::async, [model] {
+        return ov::ModelCache::compute_model_hash(model);
+    });
+}
 }  // namespace
 
 bool ov::is_config_applicable(const std::string& user_device_name, const std::string& subprop_device_name) {
@@ -830,13 +854,19 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto plugin = get_plugin(parsed._deviceName);
     // will consume ov::cache_dir if plugin not support it
     auto cacheManager = parsed._core_config.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
-    auto res = import_compiled_model(plugin, {}, parsed._config, model);
     // Skip caching for proxy plugin. HW plugin will load network from the cache
+    const bool model_caching =
+        cacheManager && device_supports_model_caching(plugin, parsed._config) && !is_proxy_device(plugin);
+    auto model_hash = start_model_hash(model, model_caching, parsed._config);
+    auto res = import_compiled_model(plugin, {}, parsed._config, model);
     if (res) {
         // hint::compiled_blob is set and imported skip compilation
-    } else if (cacheManager && device_supports_model_caching(plugin, parsed._config) && !is_proxy_device(plugin)) {
+    } else if (model_caching) {
         CacheContent cacheContent{cacheManager, parsed._core_config.get_enable_mmap()};
-        cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
+        const auto compile_config = create_compile_config(plugin, parsed._config);
+        cacheContent.blobId = ov::ModelCache::compute_hash(
+            model_hash.valid() ? model_hash.get() : ov::ModelCache::compute_model_hash(model),
+            compile_config);
         cacheContent.model = model;
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
@@ -867,13 +897,19 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto plugin = get_plugin(parsed._deviceName);
     // will consume ov::cache_dir if plugin not support it
     auto cacheManager = parsed._core_config.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
-    auto res = import_compiled_model(plugin, context, parsed._config, model);
     // Skip caching for proxy plugin. HW plugin will load network from the cache
+    const bool model_caching =
+        cacheManager && device_supports_model_caching(plugin, parsed._config) && !is_proxy_device(plugin);
+    auto model_hash = start_model_hash(model, model_caching, parsed._config);
+    auto res = import_compiled_model(plugin, context, parsed._config, model);
     if (res) {
         // hint::compiled_blob is set and imported skip compilation
-    } else if (cacheManager && device_supports_model_caching(plugin, parsed._config) && !is_proxy_device(plugin)) {
+    } else if (model_caching) {
         CacheContent cacheContent{cacheManager, parsed._core_config.get_enable_mmap()};
-        cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
+        const auto compile_config = create_compile_config(plugin, parsed._config);
+        cacheContent.blobId = ov::ModelCache::compute_hash(
+            model_hash.valid() ? model_hash.get() : ov::ModelCache::compute_model_hash(model),
+            compile_config);
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         cacheContent.model = model;
         res = load_model_from_cache(cacheContent, plugin, parsed._config, context, [&]() {
@@ -1247,6 +1283,11 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::cache_deduplication.name()) {
+        const auto flag = coreConfig.get_cache_deduplication();
+        return decltype(ov::cache_deduplication)::value_type(flag);
+    } else if (name == ov::cache_size_limit.name()) {
+        return decltype(ov::cache_size_limit)::value_type(coreConfig.get_cache_size_limit());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1370,6 +1411,13 @@ void ov::CoreImpl::set_property_for_device(const ov::AnyMap& configMap, const st
             if (it != config.end()) {
                 config.erase(it);
             }
+
+            for (const auto& name : {ov::cache_deduplication.name(), ov::cache_size_limit.name()}) {
+                it = config.find(name);
+                if (it != config.end()) {
+                    config.erase(it);
+                }
+            }
         }
 
         if (!config.empty()) {
@@ -1672,19 +1720,52 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         std::lock_guard<std::mutex> lock(other._cacheConfigMutex);
         _cacheConfig = other._cacheConfig;
         _cacheConfigPerDevice = other._cacheConfigPerDevice;
+        _flag_cache_deduplication = other._flag_cache_deduplication;
+        _cache_size_limit = other._cache_size_limit;
     }
     _flag_enable_mmap = other._flag_enable_mmap;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config) {
+    {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        bool storage_changed = false;
+        auto it = config.find(ov::cache_deduplication.name());
+        if (it != config.end()) {
+            auto flag = it->second.as<bool>();
+            storage_changed |= flag != _flag_cache_deduplication;
+            _flag_cache_deduplication = flag;
+        }
+        it = config.find(ov::cache_size_limit.name());
+        if (it != config.end()) {
+            auto limit = it->second.as<uint64_t>();
+            storage_changed |= limit != _cache_size_limit;
+            _cache_size_limit = limit;
+        }
+        if (storage_changed) {
+            // re-create the cache managers of the already configured directories with the new storage options
+            _cacheConfig =
+                CoreConfig::CacheConfig::create(_cacheConfig._cacheDir, _flag_cache_deduplication, _cache_size_limit);
+            for (auto& deviceCfg : _cacheConfigPerDevice) {
+                deviceCfg.second = CoreConfig::CacheConfig::create(deviceCfg.second._cacheDir,
+                                                                   _flag_cache_deduplication,
+                                                                   _cache_size_limit);
+            }
+        }
+    }
+
     auto it = config.find(ov::cache_dir.name());
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(),
+                                                       _flag_cache_deduplication,
+                                                       _cache_size_limit);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(),
+                                                               _flag_cache_deduplication,
+                                                               _cache_size_limit);
         }
     }
 
@@ -1713,14 +1794,18 @@ void ov::CoreConfig::remove_core(ov::AnyMap& config) {
 }
 
 void ov::CoreConfig::remove_core_skip_cache_dir(ov::AnyMap& config) {
-    for (const auto& name : {ov::enable_mmap.name(), ov::force_tbb_terminate.name()}) {
+    for (const auto& name :
+         {ov::cache_deduplication.name(),
+          ov::cache_size_limit.name(),
+          ov::enable_mmap.name(),
+          ov::force_tbb_terminate.name()}) {
         config.erase(name);
     }
 }
 
 void ov::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _flag_cache_deduplication, _cache_size_limit);
 }
 
 std::string ov::CoreConfig::get_cache_dir() const {
@@ -1732,6 +1817,16 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+bool ov::CoreConfig::get_cache_deduplication() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _flag_cache_deduplication;
+}
+
+uint64_t ov::CoreConfig::get_cache_size_limit() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cache_size_limit;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin,
@@ -1739,7 +1834,8 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         const auto& cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        const auto& tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        const auto& tempConfig =
+            CoreConfig::CacheConfig::create(cache_dir_val, get_cache_deduplication(), get_cache_size_limit());
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1757,7 +1853,9 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov
     return _cacheConfigPerDevice.count(plugin.get_name()) ? _cacheConfigPerDevice.at(plugin.get_name()) : _cacheConfig;
 }
 
-ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::string& dir,
+                                                                bool deduplicate,
+                                                                uint64_t size_limit) {
     CacheConfig cache_config{dir, nullptr};
     if (!dir.empty()) {
         if constexpr (std::is_same_v<std::filesystem::path::value_type, std::wstring::value_type>) {
@@ -1768,7 +1866,7 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::strin
         } else {
             ov::util::create_directory_recursive(dir);
         }
-        cache_config._cacheManager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        cache_config._cacheManager = std::make_shared<ov::FileStorageCacheManager>(dir, deduplicate, size_limit);
     }
     return cache_config;
 }
@@ -32,7 +32,7 @@ public:
         std::string _cacheDir;
         std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-        static CacheConfig create(const std::string& dir);
+        static CacheConfig create(const std::string& dir, bool deduplicate = false, uint64_t size_limit = 0);
     };
 
     void set(const ov::AnyMap& config);
@@ -50,6 +50,10 @@ public:
 
     bool get_enable_mmap() const;
 
+    bool get_cache_deduplication() const;
+
+    uint64_t get_cache_size_limit() const;
+
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
 
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
@@ -64,6 +68,8 @@ private:
     CacheConfig _cacheConfig;
     std::map<std::string, CacheConfig> _cacheConfigPerDevice;
     bool _flag_enable_mmap = true;
+    bool _flag_cache_deduplication = false;
+    uint64_t _cache_size_limit = 0;
 };
 
 struct Parsed {
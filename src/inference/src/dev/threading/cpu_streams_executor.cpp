@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -353,6 +354,39 @@ struct CPUStreamsExecutor::Impl {
         std::mutex _stream_map_mutex;
     };
 
+    // Task queue of one stream thread. The tasks run from the stream thread go to its own queue, the tasks from the
+    // other threads are spread round-robin. An idle stream takes the oldest task of its own queue first and then steals
+    // from the other streams, preferring the ones on the same NUMA node.
+    struct alignas(64) TaskQueue {
+        std::unique_lock<std::mutex> lock() {
+            std::unique_lock<std::mutex> lock{_mutex, std::try_to_lock};
+            if (!lock.owns_lock()) {
+                _contended.fetch_add(1, std::memory_order_relaxed);
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+        std::atomic<size_t> _size{0};
+        std::atomic<int> _numaNodeId{-1};
+        std::atomic<size_t> _enqueued{0};
+        std::atomic<size_t> _stolen{0};
+        std::atomic<size_t> _stolenRemote{0};
+        std::atomic<size_t> _contended{0};
+    };
+
+    struct Worker {
+        const Impl* _impl = nullptr;
+        size_t _queueId = 0;
+    };
+
+    static Worker& current_worker() {
+        static thread_local Worker worker;
+        return worker;
+    }
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams(
@@ -371,6 +405,9 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue);
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -378,21 +415,22 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                current_worker() = {this, static_cast<size_t>(streamId)};
+                auto& queue = *_taskQueues[streamId];
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    if (Dequeue(streamId, task)) {
+                        auto& stream = *(_streams.local());
+                        queue._numaNodeId.store(stream._numaNodeId, std::memory_order_relaxed);
+                        Execute(task, stream);
+                        continue;
                     }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _sleepingStreams.fetch_add(1);
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks.load() > 0 || (stopped = _isStopped);
+                    });
+                    _sleepingStreams.fetch_sub(1);
                 }
             });
         }
@@ -400,11 +438,67 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        const auto& worker = current_worker();
+        const auto queueId = worker._impl == this
+                                 ? worker._queueId
+                                 : _nextQueueId.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size();
+        auto& queue = *_taskQueues[queueId];
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            auto lock = queue.lock();
+            queue._tasks.emplace_back(std::move(task));
+            queue._size.store(queue._tasks.size(), std::memory_order_relaxed);
+            _pendingTasks.fetch_add(1);
+        }
+        queue._enqueued.fetch_add(1, std::memory_order_relaxed);
+        // the sleeping streams check _pendingTasks after registering in _sleepingStreams, so the wake-up is not lost
+        // and the busy executor does not touch the shared mutex at all
+        if (_sleepingStreams.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _wakeups.fetch_add(1, std::memory_order_relaxed);
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
+    }
+
+    bool PopTask(TaskQueue& queue, Task& task) {
+        if (queue._size.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        auto lock = queue.lock();
+        if (queue._tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue._tasks.front());
+        queue._tasks.pop_front();
+        queue._size.store(queue._tasks.size(), std::memory_order_relaxed);
+        _pendingTasks.fetch_sub(1);
+        return true;
+    }
+
+    bool Dequeue(size_t queueId, Task& task) {
+        if (PopTask(*_taskQueues[queueId], task)) {
+            return true;
+        }
+        const auto queuesNum = _taskQueues.size();
+        const int numaNodeId = _taskQueues[queueId]->_numaNodeId.load(std::memory_order_relaxed);
+        for (bool remote : {false, true}) {
+            for (size_t i = 1; i < queuesNum; i++) {
+                auto& victim = *_taskQueues[(queueId + i) % queuesNum];
+                const int victimNumaNodeId = victim._numaNodeId.load(std::memory_order_relaxed);
+                // the node of a stream is known after its first task
+                const bool sameNode = numaNodeId < 0 || victimNumaNodeId < 0 || numaNodeId == victimNumaNodeId;
+                if (sameNode == remote || !PopTask(victim, task)) {
+                    continue;
+                }
+                victim._stolen.fetch_add(1, std::memory_order_relaxed);
+                if (remote) {
+                    victim._stolenRemote.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -474,7 +568,11 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<size_t> _nextQueueId{0};
+    std::atomic<size_t> _pendingTasks{0};
+    std::atomic<int> _sleepingStreams{0};
+    std::atomic<size_t> _wakeups{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -527,6 +625,18 @@ void CPUStreamsExecutor::cpu_reset() {
     }
 }
 
+CPUStreamsExecutor::TaskQueueStats CPUStreamsExecutor::get_task_queue_stats() const {
+    TaskQueueStats stats;
+    for (const auto& queue : _impl->_taskQueues) {
+        stats.enqueued += queue->_enqueued.load(std::memory_order_relaxed);
+        stats.stolen += queue->_stolen.load(std::memory_order_relaxed);
+        stats.stolen_remote += queue->_stolenRemote.load(std::memory_order_relaxed);
+        stats.contended += queue->_contended.load(std::memory_order_relaxed);
+    }
+    stats.wakeups = _impl->_wakeups.load(std::memory_order_relaxed);
+    return stats;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
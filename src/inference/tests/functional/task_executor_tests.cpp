@@ -4,7 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <condition_variable>
 #include <future>
+#include <mutex>
 #include <thread>
 
 #include "common_test_utils/test_assertions.hpp"
@@ -215,6 +217,42 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, idleStreamStealsTasksOfBusyStream) {
+    CPUStreamsExecutor taskExecutor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1}};
+    if (taskExecutor.get_streams_num() < 2) {
+        GTEST_SKIP();
+    }
+    constexpr int NUMBER_OF_TASKS = 100;
+    std::mutex mutex;
+    std::condition_variable cv;
+    int finished = 0;
+    auto outer = std::make_shared<std::packaged_task<bool()>>([&] {
+        // the tasks go to the queue of the current stream, which is blocked until the other stream runs them all
+        for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+            taskExecutor.run([&] {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++finished;
+                }
+                cv.notify_all();
+            });
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, std::chrono::seconds(10), [&] {
+            return finished == NUMBER_OF_TASKS;
+        });
+    });
+    auto future = outer->get_future();
+    taskExecutor.run([outer] {
+        (*outer)();
+    });
+    ASSERT_TRUE(future.get());
+    const auto stats = taskExecutor.get_task_queue_stats();
+    EXPECT_EQ(static_cast<size_t>(NUMBER_OF_TASKS + 1), stats.enqueued);
+    // the first task may be stolen too
+    EXPECT_GE(stats.stolen, static_cast<size_t>(NUMBER_OF_TASKS));
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+
+using namespace ov;
+
+class FileStorageCacheManagerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_cacheDir = std::string("file_storage_cache_test_") +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        std::filesystem::create_directories(m_cacheDir);
+
+        // incompressible data shared by the blobs, e.g. weights
+        std::mt19937 generator(42);
+        m_weights.resize(16 * 1024 * 1024);
+        for (auto& value : m_weights) {
+            value = static_cast<char>(generator());
+        }
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_cacheDir);
+    }
+
+    void write(ICacheManager& manager, const std::string& id, const std::string& header) {
+        manager.write_cache_entry(id, [&](std::ostream& stream) {
+            stream << header;
+            stream.write(m_weights.data(), m_weights.size());
+        });
+    }
+
+    std::string read(ICacheManager& manager, const std::string& id, bool enable_mmap = false) {
+        std::string content;
+        manager.read_cache_entry(id, enable_mmap, [&](ICacheManager::CompiledBlobVariant& compiled_blob) {
+            auto& stream = std::get<1>(compiled_blob).get();
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        });
+        return content;
+    }
+
+    size_t chunks_size() const {
+        size_t size = 0;
+        for (const auto& file : std::filesystem::directory_iterator(std::filesystem::path(m_cacheDir) / "chunks")) {
+            size += std::filesystem::file_size(file.path());
+        }
+        return size;
+    }
+
+    std::string m_cacheDir;
+    std::string m_weights;
+};
+
+TEST_F(FileStorageCacheManagerTests, DeduplicatedEntriesShareChunks) {
+    FileStorageCacheManager manager(m_cacheDir, true);
+    write(manager, "first", "first config");
+    write(manager, "second", "a much longer second config");
+
+    EXPECT_FALSE(std::filesystem::exists(std::filesystem::path(m_cacheDir) / "first.blob"));
+    EXPECT_EQ(read(manager, "first"), "first config" + m_weights);
+    EXPECT_EQ(read(manager, "second", true), "a much longer second config" + m_weights);
+    // the second entry reuses almost all the chunks of the first one
+    EXPECT_LT(chunks_size(), m_weights.size() * 3 / 2);
+}
+
+TEST_F(FileStorageCacheManagerTests, DeduplicatedEntrySeek) {
+    FileStorageCacheManager storage(m_cacheDir, true);
+    ICacheManager& manager = storage;
+    write(manager, "entry", "header");
+
+    manager.read_cache_entry("entry", false, [&](ICacheManager::CompiledBlobVariant& compiled_blob) {
+        auto& stream = std::get<1>(compiled_blob).get();
+        const size_t offset = 6 + 10 * 1024 * 1024;
+        stream.seekg(offset);
+        std::string data(64, '\0');
+        stream.read(data.data(), data.size());
+        EXPECT_EQ(data, m_weights.substr(offset - 6, 64));
+        EXPECT_EQ(static_cast<size_t>(stream.tellg()), offset + 64);
+        stream.seekg(0, std::ios_base::end);
+        EXPECT_EQ(static_cast<size_t>(stream.tellg()), 6 + m_weights.size());
+    });
+}
+
+TEST_F(FileStorageCacheManagerTests, RemoveKeepsSharedChunks) {
+    FileStorageCacheManager storage(m_cacheDir, true);
+    ICacheManager& manager = storage;
+    write(manager, "first", "first config");
+    write(manager, "second", "second config");
+
+    manager.remove_cache_entry("first");
+    EXPECT_TRUE(read(manager, "first").empty());
+    EXPECT_EQ(read(manager, "second"), "second config" + m_weights);
+
+    manager.remove_cache_entry("second");
+    EXPECT_EQ(chunks_size(), 0u);
+}
+
+TEST_F(FileStorageCacheManagerTests, ReadsEntriesOfBothModes) {
+    FileStorageCacheManager plain_manager(m_cacheDir);
+    FileStorageCacheManager deduplicating_manager(m_cacheDir, true);
+    write(plain_manager, "plain", "plain");
+    write(deduplicating_manager, "chunked", "chunked");
+
+    EXPECT_EQ(read(deduplicating_manager, "plain"), "plain" + m_weights);
+    EXPECT_EQ(read(plain_manager, "chunked"), "chunked" + m_weights);
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictsLeastRecentlyUsedEntries) {
+    // two entries fit into the limit, the third one evicts the least recently used
+    FileStorageCacheManager storage(m_cacheDir, false, m_weights.size() * 5 / 2);
+    ICacheManager& manager = storage;
+    write(manager, "first", "first");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    write(manager, "second", "second");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(read(manager, "first"), "first" + m_weights);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    write(manager, "third", "third");
+
+    EXPECT_EQ(read(manager, "first"), "first" + m_weights);
+    EXPECT_TRUE(read(manager, "second").empty());
+    EXPECT_EQ(read(manager, "third"), "third" + m_weights);
+}
+
+TEST_F(FileStorageCacheManagerTests, ReadTouchesEntryOnly) {
+    FileStorageCacheManager storage(m_cacheDir, false, m_weights.size() * 4);
+    ICacheManager& manager = storage;
+    write(manager, "first", "first");
+    const auto blob_file = std::filesystem::path(m_cacheDir) / "first.blob";
+    const auto written_time = std::filesystem::file_time_type::clock::now() - std::chrono::hours(1);
+    std::filesystem::last_write_time(blob_file, written_time);
+    const auto files_count = std::distance(std::filesystem::directory_iterator(m_cacheDir), {});
+
+    EXPECT_EQ(read(manager, "first"), "first" + m_weights);
+    // the read does not take the locks or rewrite any index, it only updates the access time
+    EXPECT_GT(std::filesystem::last_write_time(blob_file), written_time);
+    EXPECT_EQ(files_count, std::distance(std::filesystem::directory_iterator(m_cacheDir), {}));
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictionRemovesUnreferencedChunks) {
+    FileStorageCacheManager storage(m_cacheDir, true, m_weights.size() / 2);
+    ICacheManager& manager = storage;
+    write(manager, "first", "first");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // the only entry exceeding the limit is kept
+    EXPECT_EQ(read(manager, "first"), "first" + m_weights);
+
+    std::reverse(m_weights.begin(), m_weights.end());
+    write(manager, "second", "second");
+    EXPECT_TRUE(read(manager, "first").empty());
+    EXPECT_EQ(read(manager, "second"), "second" + m_weights);
+    EXPECT_LT(chunks_size(), m_weights.size() * 3 / 2);
+}
@@ -180,6 +180,15 @@ TEST(NetworkContext, HashWithConfig) {
               ov::ModelCache::compute_hash(net2, {{"key", "value"}}));
 }
 
+TEST(NetworkContext, HashOfModelPartWithConfig) {
+    auto net = create_simple_model();
+    net->get_ops().front()->get_rt_info()["PrimitivesPriority"] = "testPriority";
+    const ov::AnyMap config = {{"key", "value"}};
+    // the hash combined from the precomputed model part is the same as the one of the whole model and config
+    ASSERT_EQ(ov::ModelCache::compute_hash(net, config),
+              ov::ModelCache::compute_hash(ov::ModelCache::compute_model_hash(net), config));
+}
+
 TEST(NetworkContext, HashWithPrimitivesPriority) {
     auto net1 = create_simple_model();
     auto net2 = create_simple_model();
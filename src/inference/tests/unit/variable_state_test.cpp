@@ -146,6 +146,22 @@ TEST_F(VariableStateTests, InfReqVariableStatePropagatesExceptionsFromReset) {
     EXPECT_ANY_THROW(state.front().reset());
 }
 
+TEST_F(VariableStateTests, InfReqVariableStatePropagatesTrim) {
+    std::vector<ov::SoPtr<ov::IVariableState>> toReturn;
+    toReturn.push_back(mock_variable_state);
+
+    EXPECT_CALL(*mock_infer_request.get(), query_state()).Times(1).WillRepeatedly(Return(toReturn));
+    EXPECT_CALL(*mock_variable_state.get(), trim(3)).Times(1);
+
+    auto state = req.query_state();
+    state.front().trim(3);
+}
+
+TEST_F(VariableStateTests, VariableStateInternalTrimIsNotImplementedByDefault) {
+    std::shared_ptr<ov::IVariableState> pState(new VariableStateMockImpl("VariableStateMockImpl"));
+    EXPECT_THROW(pState->trim(1), ov::NotImplemented);
+}
+
 TEST_F(VariableStateTests, InfReqVariableStatePropagatesGetName) {
     std::vector<ov::SoPtr<ov::IVariableState>> toReturn;
     std::string test_name = "someName";
@@ -15,23 +15,25 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
     : ov::IAsyncInferRequest(request, nullptr, callback_executor),
       m_sync_request(request),
       m_request_without_batch(request_without_batch) {
-    if (m_sync_request && m_sync_request->get_batch_size() == 0) {
-        // batch not applicable, just a wrapper to hardware infer request
-        // share the tensors with hardware infer request
+    if (m_sync_request && (m_sync_request->get_batch_size() == 0 || m_sync_request->is_bucketing())) {
+        // share the tensors with hardware infer request, with the bucketing the inputs are padded from them
         for (const auto& input : get_inputs()) {
             auto tensor = m_request_without_batch->get_tensor(input);
             if (!tensor._so) {
                 tensor._so = m_request_without_batch._so;
             }
-            set_tensor(input, tensor);
+            ov::IAsyncInferRequest::set_tensor(input, tensor);
         }
         for (const auto& output : get_outputs()) {
             auto tensor = m_request_without_batch->get_tensor(output);
             if (!tensor._so) {
                 tensor._so = m_request_without_batch._so;
             }
-            set_tensor(output, tensor);
+            ov::IAsyncInferRequest::set_tensor(output, tensor);
         }
+    }
+    if (m_sync_request && m_sync_request->get_batch_size() == 0) {
+        // batch not applicable, just a wrapper to hardware infer request
         struct RequestExecutor : ov::threading::ITaskExecutor {
             explicit RequestExecutor(const ov::SoPtr<ov::IAsyncInferRequest>& infer_request)
                 : m_inferrequest(infer_request) {
@@ -61,14 +63,35 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
         struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
             explicit ThisRequestExecutor(AsyncInferRequest* _this_) : _this{_this_} {}
             void run(ov::threading::Task task) override {
+                if (_this->m_sync_request->is_bucketing()) {
+                    std::pair<AsyncInferRequest*, ov::threading::Task> t{_this, std::move(task)};
+                    auto compiled_model =
+                        std::static_pointer_cast<const CompiledModel>(_this->m_sync_request->get_compiled_model());
+                    if (compiled_model->enqueue_to_bucket(t))
+                        return;
+                    // no sequence length bucket fits the inputs, execute the request alone
+                    task = std::move(t.second);
+                    auto sync_request = _this->m_sync_request;
+                    sync_request->m_batched_request_status = SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                    sync_request->set_tensors_to_another_request(_this->m_request_without_batch);
+                    _this->m_request_without_batch->set_callback([sync_request, task](std::exception_ptr p) {
+                        if (p)
+                            sync_request->m_exception_ptr = p;
+                        task();
+                    });
+                    _this->m_request_without_batch->start_async();
+                    return;
+                }
                 auto workerInferRequest = _this->m_sync_request->m_batched_request_wrapper;
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                workerInferRequest->_policy.on_arrival(BatchingPolicy::Clock::now());
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-                if (sz == workerInferRequest->_batch_size) {
+                // the adaptive batch collection counts the waiting time from the first request of the batch
+                if (sz == workerInferRequest->_batch_size || (sz == 1 && workerInferRequest->_policy.is_enabled())) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
                 }
@@ -95,6 +118,9 @@ void AsyncInferRequest::set_tensor(const ov::Output<const ov::Node>& port, const
     check_state();
     if (m_sync_request && m_sync_request->get_batch_size() == 0) {
         m_request_without_batch->set_tensor(port, tensor);
+    } else if (m_sync_request && m_sync_request->is_bucketing()) {
+        m_request_without_batch->set_tensor(port, tensor);
+        m_sync_request->mark_user_output(port);
     }
     ov::IAsyncInferRequest::set_tensor(port, tensor);
 }
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batching_policy.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace autobatch_plugin {
+
+namespace {
+// the moving averages follow the last few samples to react on the load bursts
+inline void update_average(BatchingPolicy::Clock::duration& average, BatchingPolicy::Clock::duration sample) {
+    average = average == BatchingPolicy::Clock::duration::zero() ? sample : average + (sample - average) / 4;
+}
+}  // namespace
+
+void BatchingPolicy::set_latency_slo(std::chrono::milliseconds slo) {
+    m_latency_slo = slo.count();
+}
+
+std::chrono::milliseconds BatchingPolicy::get_latency_slo() const {
+    return std::chrono::milliseconds(m_latency_slo.load());
+}
+
+bool BatchingPolicy::is_enabled() const {
+    return m_latency_slo.load() > 0;
+}
+
+void BatchingPolicy::on_arrival(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_last_arrival != Clock::time_point{}) {
+        update_average(m_arrival_interval, std::max(now - m_last_arrival, Clock::duration{1}));
+    }
+    m_last_arrival = now;
+    if (m_pending++ == 0) {
+        m_first_arrival = now;
+    }
+}
+
+void BatchingPolicy::on_collected(int num, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending = std::max(m_pending - num, 0);
+    // the requests arrived while collecting the batch start the next one
+    if (m_pending) {
+        m_first_arrival = now;
+    }
+}
+
+void BatchingPolicy::on_batched_executed(Clock::duration time) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    update_average(m_batched_time, std::max(time, Clock::duration{1}));
+}
+
+void BatchingPolicy::on_single_executed(int num, Clock::duration time) {
+    if (num <= 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    update_average(m_single_time, std::max(time / num, Clock::duration{1}));
+}
+
+BatchingPolicy::Clock::duration BatchingPolicy::get_wait_time(int batch_size,
+                                                              int collected,
+                                                              std::chrono::milliseconds timeout,
+                                                              Clock::time_point now) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (collected <= 0 || m_pending == 0) {
+        return timeout;
+    }
+    const auto waited = now - m_first_arrival;
+    auto budget = Clock::duration(timeout) - waited;
+    // the batch executed after the wait still has to fit into the target
+    budget = std::min(budget, Clock::duration(get_latency_slo()) - waited - m_batched_time);
+    if (budget <= Clock::duration::zero()) {
+        return Clock::duration::zero();
+    }
+    if (m_arrival_interval == Clock::duration::zero()) {
+        return budget;
+    }
+    const auto fill_time = m_arrival_interval * std::max(batch_size - collected, 0);
+    if (fill_time > budget) {
+        return Clock::duration::zero();
+    }
+    // the worker is woken up when the batch is full, so the margin only bounds the wait when the arrivals slow down
+    return std::min(budget, 2 * fill_time);
+}
+
+int BatchingPolicy::get_effective_batch_size(int batch_size) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_single_time == Clock::duration::zero()) {
+        return batch_size;
+    }
+    if (m_batched_time == Clock::duration::zero()) {
+        // no batched execution yet, try it with the half-filled batch
+        return (batch_size + 1) / 2;
+    }
+    const auto size = (m_batched_time + m_single_time - Clock::duration{1}) / m_single_time;
+    return static_cast<int>(std::min<Clock::duration::rep>(std::max<Clock::duration::rep>(size, 1), batch_size));
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Online tuning of the batch collection of a worker request.
+ *
+ * Tracks the requests arrival interval, the execution time of the batched request and the per-request execution time of
+ * the batch1 requests (executed concurrently). With the latency target set, the worker waits for the batch only while
+ * the missing requests are expected to arrive within the target and the timeout, and a partially collected batch is
+ * executed with the batched request when this is cheaper than the batch1 requests. The partial batch executes the full
+ * compiled batch, so the policy only changes the scheduling and saves no compute.
+ */
+class BatchingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void set_latency_slo(std::chrono::milliseconds slo);
+
+    std::chrono::milliseconds get_latency_slo() const;
+
+    // the adaptive batch collection is enabled with the non-zero latency target
+    bool is_enabled() const;
+
+    void on_arrival(Clock::time_point now);
+
+    void on_collected(int num, Clock::time_point now);
+
+    void on_batched_executed(Clock::duration time);
+
+    void on_single_executed(int num, Clock::duration time);
+
+    /**
+     * @brief Returns the time to wait for the rest of the batch
+     * @param batch_size the batch size of the batched request
+     * @param collected number of the requests collected by the moment
+     * @param timeout the auto-batching timeout
+     * @param now current time
+     */
+    Clock::duration get_wait_time(int batch_size,
+                                  int collected,
+                                  std::chrono::milliseconds timeout,
+                                  Clock::time_point now) const;
+
+    // the smallest number of the collected requests executed with the batched request
+    int get_effective_batch_size(int batch_size) const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::atomic<std::chrono::milliseconds::rep> m_latency_slo = {0};
+    int m_pending = 0;
+    Clock::time_point m_first_arrival;
+    Clock::time_point m_last_arrival;
+    // exponential moving averages, zero until the first sample
+    Clock::duration m_arrival_interval = Clock::duration::zero();
+    Clock::duration m_batched_time = Clock::duration::zero();
+    Clock::duration m_single_time = Clock::duration::zero();
+};
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
@@ -17,7 +19,8 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::vector<std::pair<size_t, ov::SoPtr<ov::ICompiledModel>>>& bucket_models)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
@@ -29,6 +32,11 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_slo = config.find(ov::auto_batch_latency_slo.name());
+    if (latency_slo != config.end())
+        m_latency_slo = latency_slo->second.as<std::uint32_t>();
+    for (const auto& bucket_model : bucket_models)
+        m_buckets.push_back({bucket_model.first, bucket_model.second, nullptr});
 }
 
 CompiledModel::~CompiledModel() {
@@ -40,6 +48,16 @@ CompiledModel::~CompiledModel() {
 }
 
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
+    if (!m_buckets.empty()) {
+        // the slot in the batch is assigned by the worker when the request is collected into the batch
+        auto sync_request = std::make_shared<ov::autobatch_plugin::SyncInferRequest>(
+            std::dynamic_pointer_cast<const ov::autobatch_plugin::CompiledModel>(shared_from_this()),
+            nullptr,
+            0,
+            m_device_info.device_batch_size);
+        sync_request->set_bucketing(GetBucketWorkerInferRequest());
+        return sync_request;
+    }
     auto workerRequestPtrAndId = GetWorkerInferRequest();
     auto async_infer_request = std::make_shared<ov::autobatch_plugin::SyncInferRequest>(
         std::dynamic_pointer_cast<const ov::autobatch_plugin::CompiledModel>(shared_from_this()),
@@ -51,100 +69,242 @@ std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request(
     return async_infer_request;
 }
 
+std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest> CompiledModel::create_worker_request(
+    const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+    size_t seq_len) const {
+    auto worker_request = std::make_shared<WorkerInferRequest>();
+    auto workerRequestPtr = worker_request.get();
+    workerRequestPtr->_infer_request_batched._ptr = compiled_model->create_infer_request();
+    if (workerRequestPtr->_infer_request_batched._so == nullptr)
+        workerRequestPtr->_infer_request_batched._so = compiled_model._so;
+    workerRequestPtr->_batch_size = m_device_info.device_batch_size;
+    workerRequestPtr->_seq_len = seq_len;
+    workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
+    workerRequestPtr->_slot_owners.resize(workerRequestPtr->_batch_size, nullptr);
+    workerRequestPtr->_is_wakeup = false;
+    workerRequestPtr->_policy.set_latency_slo(std::chrono::milliseconds(m_latency_slo));
+    workerRequestPtr->_infer_request_batched->set_callback(
+        [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
+            if (exceptionPtr)
+                workerRequestPtr->_exception_ptr = exceptionPtr;
+            workerRequestPtr->_policy.on_batched_executed(BatchingPolicy::Clock::now() -
+                                                          workerRequestPtr->_batched_start);
+            OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
+            // notify the individual requests on the completion (a partial batch leaves the rest of tasks empty)
+            for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
+                if (workerRequestPtr->_completion_tasks[c]) {
+                    auto task = std::move(workerRequestPtr->_completion_tasks[c]);
+                    workerRequestPtr->_completion_tasks[c] = nullptr;
+                    task();
+                }
+            }
+            // the worker fills the completion tasks of the next batch only after they all are taken
+            workerRequestPtr->_batched_in_flight = false;
+            // reset the timeout
+            workerRequestPtr->_is_wakeup = true;
+            workerRequestPtr->_cond.notify_one();
+        });
+
+    workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+        auto& policy = workerRequestPtr->_policy;
+        while (1) {
+            std::cv_status status;
+            {
+                std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
+                BatchingPolicy::Clock::duration wait_time = std::chrono::milliseconds(m_time_out);
+                if (policy.is_enabled())
+                    wait_time = policy.get_wait_time(workerRequestPtr->_batch_size,
+                                                     static_cast<int>(workerRequestPtr->_tasks.size()),
+                                                     std::chrono::milliseconds(m_time_out),
+                                                     BatchingPolicy::Clock::now());
+                status = workerRequestPtr->_cond.wait_for(lock, wait_time);
+                if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
+                    continue;
+                workerRequestPtr->_is_wakeup = false;
+            }
+            if (m_terminate) {
+                break;
+            } else {
+                // as we pop the tasks from the queue only here
+                // it is ok to call size() (as the _tasks can only grow in parallel)
+                const int queued = static_cast<int>(workerRequestPtr->_tasks.size());
+                // the queue of a bucket is shared by all its requests, so it may hold more than a batch
+                const int sz = std::min(queued, workerRequestPtr->_batch_size);
+                // with the adaptive batch collection the partially collected batch may be cheaper to execute
+                // with the batched request than the batch1 requests, though it still executes the full compiled batch
+                // (the slots of the missing requests are computed and thrown away), so it only changes the scheduling
+                const bool partial_batch = (status == std::cv_status::timeout) && sz && policy.is_enabled() &&
+                                           sz >= policy.get_effective_batch_size(workerRequestPtr->_batch_size);
+                if ((sz == workerRequestPtr->_batch_size || partial_batch) &&
+                    !workerRequestPtr->_batched_in_flight) {
+                    std::vector<std::shared_ptr<SyncInferRequest>> batch(sz);
+                    std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                    for (int n = 0; n < sz; n++) {
+                        OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        workerRequestPtr->_completion_tasks[n] = std::move(t.second);
+                        batch[n] = t.first->m_sync_request;
+                    }
+                    // the requests of a bucket come from the shared queue, so their slots are assigned per batch
+                    if (workerRequestPtr->_seq_len)
+                        assign_bucket_slots(*workerRequestPtr, batch);
+                    detach_idle_slots(*workerRequestPtr, batch);
+                    for (const auto& request : batch) {
+                        request->copy_inputs_if_needed();
+                        request->m_batched_request_status =
+                            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                        if (workerRequestPtr->_seq_len)
+                            workerRequestPtr->_executed_tokens += request->get_seq_len();
+                    }
+                    if (workerRequestPtr->_seq_len)
+                        workerRequestPtr->_executed_batches++;
+                    policy.on_collected(sz, BatchingPolicy::Clock::now());
+                    workerRequestPtr->_batched_start = BatchingPolicy::Clock::now();
+                    workerRequestPtr->_batched_in_flight = true;
+                    workerRequestPtr->_infer_request_batched->start_async();
+                } else if ((status == std::cv_status::timeout) && queued) {
+                    // timeout to collect the batch is over, have to execute the requests in the batch1 mode
+                    std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                    // popping all tasks collected by the moment of the time-out and execute each with batch1
+                    std::atomic<int> arrived = {0};
+                    std::promise<void> all_completed;
+                    auto all_completed_future = all_completed.get_future();
+                    const auto start = BatchingPolicy::Clock::now();
+                    policy.on_collected(queued, start);
+                    for (int n = 0; n < queued; n++) {
+                        OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        t.first->m_request_without_batch->set_callback(
+                            [t, queued, &arrived, &all_completed](std::exception_ptr p) {
+                                if (p)
+                                    t.first->m_sync_request->m_exception_ptr = p;
+                                t.second();
+                                if (queued == ++arrived) {
+                                    all_completed.set_value();
+                                }
+                            });
+                        t.first->m_sync_request->m_batched_request_status =
+                            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                        t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+                        t.first->m_request_without_batch->start_async();
+                    }
+                    all_completed_future.get();
+                    policy.on_single_executed(queued, BatchingPolicy::Clock::now() - start);
+                    // now when all the tasks for this batch are completed, start waiting for the timeout again
+                }
+            }
+        }
+    });
+    return worker_request;
+}
+
 std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int>
 CompiledModel::GetWorkerInferRequest() const {
     auto num = m_num_requests_created++;
     std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
     auto batch_id = num % m_device_info.device_batch_size;
     if (!batch_id) {  // need new request
-        m_worker_requests.push_back(std::make_shared<WorkerInferRequest>());
-        auto workerRequestPtr = m_worker_requests.back().get();
-        workerRequestPtr->_infer_request_batched._ptr = m_compiled_model_with_batch->create_infer_request();
-        if (workerRequestPtr->_infer_request_batched._so == nullptr)
-            workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
-        workerRequestPtr->_batch_size = m_device_info.device_batch_size;
-        workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
-        workerRequestPtr->_is_wakeup = false;
-        workerRequestPtr->_infer_request_batched->set_callback(
-            [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
-                if (exceptionPtr)
-                    workerRequestPtr->_exception_ptr = exceptionPtr;
-                OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
-                // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
-                    workerRequestPtr->_completion_tasks[c]();
-                }
-                // reset the timeout
-                workerRequestPtr->_is_wakeup = true;
-                workerRequestPtr->_cond.notify_one();
-            });
-
-        workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
-            while (1) {
-                std::cv_status status;
-                {
-                    std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
-                    if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
-                        continue;
-                    workerRequestPtr->_is_wakeup = false;
-                }
-                if (m_terminate) {
-                    break;
-                } else {
-                    // as we pop the tasks from the queue only here
-                    // it is ok to call size() (as the _tasks can only grow in parallel)
-                    const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
-                    if (sz == workerRequestPtr->_batch_size) {
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
-                        }
-                        workerRequestPtr->_infer_request_batched->start_async();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
-                                    }
-                                });
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
-                            t.first->m_request_without_batch->start_async();
-                        }
-                        all_completed_future.get();
-                        // now when all the tasks for this batch are completed, start waiting for the timeout again
-                    }
-                }
-            }
-        });
+        m_worker_requests.push_back(create_worker_request(m_compiled_model_with_batch, 0));
     }
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest> CompiledModel::GetBucketWorkerInferRequest()
+    const {
+    std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+    if (!m_buckets.front().worker_request) {
+        for (auto& bucket : m_buckets) {
+            bucket.worker_request = create_worker_request(bucket.compiled_model, bucket.seq_len);
+            m_worker_requests.push_back(bucket.worker_request);
+        }
+    }
+    return m_buckets.front().worker_request;
+}
+
+void CompiledModel::assign_bucket_slots(WorkerInferRequest& worker_request,
+                                        const std::vector<std::shared_ptr<SyncInferRequest>>& batch) {
+    std::lock_guard<std::mutex> lock(worker_request._slots_mutex);
+    auto& owners = worker_request._slot_owners;
+    std::vector<bool> taken(owners.size(), false);
+    std::vector<SyncInferRequest*> newcomers;
+    // the request keeps its slot of the previous batch, so its outputs stay in place
+    for (const auto& request : batch) {
+        const auto slot = request->get_batch_id();
+        if (slot < owners.size() && owners[slot] == request.get())
+            taken[slot] = true;
+        else
+            newcomers.push_back(request.get());
+    }
+    // the rest take the free slots first, then the slots of the requests missing in the batch, the outputs of the
+    // latter are copied out of the slot as they are overwritten by the batch
+    for (auto* request : newcomers) {
+        size_t slot = owners.size();
+        for (size_t candidate = 0; candidate < owners.size(); candidate++) {
+            if (taken[candidate])
+                continue;
+            if (!owners[candidate]) {
+                slot = candidate;
+                break;
+            }
+            if (slot == owners.size())
+                slot = candidate;
+        }
+        OPENVINO_ASSERT(slot < owners.size(), "No slot is left for the request in the batch!");
+        if (owners[slot])
+            owners[slot]->detach_outputs();
+        owners[slot] = request;
+        taken[slot] = true;
+        request->set_batch_id(slot);
+    }
+}
+
+void CompiledModel::detach_idle_slots(WorkerInferRequest& worker_request,
+                                      const std::vector<std::shared_ptr<SyncInferRequest>>& batch) {
+    std::lock_guard<std::mutex> lock(worker_request._slots_mutex);
+    auto& owners = worker_request._slot_owners;
+    std::vector<bool> taken(owners.size(), false);
+    // with the bucketing the views follow the slot and the sequence length of the request
+    for (const auto& request : batch) {
+        taken[request->get_batch_id()] = true;
+        request->attach_outputs();
+    }
+    // a full batch leaves the outputs zero-copy
+    for (size_t slot = 0; slot < owners.size(); slot++) {
+        if (!taken[slot] && owners[slot])
+            owners[slot]->detach_outputs();
+    }
+}
+
+bool CompiledModel::enqueue_to_bucket(
+    std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>& task) const {
+    auto& sync_request = task.first->m_sync_request;
+    size_t seq_len = 0;
+    if (!sync_request->get_inputs_seq_len(seq_len))
+        return false;
+    std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+    auto bucket = std::find_if(m_buckets.begin(), m_buckets.end(), [seq_len](const Bucket& candidate) {
+        return candidate.seq_len >= seq_len;
+    });
+    if (bucket == m_buckets.end())
+        return false;
+    const auto& worker_request = bucket->worker_request;
+    sync_request->set_bucket_worker(worker_request, seq_len);
+    worker_request->_policy.on_arrival(BatchingPolicy::Clock::now());
+    worker_request->_tasks.push(std::move(task));
+    const int sz = static_cast<int>(worker_request->_tasks.size());
+    // the adaptive batch collection counts the waiting time from the first request of the batch
+    if (sz == worker_request->_batch_size || (sz == 1 && worker_request->_policy.is_enabled())) {
+        worker_request->_is_wakeup = true;
+        worker_request->_cond.notify_one();
+    }
+    return true;
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
         m_compiled_model_without_batch._so};
     // simpler wrapper if m_compiled_model_with_batch is empty
     std::shared_ptr<ov::ISyncInferRequest> sync_res;
-    if (m_compiled_model_with_batch)
+    if (m_compiled_model_with_batch || !m_buckets.empty())
         sync_res = create_sync_infer_request();
     else
         sync_res = std::make_shared<ov::autobatch_plugin::SyncInferRequest>(
@@ -170,11 +330,20 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_slo.name()) {
+            m_latency_slo = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch_latency_slo.name()] = property.second.as<std::uint32_t>();
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& worker : m_worker_requests) {
+                worker->_policy.set_latency_slo(std::chrono::milliseconds(m_latency_slo));
+            }
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_latency_slo.name());
         }
     }
 }
@@ -212,10 +381,34 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_seq_len_buckets.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_buckets_utilization.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_slo) {
+            uint32_t latency_slo = m_latency_slo;
+            return latency_slo;
+        } else if (name == ov::auto_batch_seq_len_buckets) {
+            std::vector<uint32_t> seq_lens;
+            for (const auto& bucket : m_buckets)
+                seq_lens.push_back(static_cast<uint32_t>(bucket.seq_len));
+            return decltype(ov::auto_batch_seq_len_buckets)::value_type(std::move(seq_lens));
+        } else if (name == ov::auto_batch_buckets_utilization) {
+            std::vector<float> utilization;
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& bucket : m_buckets) {
+                size_t batches = 0, tokens = 0;
+                if (bucket.worker_request) {
+                    batches = bucket.worker_request->_executed_batches;
+                    tokens = bucket.worker_request->_executed_tokens;
+                }
+                const auto slots = batches * m_device_info.device_batch_size * bucket.seq_len;
+                utilization.push_back(slots ? static_cast<float>(tokens) / slots : 0.f);
+            }
+            return decltype(ov::auto_batch_buckets_utilization)::value_type(std::move(utilization));
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -8,6 +8,7 @@
 #include <condition_variable>
 #include <thread>
 
+#include "batching_policy.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -17,6 +18,7 @@ namespace ov {
 namespace autobatch_plugin {
 
 class AsyncInferRequest;
+class SyncInferRequest;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
@@ -31,6 +33,19 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        BatchingPolicy _policy;
+        BatchingPolicy::Clock::time_point _batched_start;
+        // the rest of the requests may arrive while a partial batch is executed
+        std::atomic_bool _batched_in_flight = {false};
+        // sequence length of the bucket, 0 without the bucketing
+        size_t _seq_len = 0;
+        // the requests whose outputs are the views of the slots of the batched request (zero-copy), nullptr for the
+        // free slots, the requests of a bucket keep the slot of the previous batch while it is not taken by another one,
+        // the outputs of the idle requests are copied out before a partial batch overwrites their slots
+        std::vector<SyncInferRequest*> _slot_owners;
+        std::mutex _slots_mutex;
+        std::atomic_size_t _executed_batches = {0};
+        std::atomic_size_t _executed_tokens = {0};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +56,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::vector<std::pair<size_t, ov::SoPtr<ov::ICompiledModel>>>& bucket_models = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -59,6 +75,10 @@ public:
 
     const std::vector<ov::Output<const ov::Node>>& inputs() const override;
 
+    // queues the request to the worker of the smallest sequence length bucket fitting its inputs, all the requests of a
+    // bucket share its worker; false when no bucket fits
+    bool enqueue_to_bucket(std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>& task) const;
+
 protected:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     static unsigned int ParseTimeoutValue(const std::string&);
@@ -68,17 +88,39 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // creates the worker requests of the buckets with the first infer request, returns the worker of the smallest bucket
+    std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest> GetBucketWorkerInferRequest() const;
+    std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest> create_worker_request(
+        const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+        size_t seq_len) const;
+    // the requests of the batch keep their slots of the previous batch, the rest take the free slots or the slots
+    // of the requests missing in the batch
+    static void assign_bucket_slots(WorkerInferRequest& worker_request,
+                                    const std::vector<std::shared_ptr<SyncInferRequest>>& batch);
+    // the outputs of the requests missing in the partial batch are copied out of their slots, the collected requests
+    // get back the views of their slots
+    static void detach_idle_slots(WorkerInferRequest& worker_request,
+                                  const std::vector<std::shared_ptr<SyncInferRequest>>& batch);
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_latency_slo = {0};  // in ms, 0 disables the adaptive batch collection
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+
+    struct Bucket {
+        size_t seq_len;
+        ov::SoPtr<ov::ICompiledModel> compiled_model;
+        std::shared_ptr<WorkerInferRequest> worker_request;  // guarded by m_worker_requests_mutex
+    };
+    // sequence length buckets of the dynamic model in the ascending order
+    mutable std::vector<Bucket> m_buckets;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -22,6 +22,8 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_seq_len_buckets.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -31,6 +33,80 @@ inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_con
     return config;
 }
 
+// compiles the batched model for every sequence length bucket, returns nothing when the model does not fit the bucketing
+inline std::vector<std::pair<size_t, ov::SoPtr<ov::ICompiledModel>>> compile_seq_len_buckets(
+    const std::shared_ptr<ov::ICore>& core,
+    const std::shared_ptr<const ov::Model>& model,
+    std::vector<uint32_t> seq_lens,
+    uint32_t batch_size,
+    const std::string& device_name,
+    const ov::AnyMap& device_config,
+    const ov::SoPtr<ov::IRemoteContext>& context,
+    std::set<std::size_t>& batched_inputs,
+    std::set<std::size_t>& batched_outputs) {
+    // the inputs/outputs are batched by the 0th dim, the dynamic 1st dim (if any) is the sequence length
+    auto is_batched = [](const ov::PartialShape& shape) {
+        if (shape.rank().is_dynamic() || shape.size() == 0 || !(shape[0].is_dynamic() || shape[0] == 1))
+            return false;
+        for (size_t s = 2; s < shape.size(); s++)
+            if (shape[s].is_dynamic())
+                return false;
+        return true;
+    };
+    auto has_seq_len = [](const ov::PartialShape& shape) {
+        return shape.size() > 1 && shape[1].is_dynamic();
+    };
+    const auto& params = model->get_parameters();
+    const auto& results = model->get_results();
+    bool has_seq_len_input = false;
+    for (const auto& param : params) {
+        if (!is_batched(param->get_partial_shape()))
+            return {};
+        has_seq_len_input |= has_seq_len(param->get_partial_shape());
+    }
+    for (const auto& result : results) {
+        if (!is_batched(result->get_output_partial_shape(0)))
+            return {};
+    }
+    if (!has_seq_len_input)
+        return {};
+
+    std::sort(seq_lens.begin(), seq_lens.end());
+    seq_lens.erase(std::unique(seq_lens.begin(), seq_lens.end()), seq_lens.end());
+    std::vector<std::pair<size_t, ov::SoPtr<ov::ICompiledModel>>> buckets;
+    for (const auto seq_len : seq_lens) {
+        if (!seq_len)
+            continue;
+        auto reshaped = model->clone();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < params.size(); input_id++) {
+            auto input_shape = params[input_id]->get_partial_shape();
+            if (has_seq_len(input_shape))
+                input_shape[1] = seq_len;
+            input_shape[0] = batch_size;
+            partial_shapes.insert({input_id, input_shape});
+        }
+        reshaped->reshape(partial_shapes);
+        for (size_t output_id = 0; output_id < results.size(); output_id++) {
+            const auto& shape = reshaped->output(output_id).get_partial_shape();
+            // the padded tail of the sequence outputs is cut back, so they have to follow the inputs length
+            if (shape.is_dynamic() || shape[0] != batch_size ||
+                (has_seq_len(results[output_id]->get_output_partial_shape(0)) && shape[1] != seq_len))
+                return {};
+        }
+        buckets.emplace_back(seq_len,
+                             context ? core->compile_model(reshaped, context, device_config)
+                                     : core->compile_model(reshaped, device_name, device_config));
+    }
+    batched_inputs.clear();
+    batched_outputs.clear();
+    for (size_t input_id = 0; input_id < params.size(); input_id++)
+        batched_inputs.insert(input_id);
+    for (size_t output_id = 0; output_id < results.size(); output_id++)
+        batched_outputs.insert(output_id);
+    return buckets;
+}
+
 DeviceInformation Plugin::parse_batch_device(const std::string& device_with_batch) {
     auto openingBracket = device_with_batch.find_first_of('(');
     auto closingBracket = device_with_batch.find_first_of(')', openingBracket);
@@ -118,6 +194,8 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_slo(0));  // default value (ms), the adaptive batching is off
+    m_plugin_config.insert(ov::auto_batch_seq_len_buckets(std::vector<uint32_t>{}));  // no bucketing by default
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -150,6 +228,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
 
     std::set<std::size_t> batched_inputs;
     std::set<std::size_t> batched_outputs;
+    const auto explicit_batch_size = meta_device.device_batch_size;
     // check that the auto-batching is applicable in general
     try {
         // if applicable, the Auto-Batching is implicitly enabled via the performance hints
@@ -213,6 +292,27 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         meta_device.device_batch_size = 1;
     }
 
+    // the dynamic models are batched with the explicit batch size by the sequence length buckets
+    std::vector<std::pair<size_t, ov::SoPtr<ov::ICompiledModel>>> bucket_models;
+    const auto seq_len_buckets = full_properties.find(ov::auto_batch_seq_len_buckets.name());
+    if (seq_len_buckets != full_properties.end() && explicit_batch_size > 1 && model->is_dynamic()) {
+        try {
+            bucket_models = compile_seq_len_buckets(core,
+                                                    model,
+                                                    seq_len_buckets->second.as<std::vector<uint32_t>>(),
+                                                    explicit_batch_size,
+                                                    device_name,
+                                                    device_config_no_auto_batch,
+                                                    context,
+                                                    batched_inputs,
+                                                    batched_outputs);
+        } catch (const ov::Exception&) {
+            bucket_models.clear();
+        }
+        if (!bucket_models.empty())
+            meta_device.device_batch_size = explicit_batch_size;
+    }
+
     if (!meta_device.device_batch_size) {
         // batch size is not set explicitly via device name e.g. BATCH:GPU(4)
         // let's query the optimal batch size
@@ -253,7 +353,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                                 : core->compile_model(model, device_name, device_config_no_auto_batch);
     if (device_name.find("GPU") != std::string::npos) {
         batch1_footprint = report_footprint(core, device_name) - batch1_footprint;
-        if (batch1_footprint) {
+        if (batch1_footprint && bucket_models.empty()) {
             const auto total_mem = core->get_property(device_name, ov::intel_gpu::device_total_mem_size);
             const int estimated_batch = static_cast<int>((total_mem - batch1_footprint) / batch1_footprint);
             int closest = static_cast<int>(pow(2, floor(std::log(estimated_batch) / std::log(2))));
@@ -270,7 +370,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     }
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
     auto reshaped = model->clone();
-    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
+    if (meta_device.device_batch_size > 1 && batched_inputs.size() && bucket_models.empty()) {
         try {
             auto inputs = reshaped->inputs();
             std::map<std::size_t, ov::PartialShape> partial_shapes;
@@ -311,7 +411,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           bucket_models);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -30,6 +30,83 @@ inline ov::SoPtr<ov::ITensor> create_shared_tensor_on_batched_tensor(ov::SoPtr<o
     }
 }
 
+// the output of the request in its slot of the batched request, the tensor handed out to the user keeps a copy of the
+// data once the slot is taken by another request of the bucket or computed by a partial batch without the request
+class SlotTensor : public ov::ITensor {
+public:
+    explicit SlotTensor(const ov::SoPtr<ov::ITensor>& view) : m_element_type(view->get_element_type()) {
+        attach(view);
+    }
+
+    void attach(const ov::SoPtr<ov::ITensor>& view) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_view = view;
+        m_current = m_view._ptr;
+    }
+
+    void attach() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_current = m_view._ptr;
+    }
+
+    void detach() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_current != m_view._ptr)
+            return;
+        if (!m_own)
+            m_own = ov::make_tensor(m_element_type, m_view->get_shape());
+        else
+            m_own->set_shape(m_view->get_shape());
+        m_view->copy_to(m_own);
+        m_current = m_own;
+    }
+
+    void set_shape(ov::Shape shape) override {
+        current()->set_shape(std::move(shape));
+    }
+
+    const ov::element::Type& get_element_type() const override {
+        return m_element_type;
+    }
+
+    const ov::Shape& get_shape() const override {
+        return current()->get_shape();
+    }
+
+    const ov::Strides& get_strides() const override {
+        return current()->get_strides();
+    }
+
+    void* data() override {
+        return current()->data();
+    }
+
+    const void* data() const override {
+        return current()->data();
+    }
+
+    void* data(const ov::element::Type& type) override {
+        return current()->data(type);
+    }
+
+    const void* data(const ov::element::Type& type) const override {
+        return current()->data(type);
+    }
+
+private:
+    // the view and the own tensor live as long as this one, so the references to their shape stay valid
+    std::shared_ptr<ov::ITensor> current() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_current;
+    }
+
+    const ov::element::Type m_element_type;
+    mutable std::mutex m_mutex;
+    ov::SoPtr<ov::ITensor> m_view;
+    std::shared_ptr<ov::ITensor> m_own;
+    std::shared_ptr<ov::ITensor> m_current;
+};
+
 SyncInferRequest::SyncInferRequest(
     const std::shared_ptr<const ov::autobatch_plugin::CompiledModel>& compiled_model,
     const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request,
@@ -41,14 +118,122 @@ SyncInferRequest::SyncInferRequest(
       m_batched_request_wrapper(worker_request),
       m_batch_id(batch_id),
       m_batch_size(num_batch) {
-    if (m_batched_request_wrapper)
+    if (m_batched_request_wrapper) {
         share_tensors_with_batched_req(batched_inputs, batched_outputs);
+        // a partially collected batch computes the slots of the missing requests as well, so the worker copies the
+        // outputs of the idle owners out of their slots before
+        std::lock_guard<std::mutex> lock(m_batched_request_wrapper->_slots_mutex);
+        m_batched_request_wrapper->_slot_owners[m_batch_id] = this;
+    }
+}
+
+SyncInferRequest::~SyncInferRequest() {
+    // the outputs handed out to the user may outlive the request
+    release_slot();
 }
 
 size_t SyncInferRequest::get_batch_size() const {
     return m_batch_size;
 }
 
+void SyncInferRequest::set_bucketing(
+    const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request) {
+    m_bucketing = true;
+    m_batched_request_wrapper = worker_request;
+}
+
+bool SyncInferRequest::is_bucketing() const {
+    return m_bucketing;
+}
+
+size_t SyncInferRequest::get_seq_len() const {
+    return m_seq_len;
+}
+
+bool SyncInferRequest::get_inputs_seq_len(size_t& seq_len) const {
+    seq_len = 0;
+    for (const auto& input : get_inputs()) {
+        const auto& port_shape = input.get_partial_shape();
+        const auto shape = get_tensor(input)->get_shape();
+        if (shape.empty() || shape[0] != 1)
+            return false;
+        if (port_shape.size() > 1 && port_shape[1].is_dynamic()) {
+            // all the sequence inputs are padded to the same length
+            if (seq_len && seq_len != shape[1])
+                return false;
+            seq_len = shape[1];
+        }
+    }
+    return true;
+}
+
+void SyncInferRequest::set_bucket_worker(
+    const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request,
+    size_t seq_len) {
+    if (m_batched_request_wrapper != worker_request) {
+        release_slot();
+        m_batched_request_wrapper = worker_request;
+    }
+    m_seq_len = seq_len;
+}
+
+void SyncInferRequest::set_batch_id(size_t batch_id) {
+    m_batch_id = batch_id;
+}
+
+size_t SyncInferRequest::get_batch_id() const {
+    return m_batch_id;
+}
+
+void SyncInferRequest::mark_user_output(const ov::Output<const ov::Node>& port) {
+    auto found_port = find_port(port);
+    if (found_port.found() && found_port.is_output())
+        m_user_outputs.insert(found_port.idx);
+}
+
+void SyncInferRequest::release_slot() {
+    if (!m_batched_request_wrapper)
+        return;
+    std::lock_guard<std::mutex> lock(m_batched_request_wrapper->_slots_mutex);
+    auto& owners = m_batched_request_wrapper->_slot_owners;
+    if (m_batch_id < owners.size() && owners[m_batch_id] == this) {
+        owners[m_batch_id] = nullptr;
+        detach_outputs();
+    }
+}
+
+void SyncInferRequest::attach_outputs() {
+    if (!is_bucketing()) {
+        // the slot of the request is fixed
+        for (const auto& slot_output : m_slot_outputs)
+            slot_output->attach();
+        return;
+    }
+    const auto& outputs = get_outputs();
+    m_slot_outputs.resize(outputs.size());
+    for (size_t output_id = 0; output_id < outputs.size(); output_id++) {
+        if (m_user_outputs.count(output_id))
+            continue;
+        const auto& output = outputs[output_id];
+        auto view = get_slot_output(output);
+        auto& slot_output = m_slot_outputs[output_id];
+        if (slot_output)
+            slot_output->attach(view);
+        else
+            slot_output = std::make_shared<SlotTensor>(view);
+        // this request is already in BUSY state, so using the internal functions safely
+        if (get_tensor(output)._ptr != slot_output)
+            set_tensor(output, {slot_output, view._so});
+    }
+}
+
+void SyncInferRequest::detach_outputs() {
+    for (const auto& slot_output : m_slot_outputs) {
+        if (slot_output)
+            slot_output->detach();
+    }
+}
+
 void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                                       const std::set<std::size_t>& batched_outputs) {
     const auto inputs = get_inputs();
@@ -75,11 +260,26 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t
                                                      batched_outputs,
                                                      m_batch_id,
                                                      m_batch_size);
-        set_tensor(output, res);
+        m_slot_outputs.push_back(std::make_shared<SlotTensor>(res));
+        set_tensor(output, {m_slot_outputs.back(), res._so});
     }
 }
 
 void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req) {
+    if (is_bucketing()) {
+        // the tensors are shared with the request, except the outputs replaced with the views of the slot
+        release_slot();
+        const auto& outputs = get_outputs();
+        for (size_t output_id = 0; output_id < outputs.size(); output_id++) {
+            if (m_user_outputs.count(output_id))
+                continue;
+            auto tensor = req->get_tensor(outputs[output_id]);
+            if (!tensor._so)
+                tensor._so = req._so;
+            set_tensor(outputs[output_id], tensor);
+        }
+        return;
+    }
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto tensor = get_tensor(it);
@@ -105,6 +305,10 @@ void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferR
 }
 
 void SyncInferRequest::copy_inputs_if_needed() {
+    if (is_bucketing()) {
+        copy_inputs_with_padding();
+        return;
+    }
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
@@ -134,7 +338,55 @@ void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
     }
 }
 
+void SyncInferRequest::copy_inputs_with_padding() {
+    for (const auto& it : get_inputs()) {
+        // the [1, seq_len, ...] input is the prefix of its [1, bucket_seq_len, ...] slot in the batched tensor
+        auto src = get_tensor(it);
+        auto dst = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
+        const auto slot_size = dst->get_byte_size() / m_batch_size;
+        const auto src_size = src->get_byte_size();
+        OPENVINO_ASSERT(src_size <= slot_size, "The input does not fit the sequence length bucket!");
+        auto ptr_dst = static_cast<char*>(dst->data()) + m_batch_id * slot_size;
+        if (ptr_dst != src->data())
+            memcpy(ptr_dst, src->data(), src_size);
+        // the padded positions are zero, e.g. masked out by the attention mask
+        memset(ptr_dst + src_size, 0, slot_size - src_size);
+    }
+}
+
+ov::SoPtr<ov::ITensor> SyncInferRequest::get_slot_output(const ov::Output<const ov::Node>& output) const {
+    auto batched_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(output);
+    if (!batched_tensor._so)
+        batched_tensor._so = m_batched_request_wrapper->_infer_request_batched._so;
+    const auto slot_size = batched_tensor->get_byte_size() / m_batch_size;
+    auto shape = batched_tensor->get_shape();
+    shape[0] = 1;
+    const auto& port_shape = output.get_partial_shape();
+    if (port_shape.size() > 1 && port_shape[1].is_dynamic())
+        shape[1] = m_seq_len;
+    // as for the inputs, the unpadded output is the prefix of the slot
+    return {ov::make_tensor(batched_tensor->get_element_type(),
+                            shape,
+                            static_cast<uint8_t*>(batched_tensor->data()) + m_batch_id * slot_size),
+            batched_tensor._so};
+}
+
+void SyncInferRequest::unpad_outputs() {
+    // the rest of the outputs are the views of the slot attached by the worker
+    for (const auto output_id : m_user_outputs) {
+        const auto& output = get_outputs()[output_id];
+        auto src = get_slot_output(output);
+        auto dst = get_tensor(output);
+        dst->set_shape(src->get_shape());
+        src->copy_to(dst._ptr);
+    }
+}
+
 void SyncInferRequest::copy_outputs_if_needed() {
+    if (is_bucketing()) {
+        unpad_outputs();
+        return;
+    }
     for (const auto& it : get_outputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = get_tensor(it);
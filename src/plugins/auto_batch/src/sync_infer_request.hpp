@@ -11,6 +11,8 @@
 namespace ov {
 namespace autobatch_plugin {
 
+class SlotTensor;
+
 class SyncInferRequest : public ov::ISyncInferRequest {
 public:
     SyncInferRequest(const std::shared_ptr<const ov::autobatch_plugin::CompiledModel>& compiled_model,
@@ -20,6 +22,8 @@ public:
                      const std::set<std::size_t>& batched_inputs = {},
                      const std::set<std::size_t>& batched_outputs = {});
 
+    virtual ~SyncInferRequest();
+
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req);
 
@@ -45,7 +49,43 @@ public:
 
     size_t get_batch_size() const;
 
+    // sequence length bucketing: the request is queued to the bucket fitting its inputs when started
+    void set_bucketing(const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request);
+
+    bool is_bucketing() const;
+
+    // the length of the sequence inputs, false when the inputs cannot be batched
+    bool get_inputs_seq_len(size_t& seq_len) const;
+
+    void set_bucket_worker(const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request,
+                           size_t seq_len);
+
+    void set_batch_id(size_t batch_id);
+
+    size_t get_batch_id() const;
+
+    size_t get_seq_len() const;
+
+    // the user output tensors are filled with a copy rather than replaced with the views of the slot
+    void mark_user_output(const ov::Output<const ov::Node>& port);
+
+    // the outputs become the views of the slot of the batched request again, called by the worker owning the slot
+    void attach_outputs();
+
+    // the outputs keep the copy of the data, as the slot is taken by another request
+    void detach_outputs();
+
 protected:
+    void copy_inputs_with_padding();
+
+    void unpad_outputs();
+
+    // the [1, seq_len, ...] prefix of the slot of the batched output tensor
+    ov::SoPtr<ov::ITensor> get_slot_output(const ov::Output<const ov::Node>& output) const;
+
+    // gives the slot of the bucket worker up to the other requests of the bucket
+    void release_slot();
+
     void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
 
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
@@ -54,6 +94,15 @@ protected:
     size_t m_batch_id;
 
     size_t m_batch_size;
+
+    bool m_bucketing = false;
+
+    size_t m_seq_len = 0;
+
+    std::set<size_t> m_user_outputs;
+
+    // guarded by the slots mutex of the worker owning the slot
+    std::vector<std::shared_ptr<SlotTensor>> m_slot_outputs;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batching_policy.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ov::mock_autobatch_plugin;
+using namespace std::chrono_literals;
+
+class BatchingPolicyTest : public ::testing::Test {
+public:
+    BatchingPolicy m_policy;
+    BatchingPolicy::Clock::time_point m_start = BatchingPolicy::Clock::now();
+
+    void arrive(int num, std::chrono::milliseconds interval) {
+        for (int n = 0; n < num; n++) {
+            m_policy.on_arrival(m_start);
+            m_start += interval;
+        }
+    }
+};
+
+TEST_F(BatchingPolicyTest, disabledByDefault) {
+    EXPECT_FALSE(m_policy.is_enabled());
+    m_policy.set_latency_slo(50ms);
+    EXPECT_TRUE(m_policy.is_enabled());
+    EXPECT_EQ(50ms, m_policy.get_latency_slo());
+}
+
+TEST_F(BatchingPolicyTest, waitsForTimeoutWhenIdle) {
+    m_policy.set_latency_slo(50ms);
+    EXPECT_EQ(BatchingPolicy::Clock::duration(1000ms), m_policy.get_wait_time(8, 0, 1000ms, m_start));
+}
+
+TEST_F(BatchingPolicyTest, waitsWhileBatchIsExpectedToFill) {
+    m_policy.set_latency_slo(50ms);
+    arrive(4, 1ms);
+    const auto wait_time = m_policy.get_wait_time(8, 4, 1000ms, m_start);
+    EXPECT_GT(wait_time, BatchingPolicy::Clock::duration::zero());
+    EXPECT_LE(wait_time, BatchingPolicy::Clock::duration(8ms));
+}
+
+TEST_F(BatchingPolicyTest, doesNotWaitWhenBatchCannotFillWithinSlo) {
+    m_policy.set_latency_slo(50ms);
+    arrive(2, 20ms);
+    EXPECT_EQ(BatchingPolicy::Clock::duration::zero(), m_policy.get_wait_time(8, 2, 1000ms, m_start));
+}
+
+TEST_F(BatchingPolicyTest, waitIsBoundedByTimeout) {
+    m_policy.set_latency_slo(1000ms);
+    arrive(2, 20ms);
+    EXPECT_EQ(BatchingPolicy::Clock::duration::zero(), m_policy.get_wait_time(8, 2, 10ms, m_start));
+}
+
+TEST_F(BatchingPolicyTest, effectiveBatchSizeFollowsExecutionTimes) {
+    // no batch1 execution measured yet, so the partial batches are not executed with the batched request
+    EXPECT_EQ(8, m_policy.get_effective_batch_size(8));
+    m_policy.on_single_executed(4, 40ms);
+    // half-filled batch to measure the batched execution
+    EXPECT_EQ(4, m_policy.get_effective_batch_size(8));
+    m_policy.on_batched_executed(30ms);
+    EXPECT_EQ(3, m_policy.get_effective_batch_size(8));
+    m_policy.on_batched_executed(30ms);
+    m_policy.on_single_executed(1, 100ms);
+    EXPECT_LT(m_policy.get_effective_batch_size(8), 3);
+}
+
+TEST_F(BatchingPolicyTest, collectedRequestsResetWaiting) {
+    m_policy.set_latency_slo(50ms);
+    arrive(2, 1ms);
+    m_policy.on_collected(2, m_start);
+    EXPECT_EQ(BatchingPolicy::Clock::duration(1000ms), m_policy.get_wait_time(8, 0, 1000ms, m_start));
+}
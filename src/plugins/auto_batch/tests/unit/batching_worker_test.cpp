@@ -0,0 +1,219 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+
+#include "async_infer_request.hpp"
+#include "mock_common.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using namespace std::chrono_literals;
+
+class AutoBatchWorkerTest : public ::testing::Test {
+public:
+    uint32_t m_batch_size = 4;
+
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+
+    std::shared_ptr<ov::threading::ITaskExecutor> m_batched_executor;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_single_executor;
+
+    std::shared_ptr<CompiledModel> m_auto_batch_compile_model;
+
+    std::atomic_int m_batched_runs = {0};
+    std::atomic_int m_single_runs = {0};
+
+    static std::shared_ptr<ov::Model> create_model(size_t batch) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, 4});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    }
+
+    // the mocked device computes the doubled input
+    static void double_input(ov::ISyncInferRequest& request) {
+        auto input = request.get_tensor(request.get_inputs()[0]);
+        auto output = request.get_tensor(request.get_outputs()[0]);
+        auto src = static_cast<const float*>(input->data());
+        auto dst = static_cast<float*>(output->data());
+        for (size_t i = 0; i < input->get_size(); i++)
+            dst[i] = src[i] * 2;
+    }
+
+    static void fill_input(const std::shared_ptr<ov::IAsyncInferRequest>& request, float value) {
+        auto tensor = request->get_tensor(request->get_inputs()[0]);
+        std::fill_n(static_cast<float*>(tensor->data()), tensor->get_size(), value);
+    }
+
+    static bool is_output_in_slot(
+        const std::shared_ptr<CompiledModel::WorkerInferRequest>& worker,
+        const std::shared_ptr<ov::IAsyncInferRequest>& request,
+        size_t slot) {
+        const auto& batched_request = worker->_infer_request_batched;
+        auto batched_output = batched_request->get_tensor(batched_request->get_outputs()[0]);
+        auto output = request->get_tensor(request->get_outputs()[0]);
+        return static_cast<const uint8_t*>(batched_output->data()) + slot * output->get_byte_size() == output->data();
+    }
+
+    static void check_output(const std::shared_ptr<ov::IAsyncInferRequest>& request, float value) {
+        auto tensor = request->get_tensor(request->get_outputs()[0]);
+        auto data = static_cast<const float*>(tensor->data());
+        for (size_t i = 0; i < tensor->get_size(); i++)
+            EXPECT_EQ(value, data[i]);
+    }
+
+    void TearDown() override {
+        m_auto_batch_compile_model.reset();
+        m_i_compile_model_without_batch.reset();
+        m_i_compile_model_with_batch.reset();
+        m_batched_executor.reset();
+        m_single_executor.reset();
+        m_auto_batch_plugin.reset();
+        m_core.reset();
+    }
+
+    void SetUp() override {
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+
+        auto model = create_model(1);
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(model, m_auto_batch_plugin);
+        m_i_compile_model_with_batch =
+            std::make_shared<NiceMock<MockICompiledModel>>(create_model(m_batch_size), m_auto_batch_plugin);
+
+        // the batched and the batch1 requests are executed concurrently
+        m_batched_executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+            ov::threading::IStreamsExecutor::Config{"AutoBatchWorkerTestBatched"});
+        m_single_executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+            ov::threading::IStreamsExecutor::Config{"AutoBatchWorkerTestSingle"});
+
+        ON_CALL(*m_i_compile_model_with_batch, create_infer_request()).WillByDefault([this]() {
+            auto sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_with_batch);
+            ON_CALL(*sync_request, infer()).WillByDefault([this, request = sync_request.get()]() {
+                // long enough for the rest of the requests to arrive and to be executed with batch1
+                std::this_thread::sleep_for(100ms);
+                double_input(*request);
+                m_batched_runs++;
+            });
+            return std::make_shared<ov::IAsyncInferRequest>(sync_request, m_batched_executor, nullptr);
+        });
+        ON_CALL(*m_i_compile_model_without_batch, create_infer_request()).WillByDefault([this]() {
+            auto sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_without_batch);
+            ON_CALL(*sync_request, infer()).WillByDefault([this, request = sync_request.get()]() {
+                double_input(*request);
+                m_single_runs++;
+            });
+            return std::make_shared<ov::IAsyncInferRequest>(sync_request, m_single_executor, nullptr);
+        });
+
+        ov::AnyMap config = {ov::auto_batch_timeout(static_cast<uint32_t>(50)),
+                             ov::auto_batch_latency_slo(static_cast<uint32_t>(1000))};
+        DeviceInformation device_info = {"CPU", {}, m_batch_size};
+        OV_ASSERT_NO_THROW(
+            m_auto_batch_compile_model =
+                std::make_shared<CompiledModel>(model->clone(),
+                                                m_auto_batch_plugin,
+                                                config,
+                                                device_info,
+                                                std::set<std::size_t>{0},
+                                                std::set<std::size_t>{0},
+                                                ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_with_batch, {}},
+                                                ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_without_batch, {}},
+                                                ov::SoPtr<ov::IRemoteContext>{}));
+    }
+};
+
+TEST_F(AutoBatchWorkerTest, partialBatchRunsNextToBatch1Requests) {
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    for (uint32_t i = 0; i < m_batch_size; i++)
+        requests.push_back(m_auto_batch_compile_model->create_infer_request());
+    auto worker = std::dynamic_pointer_cast<AsyncInferRequest>(requests[0])->m_sync_request->m_batched_request_wrapper;
+    ASSERT_NE(nullptr, worker);
+    // the requests share the tensors with the slots of the batched request
+    for (uint32_t i = 0; i < m_batch_size; i++)
+        EXPECT_TRUE(is_output_in_slot(worker, requests[i], i));
+
+    // the single request runs with batch1 and measures its execution time
+    fill_input(requests[3], 1.f);
+    requests[3]->start_async();
+    requests[3]->wait();
+    EXPECT_EQ(0, m_batched_runs.load());
+    EXPECT_EQ(1, m_single_runs.load());
+    check_output(requests[3], 2.f);
+    // the partial batch computes the slot of the idle request as well, its output is copied out before
+    fill_input(requests[3], 100.f);
+
+    fill_input(requests[0], 3.f);
+    fill_input(requests[1], 5.f);
+    fill_input(requests[2], 7.f);
+    {
+        // both requests are collected before the worker decides on the batch
+        std::lock_guard<std::mutex> lock(worker->_mutex);
+        requests[0]->start_async();
+        requests[1]->start_async();
+    }
+    for (int i = 0; i < 5000 && !worker->_batched_in_flight; i++)
+        std::this_thread::sleep_for(1ms);
+    ASSERT_TRUE(worker->_batched_in_flight);
+    // the request arrived while the partial batch is executed runs with batch1
+    requests[2]->start_async();
+    for (size_t i = 0; i < 3; i++)
+        requests[i]->wait();
+
+    EXPECT_EQ(1, m_batched_runs.load());
+    EXPECT_EQ(2, m_single_runs.load());
+    check_output(requests[0], 6.f);
+    check_output(requests[1], 10.f);
+    check_output(requests[2], 14.f);
+    check_output(requests[3], 2.f);
+}
+
+TEST_F(AutoBatchWorkerTest, fullBatchKeepsOutputsZeroCopy) {
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    for (uint32_t i = 0; i < m_batch_size; i++)
+        requests.push_back(m_auto_batch_compile_model->create_infer_request());
+    auto worker = std::dynamic_pointer_cast<AsyncInferRequest>(requests[0])->m_sync_request->m_batched_request_wrapper;
+    ASSERT_NE(nullptr, worker);
+
+    fill_input(requests[3], 1.f);
+    requests[3]->start_async();
+    requests[3]->wait();
+    check_output(requests[3], 2.f);
+
+    fill_input(requests[0], 3.f);
+    fill_input(requests[1], 5.f);
+    {
+        std::lock_guard<std::mutex> lock(worker->_mutex);
+        requests[0]->start_async();
+        requests[1]->start_async();
+    }
+    requests[0]->wait();
+    requests[1]->wait();
+    EXPECT_EQ(1, m_batched_runs.load());
+    // the idle requests keep the copy of their outputs
+    EXPECT_FALSE(is_output_in_slot(worker, requests[3], 3));
+    check_output(requests[3], 2.f);
+
+    for (uint32_t i = 0; i < m_batch_size; i++)
+        fill_input(requests[i], static_cast<float>(i));
+    for (auto& request : requests)
+        request->start_async();
+    for (auto& request : requests)
+        request->wait();
+    EXPECT_EQ(2, m_batched_runs.load());
+    for (uint32_t i = 0; i < m_batch_size; i++) {
+        EXPECT_TRUE(is_output_in_slot(worker, requests[i], i));
+        check_output(requests[i], 2.f * i);
+    }
+}
@@ -125,6 +125,8 @@ const std::vector<get_property_param> compile_model_get_property_param_test = {
     get_property_param{ov::device::priorities.name(), false},
     get_property_param{ov::auto_batch_timeout.name(), false},
     get_property_param{ov::cache_dir.name(), false},
+    get_property_param{ov::auto_batch_seq_len_buckets.name(), false},
+    get_property_param{ov::auto_batch_buckets_utilization.name(), false},
     // Config in dependent m_plugin
     get_property_param{ov::optimal_batch_size.name(), false},
     // Incorrect Property
@@ -0,0 +1,326 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <thread>
+
+#include "async_infer_request.hpp"
+#include "mock_common.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+class AutoBatchSeqLenBucketsTest : public ::testing::Test {
+public:
+    static constexpr uint32_t m_batch_size = 2;
+    static constexpr size_t m_channels = 2;
+    const std::vector<size_t> m_seq_lens = {4, 8};
+
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::vector<std::shared_ptr<NiceMock<MockICompiledModel>>> m_i_compile_model_buckets;
+
+    std::shared_ptr<ov::threading::ITaskExecutor> m_executor;
+
+    std::shared_ptr<CompiledModel> m_auto_batch_compile_model;
+
+    std::mutex m_runs_mutex;
+    // sequence length of the bucket -> the batched inputs it was executed with
+    std::map<size_t, std::vector<std::vector<float>>> m_batched_inputs;
+    // sequence length of the bucket -> the batched output tensor it was executed with
+    std::map<size_t, ov::SoPtr<ov::ITensor>> m_batched_outputs;
+    std::atomic_int m_single_runs = {0};
+    std::atomic_int m_batched_requests_created = {0};
+
+    static std::shared_ptr<ov::Model> create_model(const ov::PartialShape& shape) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    }
+
+    // the mocked device computes the doubled input
+    static void double_input(ov::ISyncInferRequest& request) {
+        auto input = request.get_tensor(request.get_inputs()[0]);
+        auto output = request.get_tensor(request.get_outputs()[0]);
+        output->set_shape(input->get_shape());
+        auto src = static_cast<const float*>(input->data());
+        auto dst = static_cast<float*>(output->data());
+        for (size_t i = 0; i < input->get_size(); i++)
+            dst[i] = src[i] * 2;
+    }
+
+    // the input of the request: the sequence of seq_len positions filled with the value
+    static void set_input(const std::shared_ptr<ov::IAsyncInferRequest>& request, size_t seq_len, float value) {
+        auto tensor = ov::make_tensor(ov::element::f32, ov::Shape{1, seq_len, m_channels});
+        std::fill_n(static_cast<float*>(tensor->data()), tensor->get_size(), value);
+        request->set_tensor(request->get_inputs()[0], {tensor, nullptr});
+    }
+
+    static void check_output(const std::shared_ptr<ov::IAsyncInferRequest>& request, size_t seq_len, float value) {
+        auto tensor = request->get_tensor(request->get_outputs()[0]);
+        ASSERT_EQ(ov::Shape({1, seq_len, m_channels}), tensor->get_shape());
+        auto data = static_cast<const float*>(tensor->data());
+        for (size_t i = 0; i < tensor->get_size(); i++)
+            EXPECT_EQ(value, data[i]);
+    }
+
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> create_requests(size_t count) {
+        std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+        for (size_t i = 0; i < count; i++)
+            requests.push_back(m_auto_batch_compile_model->create_infer_request());
+        return requests;
+    }
+
+    size_t batched_runs(size_t seq_len) {
+        std::lock_guard<std::mutex> lock(m_runs_mutex);
+        return m_batched_inputs[seq_len].size();
+    }
+
+    // the output of the request is the view of the slot of the batched request of the bucket
+    bool is_output_in_slot(const std::shared_ptr<ov::IAsyncInferRequest>& request, size_t seq_len) {
+        auto data = static_cast<const uint8_t*>(request->get_tensor(request->get_outputs()[0])->data());
+        std::lock_guard<std::mutex> lock(m_runs_mutex);
+        const auto& batched_output = m_batched_outputs[seq_len];
+        if (!batched_output)
+            return false;
+        auto begin = static_cast<const uint8_t*>(batched_output->data());
+        return data >= begin && data < begin + batched_output->get_byte_size();
+    }
+
+    std::vector<float> get_utilization() {
+        return m_auto_batch_compile_model->get_property(ov::auto_batch_buckets_utilization.name())
+            .as<std::vector<float>>();
+    }
+
+    void TearDown() override {
+        m_auto_batch_compile_model.reset();
+        m_i_compile_model_without_batch.reset();
+        m_i_compile_model_buckets.clear();
+        m_executor.reset();
+        m_auto_batch_plugin.reset();
+        m_core.reset();
+    }
+
+    void SetUp() override {
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+        m_executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+            ov::threading::IStreamsExecutor::Config{"AutoBatchSeqLenBucketsTest"});
+
+        auto model = create_model({1, -1, m_channels});
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(model, m_auto_batch_plugin);
+        ON_CALL(*m_i_compile_model_without_batch, create_infer_request()).WillByDefault([this]() {
+            auto sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_without_batch);
+            ON_CALL(*sync_request, infer()).WillByDefault([this, request = sync_request.get()]() {
+                double_input(*request);
+                m_single_runs++;
+            });
+            return std::make_shared<ov::IAsyncInferRequest>(sync_request, m_executor, nullptr);
+        });
+
+        std::vector<std::pair<size_t, ov::SoPtr<ov::ICompiledModel>>> bucket_models;
+        for (size_t bucket_id = 0; bucket_id < m_seq_lens.size(); bucket_id++) {
+            const auto seq_len = m_seq_lens[bucket_id];
+            auto bucket_model = std::make_shared<NiceMock<MockICompiledModel>>(
+                create_model({m_batch_size, static_cast<int64_t>(seq_len), m_channels}),
+                m_auto_batch_plugin);
+            ON_CALL(*bucket_model, create_infer_request()).WillByDefault([this, seq_len, bucket_id]() {
+                m_batched_requests_created++;
+                auto sync_request =
+                    std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_buckets[bucket_id]);
+                ON_CALL(*sync_request, infer()).WillByDefault([this, seq_len, request = sync_request.get()]() {
+                    auto input = request->get_tensor(request->get_inputs()[0]);
+                    auto data = static_cast<const float*>(input->data());
+                    {
+                        std::lock_guard<std::mutex> lock(m_runs_mutex);
+                        m_batched_inputs[seq_len].emplace_back(data, data + input->get_size());
+                        m_batched_outputs[seq_len] = request->get_tensor(request->get_outputs()[0]);
+                    }
+                    double_input(*request);
+                });
+                return std::make_shared<ov::IAsyncInferRequest>(sync_request, m_executor, nullptr);
+            });
+            m_i_compile_model_buckets.push_back(bucket_model);
+            bucket_models.emplace_back(seq_len, ov::SoPtr<ov::ICompiledModel>{bucket_model, {}});
+        }
+
+        // long enough for the started requests to be collected in full
+        ov::AnyMap config = {ov::auto_batch_timeout(static_cast<uint32_t>(200))};
+        DeviceInformation device_info = {"CPU", {}, m_batch_size};
+        OV_ASSERT_NO_THROW(
+            m_auto_batch_compile_model =
+                std::make_shared<CompiledModel>(model->clone(),
+                                                m_auto_batch_plugin,
+                                                config,
+                                                device_info,
+                                                std::set<std::size_t>{0},
+                                                std::set<std::size_t>{0},
+                                                ov::SoPtr<ov::ICompiledModel>{},
+                                                ov::SoPtr<ov::ICompiledModel>{m_i_compile_model_without_batch, {}},
+                                                ov::SoPtr<ov::IRemoteContext>{},
+                                                bucket_models));
+    }
+};
+
+TEST_F(AutoBatchSeqLenBucketsTest, requestsOfDifferentBatchesShareBucket) {
+    // the requests 0, 1 and 2, 3 are created for the different batches
+    auto requests = create_requests(2 * m_batch_size);
+    set_input(requests[0], 3, 1.f);
+    set_input(requests[1], 6, 2.f);
+    set_input(requests[2], 4, 3.f);
+    set_input(requests[3], 8, 4.f);
+    for (auto& request : requests)
+        request->start_async();
+    for (auto& request : requests)
+        request->wait();
+
+    EXPECT_EQ(1u, batched_runs(4));
+    EXPECT_EQ(1u, batched_runs(8));
+    EXPECT_EQ(0, m_single_runs.load());
+    check_output(requests[0], 3, 2.f);
+    check_output(requests[1], 6, 4.f);
+    check_output(requests[2], 4, 6.f);
+    check_output(requests[3], 8, 8.f);
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, bucketSharesOneBatchedRequest) {
+    auto requests = create_requests(3 * m_batch_size);
+    EXPECT_EQ(static_cast<int>(m_seq_lens.size()), m_batched_requests_created.load());
+
+    for (size_t i = 0; i < requests.size(); i++)
+        set_input(requests[i], 2, static_cast<float>(i));
+    for (auto& request : requests)
+        request->start_async();
+    for (auto& request : requests)
+        request->wait();
+
+    EXPECT_EQ(3u, batched_runs(4));
+    EXPECT_EQ(0, m_single_runs.load());
+    for (size_t i = 0; i < requests.size(); i++)
+        check_output(requests[i], 2, 2.f * i);
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, inputsArePaddedWithZeros) {
+    auto requests = create_requests(m_batch_size);
+    set_input(requests[0], 1, 5.f);
+    set_input(requests[1], 3, 7.f);
+    for (auto& request : requests)
+        request->start_async();
+    for (auto& request : requests)
+        request->wait();
+
+    ASSERT_EQ(1u, batched_runs(4));
+    const auto& batched_input = m_batched_inputs[4].front();
+    ASSERT_EQ(m_batch_size * 4 * m_channels, batched_input.size());
+    // the slots go in the order of arrival, the values tell the requests apart
+    const auto slot_size = 4 * m_channels;
+    for (size_t slot = 0; slot < m_batch_size; slot++) {
+        const auto* data = batched_input.data() + slot * slot_size;
+        const size_t seq_len = data[0] == 5.f ? 1 : 3;
+        for (size_t i = 0; i < slot_size; i++)
+            EXPECT_EQ(i < seq_len * m_channels ? data[0] : 0.f, data[i]);
+    }
+    check_output(requests[0], 1, 10.f);
+    check_output(requests[1], 3, 14.f);
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, outputsAreCopiedOutOfSlots) {
+    auto requests = create_requests(2 * m_batch_size);
+    set_input(requests[0], 2, 1.f);
+    set_input(requests[1], 4, 2.f);
+    requests[0]->start_async();
+    requests[1]->start_async();
+    requests[0]->wait();
+    requests[1]->wait();
+
+    // the next batch of the bucket takes the slots of the requests 0 and 1
+    set_input(requests[2], 4, 3.f);
+    set_input(requests[3], 2, 4.f);
+    requests[2]->start_async();
+    requests[3]->start_async();
+    requests[2]->wait();
+    requests[3]->wait();
+
+    EXPECT_EQ(2u, batched_runs(4));
+    check_output(requests[0], 2, 2.f);
+    check_output(requests[1], 4, 4.f);
+    check_output(requests[2], 4, 6.f);
+    check_output(requests[3], 2, 8.f);
+    EXPECT_FALSE(is_output_in_slot(requests[0], 4));
+    EXPECT_FALSE(is_output_in_slot(requests[1], 4));
+    EXPECT_TRUE(is_output_in_slot(requests[2], 4));
+    EXPECT_TRUE(is_output_in_slot(requests[3], 4));
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, outputsAreViewsOfKeptSlots) {
+    auto requests = create_requests(m_batch_size);
+    for (float value : {1.f, 2.f}) {
+        set_input(requests[0], 3, value);
+        set_input(requests[1], 4, value + 10.f);
+        for (auto& request : requests)
+            request->start_async();
+        for (auto& request : requests)
+            request->wait();
+
+        // no other request takes the slots, so the outputs are not copied
+        EXPECT_TRUE(is_output_in_slot(requests[0], 4));
+        EXPECT_TRUE(is_output_in_slot(requests[1], 4));
+        check_output(requests[0], 3, 2.f * value);
+        check_output(requests[1], 4, 2.f * (value + 10.f));
+    }
+    EXPECT_EQ(2u, batched_runs(4));
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, userOutputIsFilledWithCopy) {
+    auto requests = create_requests(m_batch_size);
+    auto user_output = ov::make_tensor(ov::element::f32, ov::Shape{1, 4, m_channels});
+    requests[0]->set_tensor(requests[0]->get_outputs()[0], {user_output, nullptr});
+    set_input(requests[0], 2, 1.f);
+    set_input(requests[1], 2, 2.f);
+    for (auto& request : requests)
+        request->start_async();
+    for (auto& request : requests)
+        request->wait();
+
+    EXPECT_EQ(user_output, requests[0]->get_tensor(requests[0]->get_outputs()[0])._ptr);
+    check_output(requests[0], 2, 2.f);
+    check_output(requests[1], 2, 4.f);
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, oversizedRequestRunsAlone) {
+    auto requests = create_requests(m_batch_size);
+    set_input(requests[0], 9, 3.f);
+    requests[0]->start_async();
+    requests[0]->wait();
+
+    EXPECT_EQ(1, m_single_runs.load());
+    EXPECT_EQ(0u, batched_runs(4));
+    EXPECT_EQ(0u, batched_runs(8));
+    check_output(requests[0], 9, 6.f);
+}
+
+TEST_F(AutoBatchSeqLenBucketsTest, reportsBucketsUtilization) {
+    EXPECT_EQ(std::vector<float>({0.f, 0.f}), get_utilization());
+
+    auto requests = create_requests(m_batch_size);
+    set_input(requests[0], 3, 1.f);
+    set_input(requests[1], 4, 1.f);
+    for (auto& request : requests)
+        request->start_async();
+    for (auto& request : requests)
+        request->wait();
+
+    // 7 tokens of the requests in the 2 x 4 token slots of the batch
+    const auto utilization = get_utilization();
+    ASSERT_EQ(m_seq_lens.size(), utilization.size());
+    EXPECT_FLOAT_EQ(7.f / 8.f, utilization[0]);
+    EXPECT_FLOAT_EQ(0.f, utilization[1]);
+}
@@ -4,9 +4,17 @@
 
 #include "async_infer_request.hpp"
 
+#include "compiled_model.hpp"
+
 struct RequestExecutor : ov::threading::ITaskExecutor {
-    explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
+    RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                    ov::hetero::PipelineStageStatistics& statistics,
+                    std::function<void()> on_start_failed)
+        : m_request(request),
+          m_statistics(statistics),
+          m_on_start_failed(std::move(on_start_failed)) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
+            m_statistics.add(std::chrono::steady_clock::now() - m_start);
             m_exception_ptr = std::move(exception_ptr);
             auto task = std::move(m_task);
             task();
@@ -14,9 +22,19 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     }
     void run(ov::threading::Task task) override {
         m_task = std::move(task);
-        m_request->start_async();
+        m_start = std::chrono::steady_clock::now();
+        try {
+            m_request->start_async();
+        } catch (...) {
+            m_task = {};
+            m_on_start_failed();
+            throw;
+        }
     };
     ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    ov::hetero::PipelineStageStatistics& m_statistics;
+    std::function<void()> m_on_start_failed;
+    std::chrono::steady_clock::time_point m_start;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
@@ -26,13 +44,32 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
+    auto compiled_model =
+        std::static_pointer_cast<const ov::hetero::CompiledModel>(m_infer_request->get_compiled_model());
+    m_pipeline_limiter = compiled_model->m_pipeline_limiter;
+
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
-        m_pipeline.emplace_back(request_executor, [request_executor] {
+    if (m_pipeline_limiter) {
+        // the first stage waits for a free slot of the pipeline, the slot is released after the last submodel
+        m_pipeline.emplace_back(m_pipeline_limiter, [this] {
+            m_holds_pipeline_slot = true;
+        });
+    }
+    auto& subrequests = m_infer_request->m_subrequests;
+    for (size_t i = 0; i < subrequests.size(); i++) {
+        auto request_executor =
+            std::make_shared<RequestExecutor>(subrequests[i], compiled_model->m_stage_statistics[i], [this] {
+                release_pipeline_slot();
+            });
+        const bool is_last = i + 1 == subrequests.size();
+        m_pipeline.emplace_back(request_executor, [this, request_executor, is_last] {
             if (nullptr != request_executor->m_exception_ptr) {
+                release_pipeline_slot();
                 std::rethrow_exception(request_executor->m_exception_ptr);
             }
+            if (is_last) {
+                release_pipeline_slot();
+            }
         });
     }
 }
@@ -46,4 +83,10 @@ void ov::hetero::AsyncInferRequest::cancel() {
     for (auto&& request : m_infer_request->m_subrequests) {
         request->cancel();
     }
-}
\ No newline at end of file
+}
+
+void ov::hetero::AsyncInferRequest::release_pipeline_slot() {
+    if (m_holds_pipeline_slot.exchange(false)) {
+        m_pipeline_limiter->release();
+    }
+}
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
+#include "pipeline.hpp"
 #include "sync_infer_request.hpp"
 
 namespace ov {
@@ -23,7 +25,11 @@ public:
     void cancel() override;
 
 private:
+    void release_pipeline_slot();
+
     std::shared_ptr<InferRequest> m_infer_request;
+    std::shared_ptr<PipelineLimiter> m_pipeline_limiter;
+    std::atomic_bool m_holds_pipeline_slot{false};
 };
 
 }  // namespace hetero
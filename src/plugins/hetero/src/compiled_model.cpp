@@ -75,6 +75,7 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
+    init_pipeline();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -168,6 +169,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    init_pipeline();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -227,7 +229,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::pipeline_stage_latencies};
         return ro_properties;
     };
 
@@ -236,6 +239,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::pipeline_depth.name(), supported_properties);
+        add_ro_properties(ov::hetero::partition_policy.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -255,6 +260,10 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // more requests than the pipeline depth only wait for the running ones
+        if (m_cfg.pipeline_depth > 0) {
+            return decltype(ov::optimal_number_of_infer_requests)::value_type{m_cfg.pipeline_depth};
+        }
         unsigned int value = 0u;
         for (const auto& comp_model_desc : m_compiled_submodels) {
             value = std::max(value,
@@ -275,6 +284,13 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{
             (m_compiled_submodels.size() - get_hetero_plugin()->independent_submodel_size)};
+    } else if (ov::hetero::pipeline_stage_latencies == name) {
+        std::vector<float> latencies;
+        latencies.reserve(m_stage_statistics.size());
+        for (const auto& statistics : m_stage_statistics) {
+            latencies.push_back(statistics.get_average_ms());
+        }
+        return decltype(ov::hetero::pipeline_stage_latencies)::value_type{std::move(latencies)};
     }
     return m_cfg.get(name);
 }
@@ -319,6 +335,13 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
     }
 }
 
+void ov::hetero::CompiledModel::init_pipeline() {
+    m_stage_statistics = std::vector<PipelineStageStatistics>(m_compiled_submodels.size());
+    if (m_cfg.pipeline_depth > 0) {
+        m_pipeline_limiter = std::make_shared<PipelineLimiter>(m_cfg.pipeline_depth);
+    }
+}
+
 void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
     OV_ITT_SCOPED_TASK(itt::domains::Hetero, "CompiledModel::export_model");
 
@@ -7,6 +7,7 @@
 #include "config.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline.hpp"
 #include "plugin.hpp"
 #include "remote_context.hpp"
 #include "subgraph_collector.hpp"
@@ -47,6 +48,8 @@ public:
 
 private:
     friend class InferRequest;
+    friend class AsyncInferRequest;
+    friend class Plugin;
 
     void compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels);
 
@@ -56,6 +59,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void init_pipeline();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -69,6 +74,9 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+
+    std::shared_ptr<PipelineLimiter> m_pipeline_limiter;
+    mutable std::vector<PipelineStageStatistics> m_stage_statistics;
 };
 }  // namespace hetero
 }  // namespace ov
@@ -33,6 +33,18 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::pipeline_depth == key) {
+            try {
+                pipeline_depth = value.as<uint32_t>();
+            } catch (...) {
+                OPENVINO_THROW("Wrong value ",
+                               value.as<std::string>(),
+                               " for property key ",
+                               ov::hetero::pipeline_depth.name(),
+                               ". Expected non-negative integer");
+            }
+        } else if (ov::hetero::partition_policy == key) {
+            partition_policy = value.as<PartitionPolicy>();
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +60,10 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::pipeline_depth) {
+        return {pipeline_depth};
+    } else if (name == ov::hetero::partition_policy) {
+        return {partition_policy};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -60,7 +76,9 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::pipeline_depth.name(), pipeline_depth},
+            {ov::hetero::partition_policy.name(), partition_policy}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
@@ -38,6 +38,10 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    uint32_t pipeline_depth = 0;
+
+    PartitionPolicy partition_policy = PartitionPolicy::QUERY;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
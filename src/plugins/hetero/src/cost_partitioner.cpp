@@ -0,0 +1,312 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_partitioner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/util/op_types.hpp"
+
+namespace {
+constexpr double infinity = std::numeric_limits<double>::infinity();
+// all orders of the devices are tried by BALANCE_STAGES up to this number of devices
+constexpr size_t max_permuted_devices = 5;
+constexpr size_t balance_search_iterations = 40;
+
+bool is_compute_op(const std::shared_ptr<ov::Node>& node) {
+    return !ov::op::util::is_parameter(node) && !ov::op::util::is_constant(node) && !ov::op::util::is_output(node);
+}
+}  // namespace
+
+ov::hetero::CostPartitioner::CostPartitioner(const std::shared_ptr<const ov::Model>& model, float transfer_bandwidth)
+    : m_model(model),
+      m_transfer_bandwidth(transfer_bandwidth) {
+    OPENVINO_ASSERT(m_transfer_bandwidth > 0, "Transfer bandwidth must be positive");
+    for (const auto& node : m_model->get_ordered_ops()) {
+        if (is_compute_op(node)) {
+            m_positions[node.get()] = m_ops.size();
+            m_ops.push_back(node);
+        }
+    }
+    // every tensor crosses the boundaries from its producer up to its last consumer
+    std::vector<double> bytes_delta(m_ops.size() + 1, 0.0);
+    for (size_t i = 0; i < m_ops.size(); i++) {
+        for (const auto& output : m_ops[i]->outputs()) {
+            if (output.get_partial_shape().is_dynamic()) {
+                continue;
+            }
+            size_t last_consumer = i;
+            for (const auto& input : output.get_target_inputs()) {
+                auto it = m_positions.find(input.get_node());
+                if (it != m_positions.end()) {
+                    last_consumer = std::max(last_consumer, it->second);
+                }
+            }
+            const auto bytes =
+                static_cast<double>(output.get_element_type().bitwidth() * ov::shape_size(output.get_shape()) / 8);
+            bytes_delta[i + 1] += bytes;
+            bytes_delta[last_consumer + 1] -= bytes;
+        }
+    }
+    m_cut_bytes.resize(m_ops.size());
+    double bytes = 0.0;
+    for (size_t i = 0; i < m_ops.size(); i++) {
+        bytes += bytes_delta[i];
+        m_cut_bytes[i] = bytes;
+    }
+}
+
+double ov::hetero::CostPartitioner::transfer_cost(size_t position) const {
+    return position == 0 ? 0.0 : m_cut_bytes[position] / m_transfer_bandwidth;
+}
+
+ov::SupportedOpsMap ov::hetero::CostPartitioner::run(const std::vector<DeviceCosts>& devices, PartitionPolicy policy) {
+    OPENVINO_ASSERT(!devices.empty(), "There are no devices to partition the model between");
+    Costs costs(devices.size(), std::vector<double>(m_ops.size(), infinity));
+    std::vector<double> overheads(devices.size());
+    for (size_t d = 0; d < devices.size(); d++) {
+        overheads[d] = devices[d].submodel_overhead;
+        for (size_t i = 0; i < m_ops.size(); i++) {
+            auto it = devices[d].op_costs.find(m_ops[i]->get_friendly_name());
+            if (it != devices[d].op_costs.end()) {
+                costs[d][i] = it->second;
+            }
+        }
+    }
+
+    std::vector<size_t> assignment;
+    if (policy != PartitionPolicy::BALANCE_STAGES || !balance_stages(costs, overheads, assignment)) {
+        assignment = min_latency(costs, overheads);
+    }
+
+    ov::SupportedOpsMap affinities;
+    for (size_t i = 0; i < m_ops.size(); i++) {
+        affinities[m_ops[i]->get_friendly_name()] = devices[assignment[i]].device_name;
+    }
+    // Parameters and Constants go to the device of their first consumer, Results to the device of the producer
+    const auto& default_device = devices[assignment.empty() ? 0 : assignment.front()].device_name;
+    for (const auto& node : m_model->get_ordered_ops()) {
+        if (is_compute_op(node)) {
+            continue;
+        }
+        std::string device = default_device;
+        if (ov::op::util::is_output(node)) {
+            auto it = affinities.find(node->get_input_node_ptr(0)->get_friendly_name());
+            if (it != affinities.end()) {
+                device = it->second;
+            }
+        } else {
+            size_t first_consumer = m_ops.size();
+            for (const auto& output : node->outputs()) {
+                for (const auto& input : output.get_target_inputs()) {
+                    auto it = m_positions.find(input.get_node());
+                    if (it != m_positions.end()) {
+                        first_consumer = std::min(first_consumer, it->second);
+                    }
+                }
+            }
+            if (first_consumer < m_ops.size()) {
+                device = devices[assignment[first_consumer]].device_name;
+            }
+        }
+        affinities[node->get_friendly_name()] = device;
+    }
+    return affinities;
+}
+
+std::vector<size_t> ov::hetero::CostPartitioner::min_latency(const Costs& costs, const std::vector<double>& overheads) {
+    const size_t devices = costs.size();
+    const size_t ops = m_ops.size();
+    std::vector<size_t> assignment(ops, 0);
+    m_estimated_cost = 0.f;
+    if (ops == 0) {
+        return assignment;
+    }
+    for (size_t i = 0; i < ops; i++) {
+        bool supported = false;
+        for (size_t d = 0; d < devices; d++) {
+            supported |= !std::isinf(costs[d][i]);
+        }
+        OPENVINO_ASSERT(supported,
+                        "Hetero device could not measure the cost of the layer (Name: ",
+                        m_ops[i]->get_friendly_name(),
+                        ", Type: ",
+                        m_ops[i]->get_type_name(),
+                        ") on any pointed device");
+    }
+
+    // latency[i][d] is the least latency of the operations up to i, where i is executed by d
+    std::vector<std::vector<double>> latency(ops, std::vector<double>(devices, infinity));
+    std::vector<std::vector<size_t>> previous(ops, std::vector<size_t>(devices, 0));
+    for (size_t d = 0; d < devices; d++) {
+        latency[0][d] = costs[d][0] + overheads[d];
+    }
+    for (size_t i = 1; i < ops; i++) {
+        for (size_t d = 0; d < devices; d++) {
+            if (std::isinf(costs[d][i])) {
+                continue;
+            }
+            double best = latency[i - 1][d];
+            size_t from = d;
+            for (size_t p = 0; p < devices; p++) {
+                const double candidate = latency[i - 1][p] + transfer_cost(i) + overheads[d];
+                if (p != d && candidate < best) {
+                    best = candidate;
+                    from = p;
+                }
+            }
+            latency[i][d] = best + costs[d][i];
+            previous[i][d] = from;
+        }
+    }
+
+    const auto& last = latency[ops - 1];
+    size_t device = static_cast<size_t>(std::min_element(last.begin(), last.end()) - last.begin());
+    m_estimated_cost = static_cast<float>(last[device]);
+    for (size_t i = ops; i-- > 0;) {
+        assignment[i] = device;
+        device = previous[i][device];
+    }
+    return assignment;
+}
+
+bool ov::hetero::CostPartitioner::balance_stages(const Costs& costs,
+                                                 const std::vector<double>& overheads,
+                                                 std::vector<size_t>& assignment) {
+    const size_t devices = costs.size();
+    const size_t ops = m_ops.size();
+    if (ops == 0) {
+        return false;
+    }
+
+    // prefix sums of the costs and the first unsupported operation starting from every position
+    std::vector<std::vector<double>> prefix(devices, std::vector<double>(ops + 1, 0.0));
+    std::vector<std::vector<size_t>> unsupported(devices, std::vector<size_t>(ops + 1, ops));
+    for (size_t d = 0; d < devices; d++) {
+        for (size_t i = 0; i < ops; i++) {
+            prefix[d][i + 1] = prefix[d][i] + (std::isinf(costs[d][i]) ? 0.0 : costs[d][i]);
+        }
+        for (size_t i = ops; i-- > 0;) {
+            unsupported[d][i] = std::isinf(costs[d][i]) ? i : unsupported[d][i + 1];
+        }
+    }
+
+    // Splits the operations into a segment per device in the given order, some of the segments may be empty.
+    // A position is reachable after k segments if the first k devices execute the operations before it within the
+    // limit, the starts of the segments are kept to restore the split.
+    auto split = [&](const std::vector<size_t>& order, double limit, std::vector<size_t>* result) {
+        std::vector<char> reachable(ops + 1, 0);
+        reachable[0] = 1;
+        std::vector<std::vector<size_t>> starts(order.size(), std::vector<size_t>(ops + 1, 0));
+        for (size_t k = 0; k < order.size(); k++) {
+            const auto d = order[k];
+            std::vector<char> next(reachable);
+            std::iota(starts[k].begin(), starts[k].end(), 0);
+            bool has_start = false;
+            size_t best_start = 0;
+            size_t best_end = 0;
+            for (size_t p = 0; p <= ops; p++) {
+                if (!next[p] && has_start && best_end >= p) {
+                    next[p] = 1;
+                    starts[k][p] = best_start;
+                }
+                if (!reachable[p] || p == ops) {
+                    continue;
+                }
+                const double budget = limit - overheads[d] - transfer_cost(p);
+                if (budget < 0) {
+                    continue;
+                }
+                // the farthest end of the segment which has all operations supported and fits into the budget
+                const auto first = prefix[d].begin() + p + 1;
+                const auto last = prefix[d].begin() + unsupported[d][p] + 1;
+                const auto end = static_cast<size_t>(std::upper_bound(first, last, prefix[d][p] + budget) -
+                                                     prefix[d].begin()) -
+                                 1;
+                if (end > p && (!has_start || end > best_end)) {
+                    has_start = true;
+                    best_start = p;
+                    best_end = end;
+                }
+            }
+            reachable.swap(next);
+        }
+        if (!reachable[ops]) {
+            return false;
+        }
+        if (result) {
+            result->assign(ops, 0);
+            size_t end = ops;
+            for (size_t k = order.size(); k-- > 0;) {
+                const auto start = starts[k][end];
+                std::fill(result->begin() + start, result->begin() + end, order[k]);
+                end = start;
+            }
+        }
+        return true;
+    };
+
+    auto slowest_segment = [&](const std::vector<size_t>& split_result) {
+        double slowest = 0.0;
+        for (size_t start = 0; start < ops;) {
+            const auto d = split_result[start];
+            size_t end = start;
+            while (end < ops && split_result[end] == d) {
+                end++;
+            }
+            slowest = std::max(slowest, prefix[d][end] - prefix[d][start] + overheads[d] + transfer_cost(start));
+            start = end;
+        }
+        return slowest;
+    };
+
+    std::vector<std::vector<size_t>> orders;
+    std::vector<size_t> order(devices);
+    std::iota(order.begin(), order.end(), 0);
+    do {
+        orders.push_back(order);
+    } while (devices <= max_permuted_devices && std::next_permutation(order.begin(), order.end()));
+
+    // any split is found without the limit, then the limit is bisected
+    bool found = false;
+    double high = 0.0;
+    for (const auto& candidate_order : orders) {
+        std::vector<size_t> candidate;
+        if (split(candidate_order, std::numeric_limits<double>::max(), &candidate)) {
+            const auto cost = slowest_segment(candidate);
+            if (!found || cost < high) {
+                found = true;
+                high = cost;
+                assignment = std::move(candidate);
+            }
+        }
+    }
+    if (!found) {
+        return false;
+    }
+    double low = 0.0;
+    for (size_t iteration = 0; iteration < balance_search_iterations; iteration++) {
+        const double middle = (low + high) / 2;
+        bool fits = false;
+        for (const auto& candidate_order : orders) {
+            std::vector<size_t> candidate;
+            if (split(candidate_order, middle, &candidate)) {
+                fits = true;
+                assignment = std::move(candidate);
+                break;
+            }
+        }
+        if (fits) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+    m_estimated_cost = static_cast<float>(slowest_segment(assignment));
+    return true;
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/common.hpp"
+#include "properties.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Measured costs of the operations supported by a device
+ */
+struct DeviceCosts {
+    std::string device_name;
+    // execution time in milliseconds of every supported operation by its friendly name
+    std::unordered_map<std::string, float> op_costs;
+    // time in milliseconds spent by a submodel on the device apart from its operations
+    float submodel_overhead = 0.f;
+};
+
+/**
+ * @brief Assigns the operations of the model to the devices by the measured costs.
+ *
+ * The operations are taken in the topological order and split into contiguous segments, every segment is executed
+ * by a single device. A segment starting after another one pays for the tensors crossing the boundary, their size is
+ * divided by the transfer bandwidth, and for the submodel overhead of its device.
+ * MIN_LATENCY minimizes the sum of the costs of all segments. BALANCE_STAGES gives a single segment to every device
+ * at most and minimizes the cost of the slowest segment, so the pipeline of the submodels has the highest throughput.
+ * It falls back to MIN_LATENCY if the supported operations of the devices can not be covered this way.
+ */
+class CostPartitioner {
+public:
+    CostPartitioner(const std::shared_ptr<const ov::Model>& model, float transfer_bandwidth);
+
+    /**
+     * @brief Returns the device of every operation of the model, Parameters, Constants and Results go to the device
+     * of the operation they are connected to
+     */
+    ov::SupportedOpsMap run(const std::vector<DeviceCosts>& devices, PartitionPolicy policy);
+
+    /**
+     * @brief Returns the latency of the last partition, or the cost of its slowest segment for BALANCE_STAGES
+     */
+    float get_estimated_cost() const {
+        return m_estimated_cost;
+    }
+
+private:
+    using Costs = std::vector<std::vector<double>>;
+
+    double transfer_cost(size_t position) const;
+
+    std::vector<size_t> min_latency(const Costs& costs, const std::vector<double>& overheads);
+    bool balance_stages(const Costs& costs, const std::vector<double>& overheads, std::vector<size_t>& assignment);
+
+    std::shared_ptr<const ov::Model> m_model;
+    float m_transfer_bandwidth;
+    // operations except Parameters, Constants and Results in the topological order
+    ov::NodeVector m_ops;
+    std::unordered_map<const ov::Node*, size_t> m_positions;
+    // bytes of the tensors produced before the operation and consumed by it or after it
+    std::vector<double> m_cut_bytes;
+    float m_estimated_cost = 0.f;
+};
+
+}  // namespace hetero
+}  // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline.hpp"
+
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+ov::hetero::PipelineLimiter::PipelineLimiter(size_t limit) : m_limit(limit) {
+    OPENVINO_ASSERT(m_limit > 0, "Pipeline limit must be greater than zero");
+}
+
+void ov::hetero::PipelineLimiter::run(ov::threading::Task task) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_in_flight == m_limit) {
+            m_waiting.push(std::move(task));
+            return;
+        }
+        m_in_flight++;
+    }
+    task();
+}
+
+void ov::hetero::PipelineLimiter::release() {
+    ov::threading::Task task;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        OPENVINO_ASSERT(m_in_flight > 0, "Pipeline limiter is released more times than acquired");
+        if (m_waiting.empty()) {
+            m_in_flight--;
+            return;
+        }
+        // the slot is passed to the first waiting request as is
+        task = std::move(m_waiting.front());
+        m_waiting.pop();
+    }
+    task();
+}
+
+size_t ov::hetero::PipelineLimiter::get_in_flight() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_in_flight;
+}
+
+size_t ov::hetero::PipelineLimiter::get_waiting() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_waiting.size();
+}
+
+void ov::hetero::PipelineStageStatistics::add(std::chrono::steady_clock::duration duration) {
+    m_total_ns += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    m_count++;
+}
+
+float ov::hetero::PipelineStageStatistics::get_average_ms() const {
+    const auto count = m_count.load();
+    return count ? static_cast<float>(m_total_ns.load()) / count / 1e6f : 0.f;
+}
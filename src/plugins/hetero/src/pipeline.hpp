@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Executor which limits the number of infer requests inside the submodels pipeline.
+ * A task passed to `run` is executed immediately if less than `limit` requests are in flight, otherwise it waits
+ * until one of the running requests calls `release`. The waiting tasks are executed in the order of arrival.
+ */
+class PipelineLimiter : public ov::threading::ITaskExecutor {
+public:
+    explicit PipelineLimiter(size_t limit);
+
+    void run(ov::threading::Task task) override;
+
+    void release();
+
+    size_t get_in_flight() const;
+
+    size_t get_waiting() const;
+
+private:
+    const size_t m_limit;
+    size_t m_in_flight = 0;
+    std::queue<ov::threading::Task> m_waiting;
+    mutable std::mutex m_mutex;
+};
+
+/**
+ * @brief Execution time statistics of a single submodel of the pipeline
+ */
+struct PipelineStageStatistics {
+    void add(std::chrono::steady_clock::duration duration);
+
+    float get_average_ms() const;
+
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_total_ns{0};
+};
+
+}  // namespace hetero
+}  // namespace ov
@@ -4,6 +4,9 @@
 
 #include "plugin.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <map>
 #include <memory>
@@ -18,7 +21,9 @@
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/op/util/op_types.hpp"
+#include "openvino/runtime/compilation_context.hpp"
 #include "openvino/runtime/device_id_parser.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -26,6 +31,49 @@
 #include "openvino/util/common_util.hpp"
 #include "properties.hpp"
 #include "remote_context.hpp"
+#include "sync_infer_request.hpp"
+
+namespace {
+// number of the measured inferences of every device for the cost based partitioning
+constexpr size_t profiling_iterations = 10;
+// assumed bandwidth of the tensors transfer between the devices in bytes per millisecond, i.e. 8 GB/s
+constexpr float transfer_bandwidth = 8e6f;
+
+void fill_profiling_tensor(const ov::SoPtr<ov::ITensor>& tensor) {
+    std::memset(tensor->data(), 0, tensor->get_byte_size());
+    // floating point inputs get values from [0.5, 1.5), the integer ones are zeros which are valid indices
+    const auto& type = tensor->get_element_type();
+    const auto size = tensor->get_size();
+    auto value = [](size_t i) {
+        return 0.5f + static_cast<float>(i % 97) / 97.f;
+    };
+    if (type == ov::element::f32) {
+        auto data = static_cast<float*>(tensor->data());
+        for (size_t i = 0; i < size; i++)
+            data[i] = value(i);
+    } else if (type == ov::element::f16) {
+        auto data = static_cast<ov::float16*>(tensor->data());
+        for (size_t i = 0; i < size; i++)
+            data[i] = ov::float16(value(i));
+    } else if (type == ov::element::bf16) {
+        auto data = static_cast<ov::bfloat16*>(tensor->data());
+        for (size_t i = 0; i < size; i++)
+            data[i] = ov::bfloat16(value(i));
+    }
+}
+
+std::vector<std::string> get_original_names(const std::shared_ptr<const ov::Node>& node) {
+    const auto& rt_info = node->get_rt_info();
+    auto it = rt_info.find(ov::exec_model_info::ORIGINAL_NAMES);
+    if (it == rt_info.end()) {
+        return {node->get_friendly_name()};
+    }
+    if (it->second.is<std::string>()) {
+        return ov::util::split(it->second.as<std::string>(), ',');
+    }
+    return it->second.as<std::vector<std::string>>();
+}
+}  // namespace
 
 ov::hetero::Plugin::Plugin() {
     set_device_name("HETERO");
@@ -33,7 +81,7 @@ ov::hetero::Plugin::Plugin() {
 
 std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo>> ov::hetero::Plugin::split_graph(
     const std::shared_ptr<ov::Model>& model,
-    Configuration config) const {
+    Configuration& config) const {
     std::vector<ov::hetero::SubmodelInfo> submodels;
     ov::SupportedOpsMap query_model_result;
     SubgraphsMappingInfo mapping_info;
@@ -50,6 +98,25 @@ std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo
         }
     }
 
+    auto device_names = ov::DeviceIDParser::get_hetero_devices(config.device_priorities);
+    bool cost_partitioned = false;
+    if (!user_set_affinities && config.partition_policy != PartitionPolicy::QUERY && device_names.size() > 1 &&
+        !model->is_dynamic()) {
+        // the affinities are chosen by the measured costs, the partitioning falls back to the query results
+        // if the costs can not be measured
+        try {
+            query_model_result = partition_by_costs(model, config);
+            user_set_affinities = true;
+            cost_partitioned = true;
+        } catch (const ov::Exception&) {
+            query_model_result.clear();
+        }
+    }
+    if (!cost_partitioned) {
+        // the compiled model reports the policy the model is actually split by
+        config.partition_policy = PartitionPolicy::QUERY;
+    }
+
     if (user_set_affinities) {
         // All affinities must be defined by user
         ov::hetero::SubgraphsVector ordered_subgraphs;
@@ -98,6 +165,177 @@ std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo
     return {mapping_info, submodels};
 }
 
+ov::SupportedOpsMap ov::hetero::Plugin::partition_by_costs(const std::shared_ptr<ov::Model>& model,
+                                                          const Configuration& config) const {
+    OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::partition_by_costs");
+
+    auto hash_properties = config.get_hetero_properties();
+    for (const auto& [device, props] : config.get_device_properties()) {
+        hash_properties[device] = props;
+    }
+    const auto hash = ov::ModelCache::compute_hash(model, hash_properties);
+    auto find_partition = [&]() {
+        return std::find_if(m_cost_partitions.begin(), m_cost_partitions.end(), [&](const auto& partition) {
+            return partition.first == hash;
+        });
+    };
+    {
+        std::lock_guard<std::mutex> lock{m_cost_partitions_mutex};
+        auto it = find_partition();
+        if (it != m_cost_partitions.end()) {
+            m_cost_partitions.splice(m_cost_partitions.begin(), m_cost_partitions, it);
+            return it->second;
+        }
+    }
+
+    std::vector<DeviceCosts> devices_costs;
+    for (const auto& device_name : ov::DeviceIDParser::get_hetero_devices(config.device_priorities)) {
+        devices_costs.push_back(profile_device_costs(model, config, device_name));
+    }
+    CostPartitioner partitioner(model, transfer_bandwidth);
+    auto affinities = partitioner.run(devices_costs, config.partition_policy);
+
+    std::lock_guard<std::mutex> lock{m_cost_partitions_mutex};
+    // the same model may be partitioned by a concurrent compilation meanwhile
+    auto it = find_partition();
+    if (it != m_cost_partitions.end()) {
+        m_cost_partitions.erase(it);
+    }
+    m_cost_partitions.emplace_front(hash, affinities);
+    if (m_cost_partitions.size() > max_cost_partitions) {
+        m_cost_partitions.pop_back();
+    }
+    return affinities;
+}
+
+ov::hetero::DeviceCosts ov::hetero::Plugin::profile_device_costs(const std::shared_ptr<ov::Model>& model,
+                                                                 const Configuration& config,
+                                                                 const std::string& device_name) const {
+    DeviceCosts costs;
+    costs.device_name = device_name;
+
+    // The device goes first, so it gets all the operations it supports, the rest are executed by the other devices
+    // to provide the real inputs for the submodels of the device
+    Configuration profiling_config = config;
+    profiling_config.partition_policy = PartitionPolicy::QUERY;
+    profiling_config.pipeline_depth = 0;
+    profiling_config.device_priorities = device_name;
+    for (const auto& other_device : ov::DeviceIDParser::get_hetero_devices(config.device_priorities)) {
+        if (other_device != device_name)
+            profiling_config.device_priorities += "," + other_device;
+    }
+    profiling_config.device_properties[ov::enable_profiling.name()] = true;
+
+    const auto independent_submodels = independent_submodel_size;
+    try {
+        auto profiling_model = model->clone();
+        SubgraphsMappingInfo mapping_info;
+        std::vector<ov::hetero::SubmodelInfo> submodels;
+        std::tie(mapping_info, submodels) = split_graph(profiling_model, profiling_config);
+        independent_submodel_size = independent_submodels;
+
+        auto compiled_model = std::make_shared<CompiledModel>(profiling_model,
+                                                              submodels,
+                                                              mapping_info,
+                                                              shared_from_this(),
+                                                              nullptr,
+                                                              profiling_config);
+        auto request = std::make_shared<InferRequest>(compiled_model);
+        for (const auto& input : compiled_model->inputs()) {
+            fill_profiling_tensor(request->get_tensor(input));
+        }
+
+        const auto& subrequests = request->m_subrequests;
+        const auto& compiled_submodels = compiled_model->m_compiled_submodels;
+        std::vector<double> total_times(subrequests.size(), 0.0);
+        std::vector<std::map<std::string, double>> node_times(subrequests.size());
+        // the first iteration is a warm up
+        for (size_t iteration = 0; iteration <= profiling_iterations; iteration++) {
+            for (size_t i = 0; i < subrequests.size(); i++) {
+                const auto start = std::chrono::steady_clock::now();
+                subrequests[i]->infer();
+                const auto time = std::chrono::steady_clock::now() - start;
+                if (iteration == 0 || compiled_submodels[i].device != device_name)
+                    continue;
+                total_times[i] += std::chrono::duration<double, std::milli>(time).count();
+                try {
+                    for (const auto& info : subrequests[i]->get_profiling_info()) {
+                        if (info.status == ov::ProfilingInfo::Status::EXECUTED)
+                            node_times[i][info.node_name] += info.real_time.count() / 1000.0;
+                    }
+                } catch (const ov::Exception&) {
+                }
+            }
+        }
+
+        double overheads = 0.0;
+        size_t device_submodels = 0;
+        for (size_t i = 0; i < subrequests.size(); i++) {
+            if (compiled_submodels[i].device != device_name)
+                continue;
+            std::vector<std::shared_ptr<ov::Node>> submodel_ops;
+            for (const auto& op : compiled_submodels[i].model->get_ordered_ops()) {
+                if (ov::op::util::is_parameter(op) || ov::op::util::is_output(op))
+                    continue;
+                costs.op_costs.emplace(op->get_friendly_name(), 0.f);
+                if (!ov::op::util::is_constant(op))
+                    submodel_ops.push_back(op);
+            }
+            std::map<std::string, std::vector<std::string>> original_names;
+            try {
+                for (const auto& op : compiled_submodels[i].compiled_model->get_runtime_model()->get_ordered_ops())
+                    original_names[op->get_friendly_name()] = get_original_names(op);
+            } catch (const ov::Exception&) {
+            }
+
+            // the time of a fused node is split between the original operations
+            const double total_time = total_times[i] / profiling_iterations;
+            double mapped_time = 0.0;
+            for (const auto& [node_name, node_time] : node_times[i]) {
+                std::vector<std::string> names;
+                auto it = original_names.find(node_name);
+                for (const auto& name : it != original_names.end() ? it->second : std::vector<std::string>{node_name}) {
+                    if (costs.op_costs.count(name))
+                        names.push_back(name);
+                }
+                if (names.empty())
+                    continue;
+                const double time = node_time / profiling_iterations;
+                for (const auto& name : names)
+                    costs.op_costs[name] += static_cast<float>(time / names.size());
+                mapped_time += time;
+            }
+            if (mapped_time == 0.0) {
+                // there are no per operation counters, the submodel time is split by the sizes of the outputs
+                std::vector<double> weights;
+                double total_weight = 0.0;
+                for (const auto& op : submodel_ops) {
+                    double weight = 1.0;
+                    for (const auto& output : op->outputs()) {
+                        if (output.get_partial_shape().is_static())
+                            weight += static_cast<double>(ov::shape_size(output.get_shape()));
+                    }
+                    weights.push_back(weight);
+                    total_weight += weight;
+                }
+                for (size_t j = 0; j < submodel_ops.size(); j++)
+                    costs.op_costs[submodel_ops[j]->get_friendly_name()] =
+                        static_cast<float>(total_time * weights[j] / total_weight);
+                mapped_time = total_time;
+            }
+            overheads += std::max(0.0, total_time - mapped_time);
+            device_submodels++;
+        }
+        if (device_submodels > 0)
+            costs.submodel_overhead = static_cast<float>(overheads / device_submodels);
+    } catch (const ov::Exception&) {
+        // the device operations are unknown, so it does not get any of them
+        independent_submodel_size = independent_submodels;
+        costs.op_costs.clear();
+    }
+    return costs;
+}
+
 std::shared_ptr<ov::ICompiledModel> ov::hetero::Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                                       const ov::AnyMap& properties) const {
     OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::compile_model");
@@ -365,7 +603,10 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hint::model_distribution_policy};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hint::model_distribution_policy,
+                                                    ov::hetero::pipeline_depth,
+                                                    ov::hetero::partition_policy};
         return rw_properties;
     };
 
@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "config.hpp"
+#include "cost_partitioner.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "subgraph_collector.hpp"
 
@@ -79,11 +82,23 @@ private:
 
     std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<SubmodelInfo>> split_graph(
         const std::shared_ptr<ov::Model>& model,
-        Configuration config) const;
+        Configuration& config) const;
+
+    ov::SupportedOpsMap partition_by_costs(const std::shared_ptr<ov::Model>& model, const Configuration& config) const;
+
+    DeviceCosts profile_device_costs(const std::shared_ptr<ov::Model>& model,
+                                     const Configuration& config,
+                                     const std::string& device_name) const;
 
     Configuration m_cfg;
 
     mutable size_t independent_submodel_size = 0;
+
+    // partitions chosen by the measured costs, by the hash of the model and the hetero configuration,
+    // the most recently used first, the rest are evicted beyond max_cost_partitions
+    static constexpr size_t max_cost_partitions = 16;
+    mutable std::list<std::pair<std::string, ov::SupportedOpsMap>> m_cost_partitions;
+    mutable std::mutex m_cost_partitions_mutex;
 };
 
 }  // namespace hetero
@@ -17,5 +17,64 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Maximum number of infer requests executed by the submodels pipeline at the same time, 0 means no limit.
+ * The requests started above the limit wait until one of the running requests leaves the last submodel.
+ */
+static constexpr Property<uint32_t> pipeline_depth{"HETERO_PIPELINE_DEPTH"};
+
+/**
+ * @brief Read-only property to get the average execution time in milliseconds of every submodel of the pipeline
+ */
+static constexpr Property<std::vector<float>, PropertyMutability::RO> pipeline_stage_latencies{
+    "HETERO_PIPELINE_STAGE_LATENCIES"};
+
+/**
+ * @brief Defines how the model is split between the devices
+ */
+enum class PartitionPolicy {
+    QUERY = 0,           // Operations go to the first device in the priorities list which supports them
+    MIN_LATENCY = 1,     // Operations go to the devices with the least measured latency of the whole model
+    BALANCE_STAGES = 2,  // Every device gets one submodel at most, the slowest submodel is as fast as possible
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const PartitionPolicy& policy) {
+    switch (policy) {
+    case PartitionPolicy::QUERY:
+        return os << "QUERY";
+    case PartitionPolicy::MIN_LATENCY:
+        return os << "MIN_LATENCY";
+    case PartitionPolicy::BALANCE_STAGES:
+        return os << "BALANCE_STAGES";
+    default:
+        OPENVINO_THROW("Unsupported partition policy!");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, PartitionPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "QUERY") {
+        policy = PartitionPolicy::QUERY;
+    } else if (str == "MIN_LATENCY") {
+        policy = PartitionPolicy::MIN_LATENCY;
+    } else if (str == "BALANCE_STAGES") {
+        policy = PartitionPolicy::BALANCE_STAGES;
+    } else {
+        OPENVINO_THROW("Unsupported partition policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Policy of the model partitioning between the devices.
+ * MIN_LATENCY and BALANCE_STAGES run every device on the operations it supports to measure their costs, the model
+ * with dynamic shapes or user defined affinities is split by QUERY policy. The compiled model reports the policy the
+ * model is actually split by, i.e. QUERY if the costs could not be used.
+ */
+static constexpr Property<PartitionPolicy> partition_policy{"HETERO_PARTITION_POLICY"};
 }  // namespace hetero
 }  // namespace ov
@@ -13,6 +13,7 @@
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
@@ -43,13 +44,22 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         const auto& port_idx_out = kvp.second.second;
 
         const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
         if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+            auto output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
+            if (!output_tensor._so) {
+                output_tensor._so = m_subrequests[submodel_idx_out]._so;
+            }
+            if (output_port.get_partial_shape().is_static() &&
+                !std::dynamic_pointer_cast<ov::IRemoteTensor>(output_tensor._ptr)) {
+                // the producer keeps writing to its own host tensor and the consumer reads it in place
+                temp_tensor_map[output_port] = output_tensor;
+            } else {
+                temp_tensor_map[output_port] = {
+                    ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
+                    nullptr};
+                m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
+            }
         }
-        m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
         const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
         m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
     }
@@ -47,6 +47,7 @@ public:
 
 private:
     friend class AsyncInferRequest;
+    friend class Plugin;
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/test_constants.hpp"
+#include "hetero_tests.hpp"
+#include "properties.hpp"
+
+namespace ov {
+namespace hetero {
+namespace tests {
+
+TEST_F(HeteroTests, infer_async_with_pipeline_depth) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::pipeline_depth(2)};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(2u, compiled_model.get_property(ov::hetero::pipeline_depth));
+    EXPECT_EQ(2u, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+
+    // more requests than the pipeline depth, the extra ones wait for a free slot
+    std::vector<ov::InferRequest> infer_requests;
+    std::vector<ov::Tensor> input_tensors;
+    for (size_t i = 0; i < 5; i++) {
+        infer_requests.push_back(compiled_model.create_infer_request());
+        input_tensors.push_back(
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+        input_tensors.back().data<int64_t>()[0] = static_cast<int64_t>(i * 100);
+        infer_requests.back().set_input_tensor(input_tensors.back());
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.start_async();
+    }
+    for (size_t i = 0; i < infer_requests.size(); i++) {
+        infer_requests[i].wait();
+        auto output_tensor = infer_requests[i].get_output_tensor();
+        ASSERT_EQ(input_tensors[i].get_byte_size(), output_tensor.get_byte_size());
+        EXPECT_EQ(memcmp(input_tensors[i].data(), output_tensor.data(), output_tensor.get_byte_size()), 0);
+    }
+
+    auto latencies = compiled_model.get_property(ov::hetero::pipeline_stage_latencies);
+    EXPECT_EQ(compiled_model.get_property(ov::hetero::number_of_submodels), latencies.size());
+    for (const auto& latency : latencies) {
+        EXPECT_GT(latency, 0.f);
+    }
+}
+
+TEST_F(HeteroTests, infer_with_min_latency_partition_policy) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hetero::partition_policy(ov::hetero::PartitionPolicy::MIN_LATENCY)};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    // the policy falls back to QUERY if the costs of the devices could not be used
+    ASSERT_EQ(ov::hetero::PartitionPolicy::MIN_LATENCY, compiled_model.get_property(ov::hetero::partition_policy));
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor =
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    auto output_tensor = infer_request.get_output_tensor();
+    ASSERT_EQ(input_tensor.get_byte_size(), output_tensor.get_byte_size());
+    EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), output_tensor.get_byte_size()), 0);
+}
+
+TEST_F(HeteroTests, min_latency_partition_policy_fallback_for_dynamic_model) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hetero::partition_policy(ov::hetero::PartitionPolicy::MIN_LATENCY)};
+    auto model = create_model_with_subtract_reshape(true);
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    // the costs are not measured for the dynamic shapes
+    EXPECT_EQ(ov::hetero::PartitionPolicy::QUERY, compiled_model.get_property(ov::hetero::partition_policy));
+}
+
+}  // namespace tests
+}  // namespace hetero
+}  // namespace ov
@@ -15,7 +15,9 @@ TEST_F(HeteroTests, get_property_supported_properties) {
                                                                 ov::device::full_name,
                                                                 ov::device::capabilities,
                                                                 ov::device::priorities,
-                                                                ov::hint::model_distribution_policy};
+                                                                ov::hint::model_distribution_policy,
+                                                                ov::hetero::pipeline_depth,
+                                                                ov::hetero::partition_policy};
     auto actual_supported_properties = core.get_property(ov::test::utils::DEVICE_HETERO, ov::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
     for (auto& supported_property : supported_properties) {
@@ -49,6 +51,23 @@ TEST_F(HeteroTests, set_property_device_priorities) {
     EXPECT_EQ("MOCK0,MOCK1", core.get_property(ov::test::utils::DEVICE_HETERO, ov::device::priorities));
 }
 
+TEST_F(HeteroTests, set_property_pipeline_depth) {
+    EXPECT_EQ(0u, core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::pipeline_depth));
+    core.set_property(ov::test::utils::DEVICE_HETERO, ov::hetero::pipeline_depth(3));
+    EXPECT_EQ(3u, core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::pipeline_depth));
+}
+
+TEST_F(HeteroTests, set_property_partition_policy) {
+    EXPECT_EQ(ov::hetero::PartitionPolicy::QUERY,
+              core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::partition_policy));
+    core.set_property(ov::test::utils::DEVICE_HETERO,
+                      ov::hetero::partition_policy(ov::hetero::PartitionPolicy::BALANCE_STAGES));
+    EXPECT_EQ(ov::hetero::PartitionPolicy::BALANCE_STAGES,
+              core.get_property(ov::test::utils::DEVICE_HETERO, ov::hetero::partition_policy));
+    EXPECT_THROW(core.set_property(ov::test::utils::DEVICE_HETERO, {{"HETERO_PARTITION_POLICY", "FASTEST"}}),
+                 ov::Exception);
+}
+
 TEST_F(HeteroTests, set_property_ModelDistributionPolicy) {
     std::set<ov::hint::ModelDistributionPolicy> value = {};
     std::set<ov::hint::ModelDistributionPolicy> model_policy = {ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_partitioner.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/ops.hpp"
+
+using namespace ov::hetero;
+
+namespace {
+// every tensor of the model takes 48 bytes
+constexpr float tensor_bytes = 48.f;
+
+std::shared_ptr<ov::Model> create_test_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 2, 2});
+    param->set_friendly_name("input");
+    std::shared_ptr<ov::Node> node = param;
+    for (size_t i = 1; i <= 4; i++) {
+        node = std::make_shared<ov::op::v0::Relu>(node);
+        node->set_friendly_name("relu" + std::to_string(i));
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(node);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+DeviceCosts create_costs(const std::string& device_name, const std::vector<float>& costs) {
+    DeviceCosts device_costs;
+    device_costs.device_name = device_name;
+    for (size_t i = 0; i < costs.size(); i++) {
+        // negative cost marks the unsupported operation
+        if (costs[i] >= 0)
+            device_costs.op_costs["relu" + std::to_string(i + 1)] = costs[i];
+    }
+    return device_costs;
+}
+}  // namespace
+
+TEST(CostPartitionerTest, min_latency_keeps_single_device) {
+    // the transfer of a tensor takes 1000 ms
+    CostPartitioner partitioner(create_test_model(), tensor_bytes / 1000.f);
+    auto affinities = partitioner.run({create_costs("MOCK0", {1, 1, 5, 5}), create_costs("MOCK1", {5, 5, 2, 2})},
+                                      PartitionPolicy::MIN_LATENCY);
+    for (const auto& name : {"input", "relu1", "relu2", "relu3", "relu4", "res"}) {
+        EXPECT_EQ("MOCK0", affinities.at(name));
+    }
+    EXPECT_FLOAT_EQ(12.f, partitioner.get_estimated_cost());
+}
+
+TEST(CostPartitionerTest, min_latency_switches_device) {
+    // the transfer of a tensor takes 1 ms
+    CostPartitioner partitioner(create_test_model(), tensor_bytes);
+    auto affinities = partitioner.run({create_costs("MOCK0", {1, 1, 10, 10}), create_costs("MOCK1", {10, 10, 1, 1})},
+                                      PartitionPolicy::MIN_LATENCY);
+    ov::SupportedOpsMap expected = {{"input", "MOCK0"},
+                                    {"relu1", "MOCK0"},
+                                    {"relu2", "MOCK0"},
+                                    {"relu3", "MOCK1"},
+                                    {"relu4", "MOCK1"},
+                                    {"res", "MOCK1"}};
+    EXPECT_EQ(expected, affinities);
+    EXPECT_FLOAT_EQ(5.f, partitioner.get_estimated_cost());
+}
+
+TEST(CostPartitionerTest, balance_stages_splits_between_devices) {
+    CostPartitioner partitioner(create_test_model(), tensor_bytes);
+    auto affinities = partitioner.run({create_costs("MOCK0", {1, 1, 1, 1}), create_costs("MOCK1", {1, 1, 1, 1})},
+                                      PartitionPolicy::BALANCE_STAGES);
+    // a single device gives 4 ms, two stages give 2 ms and 2 ms with the transfer of 1 ms
+    EXPECT_NE(affinities.at("relu1"), affinities.at("relu4"));
+    EXPECT_EQ(affinities.at("relu1"), affinities.at("input"));
+    EXPECT_EQ(affinities.at("relu4"), affinities.at("res"));
+    EXPECT_NEAR(3.f, partitioner.get_estimated_cost(), 1e-3f);
+}
+
+TEST(CostPartitionerTest, balance_stages_fallback_to_min_latency) {
+    CostPartitioner partitioner(create_test_model(), tensor_bytes);
+    // the operations can be covered only by alternating devices
+    auto affinities = partitioner.run({create_costs("MOCK0", {1, -1, 1, -1}), create_costs("MOCK1", {-1, 1, -1, 1})},
+                                      PartitionPolicy::BALANCE_STAGES);
+    EXPECT_EQ("MOCK0", affinities.at("relu1"));
+    EXPECT_EQ("MOCK1", affinities.at("relu2"));
+    EXPECT_EQ("MOCK0", affinities.at("relu3"));
+    EXPECT_EQ("MOCK1", affinities.at("relu4"));
+    EXPECT_FLOAT_EQ(7.f, partitioner.get_estimated_cost());
+}
+
+TEST(CostPartitionerTest, unsupported_operation_throw) {
+    CostPartitioner partitioner(create_test_model(), tensor_bytes);
+    EXPECT_THROW(partitioner.run({create_costs("MOCK0", {1, -1, 1, 1}), create_costs("MOCK1", {1, -1, 1, 1})},
+                                 PartitionPolicy::MIN_LATENCY),
+                 ov::Exception);
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+using namespace ov::hetero;
+
+TEST(PipelineLimiterTest, runs_tasks_up_to_limit) {
+    PipelineLimiter limiter(2);
+    std::vector<int> executed;
+    for (int i = 0; i < 4; i++) {
+        limiter.run([&executed, i] {
+            executed.push_back(i);
+        });
+    }
+    EXPECT_EQ(std::vector<int>({0, 1}), executed);
+    EXPECT_EQ(2, limiter.get_in_flight());
+    EXPECT_EQ(2, limiter.get_waiting());
+
+    // released slot is passed to the first waiting task
+    limiter.release();
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), executed);
+    EXPECT_EQ(2, limiter.get_in_flight());
+    EXPECT_EQ(1, limiter.get_waiting());
+
+    limiter.release();
+    limiter.release();
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3}), executed);
+    EXPECT_EQ(1, limiter.get_in_flight());
+    EXPECT_EQ(0, limiter.get_waiting());
+
+    limiter.release();
+    EXPECT_EQ(0, limiter.get_in_flight());
+    EXPECT_THROW(limiter.release(), ov::Exception);
+}
+
+TEST(PipelineLimiterTest, zero_limit_throw) {
+    EXPECT_THROW(PipelineLimiter(0), ov::Exception);
+}
+
+TEST(PipelineStageStatisticsTest, average_latency) {
+    PipelineStageStatistics statistics;
+    EXPECT_EQ(0.f, statistics.get_average_ms());
+    statistics.add(std::chrono::milliseconds(2));
+    statistics.add(std::chrono::milliseconds(4));
+    EXPECT_FLOAT_EQ(3.f, statistics.get_average_ms());
+}
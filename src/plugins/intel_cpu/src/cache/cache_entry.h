@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -17,7 +18,15 @@ class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual Statistics getStatistics() const = 0;
 };
 
 /**
@@ -26,7 +35,7 @@ public:
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
  * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * KeyType&) interface, getCapacity() and getEvictions() methods and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -50,6 +59,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -61,11 +71,22 @@ public:
             if (retVal != retEmpty) {
                 _impl.put(key, retVal);
             }
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] Statistics getStatistics() const override {
+        return {_hits.load(std::memory_order_relaxed), _misses.load(std::memory_order_relaxed), _impl.getEvictions()};
+    }
+
     ImplType _impl;
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 }  // namespace ov::intel_cpu
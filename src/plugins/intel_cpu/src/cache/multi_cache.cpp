@@ -5,9 +5,52 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <typeinfo>
+
+#ifndef _WIN32
+#    include <cxxabi.h>
+#endif
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+std::string MultiCache::getEntryName(const std::type_info& keyType) {
+    std::string name = keyType.name();
+#ifndef _WIN32
+    int status = 0;
+    std::unique_ptr<char, void (*)(void*)> demangled_name(abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status),
+                                                          std::free);
+    if (status == 0 && demangled_name) {
+        name = demangled_name.get();
+    }
+#endif
+    // keep only the unqualified type name to make the statistics readable
+    const auto templateArgsPos = name.find('<');
+    const auto scopePos = name.rfind("::", templateArgsPos);
+    if (scopePos != std::string::npos) {
+        name = name.substr(scopePos + 2);
+    }
+    return name;
+}
+
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics statistics;
+    std::shared_lock<std::shared_mutex> lock(_storageMutex);
+    for (const auto& [id, record] : _storage) {
+        const auto entryStatistics = record.entry->getStatistics();
+        // different Value types may be cached under the same Key type
+        auto& accumulated = statistics[record.name];
+        accumulated.hits += entryStatistics.hits;
+        accumulated.misses += entryStatistics.misses;
+        accumulated.evictions += entryStatistics.evictions;
+    }
+    return statistics;
+}
+
 }  // namespace ov::intel_cpu
@@ -6,18 +6,25 @@
 
 #include <atomic>
 #include <cstddef>
+#include <map>
 #include <memory>
+#include <shared_mutex>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "lru_cache.h"
+#include "sharded_lru_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is constructed with the threadSafe flag set.
+ * The thread safe cache is based on the sharded (lock striped) LRU storage and may be shared between streams.
  */
 
 class MultiCache {
@@ -28,11 +35,19 @@ public:
     template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
+    using Statistics = std::map<std::string, CacheEntryBase::Statistics>;
+
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param threadSafe defines whether the cache may be accessed from several threads simultaneously.
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _threadSafe(other._threadSafe) {
+        std::shared_lock<std::shared_mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,19 +62,42 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+        if (_threadSafe) {
+            auto entry = getEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    [[nodiscard]] bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
+    /**
+     * @brief Collects hit/miss/eviction counters of all the entries
+     * @return map of the statistics, where the key is the entry name (the entry Key type name)
+     */
+    [[nodiscard]] Statistics getStatistics() const;
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>>
+    std::shared_ptr<CacheEntry<KeyType, ValueType, ImplType>> getEntry();
+
+    static std::string getEntryName(const std::type_info& keyType);
+
+    struct EntryRecord {
+        EntryBasePtr entry;
+        std::string name;
+    };
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
-    std::unordered_map<size_t, EntryBasePtr> _storage;
+    bool _threadSafe;
+    mutable std::shared_mutex _storageMutex;
+    std::unordered_map<size_t, EntryRecord> _storage;
 };
 
 template <typename T>
@@ -68,16 +106,29 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename KeyType, typename ValueType, typename ImplType>
+std::shared_ptr<CacheEntry<KeyType, ValueType, ImplType>> MultiCache::getEntry() {
+    using EntryType = CacheEntry<KeyType, ValueType, ImplType>;
     size_t id = getTypeId<EntryType>();
+    // read-mostly access: the entries are created only once per Key/Value types pair
+    {
+        std::shared_lock<std::shared_mutex> lock(_storageMutex, std::defer_lock);
+        if (_threadSafe) {
+            lock.lock();
+        }
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second.entry);
+        }
+    }
+    // the insertion is always guarded to allow the statistics collection from another thread
+    std::unique_lock<std::shared_mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, {std::make_shared<EntryType>(_capacity), getEntryName(typeid(KeyType))}});
         itr = result.first;
     }
-    return std::static_pointer_cast<EntryType>(itr->second);
+    return std::static_pointer_cast<EntryType>(itr->second.entry);
 }
 
 using MultiCacheWeakPtr = std::weak_ptr<MultiCache>;
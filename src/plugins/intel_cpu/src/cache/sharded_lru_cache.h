@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy based on the lock striping technique.
+ * The key space is split into a number of shards, each of them is an independent LruCache protected by its own mutex,
+ * so the concurrent accesses to the different shards do not contend.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU eviction policy is applied per shard, so it is only an approximation of the global LRU policy.
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t defaultShardsNum = 16;
+
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        // do not create more shards than records, otherwise the capacity is exceeded
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, capacity));
+        const size_t shardCapacity = capacity / shardsNum;
+        const size_t remainder = capacity % shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity + (i < remainder ? 1 : 0)));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the total number of the records evicted from all the shards
+     * @return the number of evicted records
+     */
+    [[nodiscard]] size_t getEvictions() const {
+        size_t evictions = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            evictions += shard->cache.getEvictions();
+        }
+        return evictions;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        auto hash = static_cast<size_t>(key.hash());
+        // the low bits are also used for the buckets selection inside the shard, so mix the high bits in
+        hash ^= hash >> 17;
+        return *_shards[hash % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}  // namespace ov::intel_cpu
@@ -5,15 +5,20 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "graph_context.h"
@@ -23,11 +28,14 @@
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/symbol.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
@@ -50,6 +58,93 @@ using namespace ov::threading;
 
 namespace ov::intel_cpu {
 
+namespace {
+constexpr int64_t unbounded = std::numeric_limits<int64_t>::max();
+
+// Checks the shapes by the shape inference of a model copy, so the warm-up does not run the shapes inconsistent across
+// the inputs, e.g. the different sequence lengths of the LLM inputs
+bool are_consistent_input_shapes(const ov::Model& model, const InputShapes& input_shapes) {
+    const auto model_copy = model.clone();
+    const auto& parameters = model_copy->get_parameters();
+    try {
+        for (size_t i = 0; i < parameters.size(); ++i) {
+            parameters[i]->set_partial_shape(input_shapes[i]);
+        }
+        model_copy->validate_nodes_and_infer_types();
+    } catch (const std::exception&) {
+        return false;
+    }
+    return std::all_of(model_copy->outputs().begin(), model_copy->outputs().end(), [](const ov::Output<ov::Node>& out) {
+        return out.get_partial_shape().is_static();
+    });
+}
+
+// The bounds of the dynamic model input shapes: the lower one (the zero lower bounds are taken as 1) and the upper
+// one if all the dimensions are bounded and it is not too large. The dimensions of the same symbol, e.g. the batch
+// shared by the inputs, take the same value. The static models and the models with the bounds contradicting the
+// symbols or the shape inference are not warmed up.
+std::vector<InputShapes> get_declared_input_shapes(const ov::Model& model) {
+    constexpr size_t max_warmup_input_size = 16 * 1024 * 1024;
+    if (!model.is_dynamic()) {
+        return {};
+    }
+    for (const auto& input : model.inputs()) {
+        if (input.get_partial_shape().rank().is_dynamic()) {
+            return {};
+        }
+    }
+
+    // the bounds of the dimension intersected with the bounds of all the dimensions of its symbol
+    std::map<std::shared_ptr<ov::Symbol>, std::pair<int64_t, int64_t>> symbol_bounds;
+    auto dim_bounds = [](const ov::Dimension& dim) {
+        const auto max_length = dim.get_max_length();
+        return std::make_pair(dim.get_min_length(), max_length < 0 ? unbounded : max_length);
+    };
+    for (const auto& input : model.inputs()) {
+        for (const auto& dim : input.get_partial_shape()) {
+            if (const auto& symbol = dim.get_symbol()) {
+                const auto bounds = dim_bounds(dim);
+                auto inserted = symbol_bounds.emplace(ov::symbol::ancestor_of(symbol), bounds);
+                auto& tied_bounds = inserted.first->second;
+                tied_bounds.first = std::max(tied_bounds.first, bounds.first);
+                tied_bounds.second = std::min(tied_bounds.second, bounds.second);
+            }
+        }
+    }
+
+    InputShapes lower_shapes;
+    InputShapes upper_shapes;
+    bool upper_bounded = true;
+    for (const auto& input : model.inputs()) {
+        ov::Shape lower_shape;
+        ov::Shape upper_shape;
+        for (const auto& dim : input.get_partial_shape()) {
+            const auto& symbol = dim.get_symbol();
+            const auto [min_length, max_length] =
+                symbol ? symbol_bounds.at(ov::symbol::ancestor_of(symbol)) : dim_bounds(dim);
+            if (min_length > max_length) {
+                return {};
+            }
+            lower_shape.push_back(static_cast<size_t>(max_length == 0 ? 0 : std::max<int64_t>(min_length, 1)));
+            upper_bounded = upper_bounded && max_length != unbounded;
+            upper_shape.push_back(static_cast<size_t>(max_length == unbounded ? 0 : max_length));
+        }
+        upper_bounded = upper_bounded && ov::shape_size(upper_shape) <= max_warmup_input_size;
+        lower_shapes.push_back(std::move(lower_shape));
+        upper_shapes.push_back(std::move(upper_shape));
+    }
+
+    std::vector<InputShapes> declared_shapes;
+    if (are_consistent_input_shapes(model, lower_shapes)) {
+        declared_shapes.push_back(lower_shapes);
+    }
+    if (upper_bounded && upper_shapes != lower_shapes && are_consistent_input_shapes(model, upper_shapes)) {
+        declared_shapes.push_back(std::move(upper_shapes));
+    }
+    return declared_shapes;
+}
+}  // namespace
+
 struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -116,6 +211,11 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
+    if (m_cfg.rtCacheShared) {
+        m_sharedRtParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true);
+        m_sharedSnippetsParamsCache = std::make_shared<MultiCache>(m_cfg.snippetsCacheCapacity, true);
+    }
+
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
@@ -170,6 +270,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                 std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
         }
     }
+    if (m_cfg.rtCacheWarmup && !m_loaded_from_cache) {
+        // in the cache_dir flow the blob is exported right after the compilation, before any inference is recorded
+        for (auto& input_shapes : get_declared_input_shapes(*model)) {
+            record_input_shapes(std::move(input_shapes));
+        }
+    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
@@ -202,7 +308,9 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedRtParamsCache,
+                                                         m_sharedSnippetsParamsCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -224,6 +332,77 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     return graphLock;
 }
 
+MultiCache::Statistics CompiledModel::get_runtime_cache_statistics() const {
+    std::set<MultiCache*> caches;
+    for (const auto& graph : m_graphs) {
+        if (!graph.IsReady()) {
+            continue;
+        }
+        const auto& ctx = graph.getGraphContext();
+        caches.insert(ctx->getParamsCache().get());
+        caches.insert(ctx->getPrivateParamsCache().get());
+        caches.insert(ctx->getSnippetsParamsCache().get());
+    }
+
+    MultiCache::Statistics statistics;
+    for (const auto* cache : caches) {
+        for (const auto& [name, entryStatistics] : cache->getStatistics()) {
+            auto& accumulated = statistics[name];
+            accumulated.hits += entryStatistics.hits;
+            accumulated.misses += entryStatistics.misses;
+            accumulated.evictions += entryStatistics.evictions;
+        }
+    }
+    return statistics;
+}
+
+void CompiledModel::record_input_shapes(InputShapes input_shapes) const {
+    std::lock_guard<std::mutex> lock(m_warmup_mutex);
+    if (m_warmup_shapes.size() >= maxWarmupShapes ||
+        std::find(m_warmup_shapes.begin(), m_warmup_shapes.end(), input_shapes) != m_warmup_shapes.end()) {
+        return;
+    }
+    m_warmup_shapes.push_back(std::move(input_shapes));
+}
+
+void CompiledModel::warm_up(const std::vector<InputShapes>& warmup_shapes) {
+    const auto& model_inputs = inputs();
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    for (const auto& input_shapes : warmup_shapes) {
+        // the blob may be produced for the other model inputs, so the incompatible records are just skipped
+        if (input_shapes.size() != model_inputs.size()) {
+            continue;
+        }
+        bool compatible = true;
+        for (size_t i = 0; i < model_inputs.size(); i++) {
+            compatible = compatible && model_inputs[i].get_partial_shape().compatible(input_shapes[i]);
+        }
+        if (!compatible) {
+            continue;
+        }
+        record_input_shapes(input_shapes);
+
+        // one request per stream, so each stream (or the shared cache) gets the runtime parameters for the shapes
+        requests.clear();
+        for (size_t stream = 0; stream < m_graphs.size(); stream++) {
+            auto request = create_infer_request();
+            for (size_t i = 0; i < model_inputs.size(); i++) {
+                const auto& type = model_inputs[i].get_element_type();
+                auto tensor = ov::make_tensor(type, input_shapes[i]);
+                if (type != ov::element::string) {
+                    std::memset(tensor->data(), 0, tensor->get_byte_size());
+                }
+                request->set_tensor(model_inputs[i], tensor);
+            }
+            request->start_async();
+            requests.push_back(std::move(request));
+        }
+        for (const auto& request : requests) {
+            request->wait();
+        }
+    }
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
     return std::make_shared<SyncInferRequest>(
         CompiledModelHolder(std::static_pointer_cast<const CompiledModel>(shared_from_this())));
@@ -298,6 +477,11 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::log::level.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
+            RO_property(ov::intel_cpu::enable_inter_op_parallel.name()),
+            RO_property(ov::intel_cpu::enable_lm_head_slicing.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_warmup.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
             RO_property(ov::hint::kv_cache_precision.name()),
             RO_property(ov::key_cache_precision.name()),
@@ -381,6 +565,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const auto& enable_tensor_parallel = config.enableTensorParallel;
         return enable_tensor_parallel;
     }
+    if (name == ov::intel_cpu::enable_inter_op_parallel) {
+        const auto& enable_inter_op_parallel = config.enableInterOpParallel;
+        return enable_inter_op_parallel;
+    }
+    if (name == ov::intel_cpu::enable_lm_head_slicing) {
+        const auto& enable_lm_head_slicing = config.enableLMHeadSlicing;
+        return enable_lm_head_slicing;
+    }
     if (name == ov::hint::dynamic_quantization_group_size) {
         return static_cast<decltype(ov::hint::dynamic_quantization_group_size)::value_type>(
             config.fcDynamicQuantizationGroupSize);
@@ -400,11 +592,31 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::value_cache_group_size) {
         return static_cast<decltype(ov::value_cache_group_size)::value_type>(config.valueCacheGroupSize);
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_shared) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_shared)::value_type>(config.rtCacheShared);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_warmup) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_warmup)::value_type>(config.rtCacheWarmup);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type statistics;
+        for (const auto& [entryName, entryStatistics] : get_runtime_cache_statistics()) {
+            statistics[entryName + ".hits"] = entryStatistics.hits;
+            statistics[entryName + ".misses"] = entryStatistics.misses;
+            statistics[entryName + ".evictions"] = entryStatistics.evictions;
+        }
+        return statistics;
+    }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
+    std::vector<InputShapes> warmup_shapes;
+    if (m_cfg.rtCacheWarmup) {
+        std::lock_guard<std::mutex> lock(m_warmup_mutex);
+        warmup_shapes = m_warmup_shapes;
+    }
+    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, warmup_shapes);
     serializer << m_model;
 }
 
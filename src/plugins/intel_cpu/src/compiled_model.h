@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
@@ -24,6 +25,7 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/serialize.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -67,6 +69,12 @@ public:
         return m_name;
     }
 
+    /**
+     * @brief Replays the inferences with the given input shapes on each stream to populate the runtime caches.
+     * The shapes are also kept to be stored in the blob on the next export.
+     */
+    void warm_up(const std::vector<InputShapes>& warmup_shapes);
+
 private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class CompiledModelHolder;
@@ -87,6 +95,9 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // runtime caches shared between the streams (if cpu_runtime_cache_shared is set)
+    MultiCachePtr m_sharedRtParamsCache = nullptr;
+    MultiCachePtr m_sharedSnippetsParamsCache = nullptr;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,6 +105,16 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    MultiCache::Statistics get_runtime_cache_statistics() const;
+
+    // remembers the input shapes of a dynamic model inference to be stored in the blob (if cpu_runtime_cache_warmup)
+    void record_input_shapes(InputShapes input_shapes) const;
+
+    // the upper bound of the number of the distinct input shapes stored for the warm-up
+    static constexpr size_t maxWarmupShapes = 64;
+    mutable std::mutex m_warmup_mutex;
+    mutable std::vector<InputShapes> m_warmup_shapes;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -152,6 +173,14 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] bool records_input_shapes() const {
+        return m_compiled_model->m_cfg.rtCacheWarmup;
+    }
+
+    void record_input_shapes(InputShapes input_shapes) const {
+        m_compiled_model->record_input_shapes(std::move(input_shapes));
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
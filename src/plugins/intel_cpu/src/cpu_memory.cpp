@@ -38,6 +38,7 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <sys/mman.h>
 #    include <unistd.h>
 
 #    include <cstring> /* strerror(errno) */
@@ -289,6 +290,71 @@ void MemoryBlockWithReuse::destroy(void* ptr) {
     dnnl::impl::free(ptr);
 }
 
+/////////////// GrowableMemoryBlock ///////////////
+
+GrowableMemoryBlock::~GrowableMemoryBlock() {
+    if (!m_data) {
+        return;
+    }
+#if defined(__linux__)
+    munmap(m_data, m_size);
+#else
+    dnnl::impl::free(m_data);
+#endif
+}
+
+void* GrowableMemoryBlock::getRawPtr() const noexcept {
+    return m_data;
+}
+
+void GrowableMemoryBlock::setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) {
+    OPENVINO_THROW("GrowableMemoryBlock does not support external buffers");
+}
+
+bool GrowableMemoryBlock::resize(size_t size) {
+    if (size <= m_size) {
+        return false;
+    }
+#if defined(__linux__)
+    const auto pagesize = static_cast<size_t>(getpagesize());
+    const size_t newSize = rnd_up(size, pagesize);
+    // the pages are remapped by the kernel, the stored data is neither copied nor duplicated
+    void* ptr = m_data ? mremap(m_data, m_size, newSize, MREMAP_MAYMOVE)
+                       : mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    OPENVINO_ASSERT(ptr != MAP_FAILED, "Failed to allocate ", newSize, " bytes of memory: ", strerror(errno));
+    // the remapped pages keep their placement, only the appended ones are bound before the first touch
+    if (numa_node >= 0) {
+        if (!mbind_move(static_cast<char*>(ptr) + m_size, newSize - m_size, numa_node)) {
+            DEBUG_LOG("GrowableMemoryBlock move_memory to node ", numa_node, " failed\n");
+        }
+    }
+#else
+    constexpr int cacheLineSize = 64;
+    const size_t newSize = size;
+    void* ptr = dnnl::impl::malloc(newSize, cacheLineSize);
+    OPENVINO_ASSERT(ptr, "Failed to allocate ", newSize, " bytes of memory");
+    if (m_data) {
+        cpu_memcpy(ptr, m_data, m_size);
+        dnnl::impl::free(m_data);
+    }
+#endif
+    m_data = ptr;
+    m_size = newSize;
+    return true;
+}
+
+bool GrowableMemoryBlock::hasExtBuffer() const noexcept {
+    return false;
+}
+
+bool GrowableMemoryBlock::growsInPlace() {
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
 /////////////// StringMemory ///////////////
 
 StringMemory::StringMemory(dnnl::engine engine, MemoryDescPtr desc, const void* data)
@@ -96,6 +96,36 @@ private:
     static void destroy(void* ptr);
 };
 
+/**
+ * @brief An implementation of the mem block which keeps the stored data on growth, so the buffers appended along the
+ * outermost dimension (e.g. KV cache) may be extended without reallocation in the user code.
+ * On Linux the memory is mapped by pages and the growth remaps them instead of copying the data, so its cost depends on
+ * the appended size only. On the other platforms the data is copied to a new buffer.
+ * The memory is bound to the NUMA node if it is specified.
+ */
+class GrowableMemoryBlock : public IMemoryBlock {
+public:
+    explicit GrowableMemoryBlock(int numa_node = -1) : numa_node(numa_node) {}
+    GrowableMemoryBlock(const GrowableMemoryBlock&) = delete;
+    GrowableMemoryBlock& operator=(const GrowableMemoryBlock&) = delete;
+    ~GrowableMemoryBlock() override;
+
+    [[nodiscard]] void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    [[nodiscard]] bool hasExtBuffer() const noexcept override;
+
+    /**
+     * @brief Check if the growth keeps the data in place (remaps the pages) instead of copying it
+     */
+    static bool growsInPlace();
+
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0UL;
+    int numa_node;
+};
+
 class IMemoryBlockObserver : public IMemoryBlock {
 public:
     virtual void registerMemory(Memory* memPtr) = 0;
@@ -264,7 +264,9 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"QKVProjection", Type::QKVProjection},
         {"RMS", Type::RMS},
         {"SearchSorted", Type::SearchSorted},
-        {"LoraSubgraph", Type::LoRA}};
+        {"LoraSubgraph", Type::LoRA},
+        {"Sampling", Type::Sampling},
+        {"MoE", Type::MoE}};
     return type_to_name_tbl;
 }
 
@@ -398,6 +400,8 @@ std::string NameFromType(const Type type) {
         CASE(SearchSorted);
         CASE(SegmentMax);
         CASE(LoRA);
+        CASE(Sampling);
+        CASE(MoE);
         CASE(Unknown);
     }
 #undef CASE
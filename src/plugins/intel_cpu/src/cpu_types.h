@@ -136,7 +136,9 @@ enum class Type : uint8_t {
     RMS,
     SearchSorted,
     SegmentMax,
-    LoRA
+    LoRA,
+    Sampling,
+    MoE
 };
 
 enum class Algorithm : uint8_t {
@@ -906,11 +906,164 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         }
     } else {
         status = Status::ReadyStatic;
+        m_executableLevelsInds = ExtractExecutableLevels(graphNodes, m_graphNodesLevels, m_executableGraphNodes);
+
+        size_t maxLevelSize = 0;
+        for (size_t level = 0; level + 1 < m_executableLevelsInds.size(); level++) {
+            maxLevelSize = std::max(maxLevelSize, m_executableLevelsInds[level + 1] - m_executableLevelsInds[level]);
+        }
+        // nothing to execute concurrently, fallback to the sequential execution
+        if (maxLevelSize < 2) {
+            m_executableLevelsInds.clear();
+        }
+
+        m_interOpStreams.clear();
+        for (size_t i = 0; i < maxLevelSize && !m_executableLevelsInds.empty(); i++) {
+            m_interOpStreams.emplace_back(getEngine());
+        }
+    }
+
+    if (getConfig().enableInterOpParallel) {
+        AssignScratchPads();
     }
 
     return syncNodesInds;
 }
 
+void Graph::AssignScratchPads() {
+    // the graph may be nested into a node executed concurrently with the other ones, so even a sequential graph does
+    // not share the scratch pad with the rest of the graphs. The nodes of a level use one scratch pad per position.
+    const size_t numScratchPads = m_executableLevelsInds.empty() ? 1 : m_interOpStreams.size();
+    if (m_numScratchPads < numScratchPads) {
+        m_firstScratchPad = m_context->reserveScratchPads(numScratchPads);
+        m_numScratchPads = numScratchPads;
+    }
+
+    for (const auto& node : graphNodes) {
+        node->setScratchPadSlot(m_firstScratchPad);
+    }
+    for (size_t level = 0; level + 1 < m_executableLevelsInds.size(); level++) {
+        for (size_t i = m_executableLevelsInds[level]; i < m_executableLevelsInds[level + 1]; i++) {
+            m_executableGraphNodes[i]->setScratchPadSlot(m_firstScratchPad + i - m_executableLevelsInds[level]);
+        }
+    }
+}
+
+void Graph::SortByExecutionLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::SortByExecutionLevels");
+
+    // the dependencies not expressed by the edges
+    // a node modifying the memory in-place must be executed after all the other consumers of this memory
+    // (such consumers are guaranteed to precede the modifying node in the topological order by
+    // ResolveComplexInplaceConflicts)
+    std::unordered_map<NodePtr, std::vector<NodePtr>> extraDependencies;
+    for (const auto& edge : graphEdges) {
+        const auto portChildEdges = edge->getParent()->getChildEdgesAtPort(edge->getInputNum());
+        if (portChildEdges.size() < 2) {
+            continue;
+        }
+        auto modifyingNode = edge->modifiedInPlace();
+        if (!modifyingNode) {
+            continue;
+        }
+        for (const auto& peerEdge : portChildEdges) {
+            if (peerEdge == edge) {
+                continue;
+            }
+            std::vector<NodePtr> consumers;
+            peerEdge->collectConsumers(consumers);
+            for (const auto& consumer : consumers) {
+                if (consumer != modifyingNode && consumer->getExecIndex() < modifyingNode->getExecIndex()) {
+                    extraDependencies[modifyingNode].push_back(consumer);
+                }
+            }
+        }
+    }
+
+    // a MemoryOutput commits the state read by its MemoryInput, so it must be executed after the latter
+    // (the MemoryInput nodes go first in the topological order, see SortTopologically)
+    std::unordered_map<std::string, NodePtr> memoryInputs;
+    for (const auto& node : graphNodes) {
+        if (const auto* memoryInput = dynamic_cast<const node::MemoryInputBase*>(node.get())) {
+            memoryInputs.emplace(memoryInput->getId(), node);
+        }
+    }
+    for (const auto& node : graphNodes) {
+        if (const auto* memoryOutput = dynamic_cast<const node::MemoryOutputBase*>(node.get())) {
+            if (auto it = memoryInputs.find(memoryOutput->getId()); it != memoryInputs.end()) {
+                extraDependencies[node].push_back(it->second);
+            }
+        }
+    }
+
+    // graph nodes are expected to be topologically sorted, so the levels of all the dependencies are already known
+    std::unordered_map<NodePtr, size_t> levels;
+    for (const auto& node : graphNodes) {
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            level = std::max(level, levels.at(node->getParentEdgeAt(i)->getParent()) + 1);
+        }
+        if (auto it = extraDependencies.find(node); it != extraDependencies.end()) {
+            for (const auto& dependency : it->second) {
+                level = std::max(level, levels.at(dependency) + 1);
+            }
+        }
+        levels[node] = level;
+    }
+
+    // stable sort keeps the topological order inside a level, so the sequential execution stays valid
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [&levels](const NodePtr& lhs, const NodePtr& rhs) {
+        return levels.at(lhs) < levels.at(rhs);
+    });
+
+    m_graphNodesLevels.clear();
+    m_graphNodesLevels.reserve(graphNodes.size());
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        graphNodes[i]->execIndex = static_cast<int>(i);
+        m_graphNodesLevels.push_back(levels.at(graphNodes[i]));
+    }
+}
+
+std::vector<std::pair<int, int>> Graph::GetExecutionLevelsRanges(const GlobalExecutionIndex& globalExecIndex) const {
+    std::vector<std::pair<int, int>> ranges;
+    for (size_t i = 0; i < m_graphNodesLevels.size(); i++) {
+        const auto& [inputExecIndex, outputExecIndex] = globalExecIndex.at(graphNodes[i]);
+        if (ranges.size() <= m_graphNodesLevels[i]) {
+            ranges.resize(m_graphNodesLevels[i] + 1,
+                          {std::numeric_limits<int>::max(), std::numeric_limits<int>::min()});
+        }
+        auto& range = ranges[m_graphNodesLevels[i]];
+        range.first = std::min(range.first, inputExecIndex);
+        range.second = std::max(range.second, outputExecIndex);
+    }
+
+    return ranges;
+}
+
+static std::vector<size_t> ExtractExecutableLevels(const std::vector<NodePtr>& graphNodes,
+                                                   const std::vector<size_t>& graphNodesLevels,
+                                                   const std::vector<NodePtr>& executableGraphNodes) {
+    std::vector<size_t> levelsInds;
+    if (graphNodesLevels.empty()) {
+        return levelsInds;
+    }
+    // executable nodes are a subsequence of the graph nodes
+    size_t prevLevel = 0;
+    for (size_t i = 0, execIdx = 0; i < graphNodes.size() && execIdx < executableGraphNodes.size(); i++) {
+        if (graphNodes[i] != executableGraphNodes[execIdx]) {
+            continue;
+        }
+        if (execIdx == 0 || graphNodesLevels[i] != prevLevel) {
+            levelsInds.push_back(execIdx);
+        }
+        prevLevel = graphNodesLevels[i];
+        execIdx++;
+    }
+    levelsInds.push_back(executableGraphNodes.size());
+
+    return levelsInds;
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -1040,7 +1193,21 @@ static void ValidateEdgeClusters(const EdgeClusters& clusters, size_t remaining)
 
 static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                        size_t remaining,
-                                       const GlobalExecutionIndex& globalExecIndex) {
+                                       const GlobalExecutionIndex& globalExecIndex,
+                                       const std::vector<std::pair<int, int>>& executionLevels) {
+    // nodes of the same execution level may run concurrently, so a memory region
+    // must stay alive from the beginning of its first level till the end of its last level
+    auto levelRange = [&executionLevels](int execIndex) {
+        auto it = std::upper_bound(executionLevels.begin(),
+                                   executionLevels.end(),
+                                   execIndex,
+                                   [](int value, const std::pair<int, int>& range) {
+                                       return value < range.first;
+                                   });
+        OPENVINO_ASSERT(it != executionLevels.begin(), "Execution index ", execIndex, " is out of levels range");
+        return *std::prev(it);
+    };
+
     auto isConstOutput = [](const EdgePtr& edge) {
         return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
     };
@@ -1107,6 +1274,11 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
 
         reg.size = boxSize;
 
+        if (!executionLevels.empty()) {
+            reg.start = levelRange(reg.start).first;
+            reg.finish = levelRange(reg.finish).second;
+        }
+
         if (isConst) {
             reg.type = MemoryRegion::RegionType::CONSTANT;
         } else if (isInput) {
@@ -1146,7 +1318,8 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     const std::shared_ptr<MemoryControl>& memoryControl,
     const AllocationContext& allocationContext,
     const GraphContext::CPtr& graphContext,
-    const std::vector<NodePtr>& outputNodes) {
+    const std::vector<NodePtr>& outputNodes,
+    const std::vector<std::pair<int, int>>& executionLevels) {
     const auto& edges = allocationContext.edges;
 
     auto edgeClusters = FormEdgeClusters(edges);
@@ -1161,7 +1334,7 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     Graph::OutputMemoryBlocks outputNodesMemBlocks;
     std::tie(remaining, outputNodesMemBlocks) = AllocateDynamicOutputEdges(edgeClusters, remaining, outputNodes);
 
-    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex);
+    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex, executionLevels);
 
     memoryControl->insert(memoryRegions, allocationContext.syncPoints);
     auto memoryBlocks = memoryControl->solve();
@@ -1169,6 +1342,16 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     return std::make_tuple(memoryBlocks, edgeClusters, outputNodesMemBlocks);
 }
 
+static constexpr bool InterOpParallelSupported() {
+    // concurrent nodes rely on the nested parallelism of the threading runtime,
+    // which is not available for OMP (nested regions are serialized)
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    return true;
+#else
+    return false;
+#endif
+}
+
 void Graph::Allocate() {
     auto memoryControl = m_context->getMemoryControl();
 
@@ -1176,16 +1359,22 @@ void Graph::Allocate() {
         return;  // memory is already allocated globally
     }
 
+    if (InterOpParallelSupported() && getConfig().enableInterOpParallel && !ProcessDynNodes()) {
+        SortByExecutionLevels();
+    }
+
     AllocationContext allocationContext;
     RegisterToAllocationContext(0, allocationContext);
 
     const auto& edges = allocationContext.edges;
     InitEdgeStatus(edges);
 
+    const auto executionLevels = GetExecutionLevelsRanges(allocationContext.execIndex);
+
     MemoryControl::MemorySolution solution;
     EdgeClusters edgeClusters;
     std::tie(solution, edgeClusters, m_outputNodesMemBlocks) =
-        SolveMemoryReuse(memoryControl, allocationContext, m_context, outputNodes);
+        SolveMemoryReuse(memoryControl, allocationContext, m_context, outputNodes, executionLevels);
 
     AllocateBaseEdges(edgeClusters, solution);
 
@@ -1351,11 +1540,32 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
 }
 
 void Graph::InferStatic(SyncInferRequest* request, int numaId) {
+    if (!m_executableLevelsInds.empty()) {
+        InferStaticInterOp(request, numaId);
+        return;
+    }
+
     for (const auto& node : m_executableGraphNodes) {
         ExecuteNodeWithCatch(node, request, numaId);
     }
 }
 
+void Graph::InferStaticInterOp(SyncInferRequest* request, int numaId) {
+    for (size_t level = 0; level + 1 < m_executableLevelsInds.size(); level++) {
+        const auto levelBegin = m_executableLevelsInds[level];
+        const auto levelSize = m_executableLevelsInds[level + 1] - levelBegin;
+
+        if (levelSize == 1) {
+            ExecuteNodeWithCatch(m_executableGraphNodes[levelBegin], request, numaId);
+            continue;
+        }
+        // independent nodes are dispatched to the stream's arena, the intra-op parallelism of each node is nested
+        parallel_for(levelSize, [&](size_t i) {
+            ExecuteNodeWithCatch(m_executableGraphNodes[levelBegin + i], m_interOpStreams[i], request, numaId);
+        });
+    }
+}
+
 namespace {
 
 class UpdateNodesSeq {
@@ -1597,19 +1807,29 @@ public:
     OV_ITT_SCOPED_TASK(ittScope, (node)->profiling.execute);    \
     DEBUG_LOG(*(node));
 
-inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& stream,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(stream, numaId);
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& stream,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::intel_cpu, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, stream, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -2006,7 +2226,8 @@ void Graph::EnforceInferencePrecision() {
                            Type::Interpolate,     // super resolution nets
                            Type::PagedAttention,  // page attention
                            Type::QKVProjection,
-                           Type::LLMMLP)) {
+                           Type::LLMMLP,
+                           Type::MoE)) {
                     continue;  // stop at significant nodes
                 }
             }
@@ -11,6 +11,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
@@ -297,6 +298,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_graphNodesLevels.clear();
+        m_executableLevelsInds.clear();
+        m_interOpStreams.clear();
     }
     Status status{Status::NotReady};
 
@@ -328,6 +332,23 @@ protected:
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
     void CreatePrimitivesAndExecConstants() const;
     std::vector<size_t> CreateExecutionGraph();
+    // reserves the scratch pads for the concurrently executed nodes and assigns them to the nodes
+    void AssignScratchPads();
+
+    /**
+     * Reorder the graph nodes by execution levels, so the nodes without mutual dependencies are placed
+     * next to each other and can be executed concurrently (inter-op parallelism).
+     * A level of a node is the length of the longest dependency path from the graph roots to the node.
+     * Besides data dependencies, a node which modifies its input memory in-place depends on all the other
+     * consumers of this memory.
+     */
+    void SortByExecutionLevels();
+    /**
+     * Convert the execution levels of the graph nodes into the global execution index ranges
+     * [first, last] (one per level), which are used to extend the lifetime of the memory regions
+     * to the whole level, since all the nodes of a level may be executed at the same time.
+     */
+    std::vector<std::pair<int, int>> GetExecutionLevelsRanges(const GlobalExecutionIndex& globalExecIndex) const;
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -338,6 +359,10 @@ protected:
      * @params numaId   Numa Id to be used for an execution
      */
     void ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& stream,
+                              SyncInferRequest* request = nullptr,
+                              int numaId = -1) const;
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -346,9 +371,13 @@ protected:
      * @params request  Current inference request, which is checked for cancelation
      * @params numaId   Numa Id to be used for an execution
      */
-    void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNode(const NodePtr& node,
+                     const dnnl::stream& stream,
+                     SyncInferRequest* request = nullptr,
+                     int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticInterOp(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -372,6 +401,15 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    // execution level of each node from graphNodes, empty if inter-op parallelism is not used
+    std::vector<size_t> m_graphNodesLevels;
+    // boundaries of the execution levels in m_executableGraphNodes (the last one is the number of executable nodes)
+    std::vector<size_t> m_executableLevelsInds;
+    // oneDNN streams for the nodes executed concurrently within a single level
+    std::vector<dnnl::stream> m_interOpStreams;
+    // scratch pads of the graph context reserved for the nodes of the graph
+    size_t m_firstScratchPad = 0;
+    size_t m_numScratchPads = 0;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
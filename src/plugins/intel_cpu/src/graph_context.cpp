@@ -25,11 +25,17 @@ GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr rtParamsCache,
+                           MultiCachePtr snippetsParamsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_rtParamsCache(rtParamsCache ? std::move(rtParamsCache)
+                                    : std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtPrivateParamsCache(m_config.rtCacheShared ? std::make_shared<MultiCache>(m_config.rtCacheCapacity)
+                                                    : m_rtParamsCache),
+      m_snippetsParamsCache(snippetsParamsCache ? std::move(snippetsParamsCache)
+                                                : std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
@@ -45,12 +51,23 @@ GraphContext::GraphContext(Config config,
             m_numNumaNodes = nNumaNodes;
         }
     }
+    reserveScratchPads(0);
+}
+
+size_t GraphContext::reserveScratchPads(size_t count) const {
+    const size_t first = m_numReservedScratchPads;
+    m_numReservedScratchPads += count;
     // primitive/executors can be shared across sub-stream
     // but scratch pad cannot be shared.
-    int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
-    for (int i = 0; i < numaNum; i++) {
-        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+    const int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
+    while (m_rtScratchPads.size() < std::max<size_t>(m_numReservedScratchPads, 1)) {
+        std::vector<DnnlScratchPadPtr> scratchPads;
+        for (int i = 0; i < numaNum; i++) {
+            scratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+        }
+        m_rtScratchPads.push_back(std::move(scratchPads));
     }
+    return first;
 }
 
 const dnnl::engine& GraphContext::getEngine() {
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <utility>
 #include <vector>
 
 #include "cache/multi_cache.h"
@@ -35,7 +37,9 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr rtParamsCache = nullptr,
+                 MultiCachePtr snippetsParamsCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -49,18 +53,35 @@ public:
         return m_rtParamsCache;
     }
 
+    // cache for the executors which keep the mutable state (scratch buffers, pointers to the node data), such
+    // executors must not be shared between the streams even if the runtime cache is shared
+    [[nodiscard]] MultiCachePtr getPrivateParamsCache() const {
+        return m_rtPrivateParamsCache;
+    }
+
     [[nodiscard]] MultiCachePtr getSnippetsParamsCache() const {
         return m_snippetsParamsCache;
     }
 
-    [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
-        return m_rtScratchPads[m_numaNodeId];
+    /**
+     * @brief Returns the scratch pad of the current NUMA node
+     * @param slot The scratch pad reserved by reserveScratchPads, the nodes executed concurrently use different ones
+     */
+    [[nodiscard]] DnnlScratchPadPtr getScratchPad(size_t slot = 0) const {
+        return m_rtScratchPads[slot][m_numaNodeId];
     }
 
-    [[nodiscard]] const std::vector<DnnlScratchPadPtr>& getScratchPads() const {
-        return m_rtScratchPads;
+    [[nodiscard]] std::vector<DnnlScratchPadPtr> getScratchPads(size_t slot = 0) const {
+        return m_rtScratchPads[slot];
     }
 
+    /**
+     * @brief Reserves the scratch pads for the nodes of a graph executed concurrently (inter-op parallelism).
+     * The pads are allocated once per graph, the first reservation gets the default scratch pad.
+     * @return The slot of the first reserved scratch pad
+     */
+    size_t reserveScratchPads(size_t count) const;
+
     static const dnnl::engine& getEngine();
 
     [[nodiscard]] bool isGraphQuantized() const {
@@ -79,6 +100,10 @@ public:
         return m_numNumaNodes;
     }
 
+    [[nodiscard]] int getNumaNodeId() const {
+        return m_numaNodeId;
+    }
+
     [[nodiscard]] const std::shared_ptr<node::MemoryStatesRegister>& getMemoryStatesRegister() const {
         return m_memoryStatesRegister;
     }
@@ -108,15 +133,18 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache (private for the graph or shared between all the streams of a compiled model)
     MultiCachePtr m_rtParamsCache;
+    // stream private primitive cache (the same object as m_rtParamsCache if the latter is private)
+    MultiCachePtr m_rtPrivateParamsCache;
     MultiCachePtr m_snippetsParamsCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
     bool m_isGraphQuantizedFlag = false;
-    // scratch pad per sub-stream
-    std::vector<DnnlScratchPadPtr> m_rtScratchPads;
+    // scratch pad per sub-stream for each slot of the concurrently executed nodes
+    mutable std::vector<std::vector<DnnlScratchPadPtr>> m_rtScratchPads;
+    mutable size_t m_numReservedScratchPads = 0;
     // stream executor for current graph
     ov::threading::IStreamsExecutor::Ptr m_streamExecutor;
     // cpu stream executor for current graph
@@ -3426,6 +3426,7 @@ void GraphOptimizer::TailNodesPrecisionOptimize(Graph& graph) {
                        Type::PagedAttention,
                        Type::QKVProjection,
                        Type::LLMMLP,
+                       Type::MoE,
                        Type::Pooling)) {
                 continue;
             }
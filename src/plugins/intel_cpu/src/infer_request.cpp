@@ -81,6 +81,18 @@ void SyncInferRequest::create_infer_request() {
     m_memory_states = m_compiled_model.graph().memoryStates();
 }
 
+void SyncInferRequest::record_input_shapes() {
+    if (!m_compiled_model.records_input_shapes()) {
+        return;
+    }
+    InputShapes input_shapes(m_input_ports_map.size());
+    for (const auto& [index, port] : m_input_ports_map) {
+        OPENVINO_ASSERT(index < input_shapes.size(), "Unexpected input index: ", index);
+        input_shapes[index] = get_tensor(port)->get_shape();
+    }
+    m_compiled_model.record_input_shapes(std::move(input_shapes));
+}
+
 void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     for (const auto& input_port : m_input_ports_map) {
         auto inputNode = graph.getInputNodeByIndex(input_port.first);
@@ -124,6 +136,7 @@ void SyncInferRequest::infer() {
 
     if (graph.hasDynamicInput()) {
         redefine_memory_for_input_nodes(graph);
+        record_input_shapes();
     }
 
     change_default_ptr(graph);
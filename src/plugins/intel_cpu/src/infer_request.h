@@ -112,6 +112,7 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    void record_input_shapes();
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
 
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,27 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the CPU runtime parameters cache is shared between all the streams of a compiled model.
+ * The shared cache is thread safe, so the primitives and kernels created by one stream are reused by the others.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Defines whether the input shapes of the dynamic model inferences are stored in the exported model blob.
+ * On import the stored shapes are replayed once per stream, so the runtime caches are populated before the first
+ * user inference.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_warmup{"CPU_RUNTIME_CACHE_WARMUP"};
+
+/**
+ * @brief Read-only statistics of the CPU runtime parameters cache accumulated over all the streams.
+ * The key has the form "<entry>.<counter>", where entry is the cache key type name and counter is one of
+ * "hits", "misses" or "evictions".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -80,4 +102,20 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Define whether independent branches of a static graph may be executed concurrently (inter-op parallelism)
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_inter_op_parallel{"ENABLE_INTER_OP_PARALLEL"};
+
+/**
+ * @brief Define whether the LM head of a language model computes the logits of the last token of each sequence only
+ * The logits output shape changes to [batch, 1, vocab_size] for stateful models and to [num_sequences, 1, vocab_size]
+ * for PagedAttention models.
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_lm_head_slicing{"ENABLE_LM_HEAD_SLICING"};
+
 }  // namespace ov::intel_cpu
@@ -226,11 +226,13 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
                                            const bool quant_by_channel,
-                                           const size_t group_size)
+                                           const size_t group_size,
+                                           const int numa_node)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
-      m_group_size(group_size) {
+      m_group_size(group_size),
+      m_numa_node(numa_node) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
@@ -319,7 +321,8 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     // May be optimized by reusing the state tensor underlining memory pointer, but corner cases should be considered
     auto dense_internal_desc = m_dense_internal_desc->cloneWithNewDims(state_desc->getShape().getStaticDims());
 
-    m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
+    m_internal_mem = make_kv_cache_memory(get_engine(), dense_internal_desc, m_numa_node);
+    m_scale_zp_mem = nullptr;
     Memory external_mem(get_engine(), state_desc, m_state->data());
 
     if (dense_internal_desc->getPrecision() == element::u8) {
@@ -396,6 +399,58 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
 }
 
+void VariableStateKVcache::trim(size_t count) {
+    if (count == 0) {
+        return;
+    }
+    OPENVINO_ASSERT(m_internal_mem && m_hidden_state && !is_reset_state(),
+                    "Cannot trim the empty KV cache state ",
+                    get_name());
+
+    // only the logical length is reduced: the strides are kept, so the remaining tokens stay in place and the
+    // capacity is reused by the next inferences
+    auto internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto&& order = internal_desc->getOrder();
+    auto dims = internal_desc->getShape().getStaticDims();
+    // the sequence axis is the outermost one of the internal LBHS layout
+    const size_t size_L = dims[order.at(0)];
+    OPENVINO_ASSERT(count <= size_L,
+                    "Cannot trim ",
+                    count,
+                    " tokens from the KV cache state ",
+                    get_name(),
+                    " of ",
+                    size_L,
+                    " tokens");
+    dims[order[0]] -= count;
+    VectorDims blocked_dims(dims.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        blocked_dims[i] = dims[order[i]];
+    }
+    m_internal_mem->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(internal_desc->getPrecision(),
+                                                                        Shape(dims),
+                                                                        blocked_dims,
+                                                                        order,
+                                                                        0,
+                                                                        VectorDims{},
+                                                                        internal_desc->getStrides()));
+
+    // beam table [B, L]
+    auto beam_desc = m_hidden_state->getDescWithType<BlockedMemoryDesc>();
+    auto beam_dims = beam_desc->getShape().getStaticDims();
+    beam_dims[1] -= count;
+    m_hidden_state->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                        Shape(beam_dims),
+                                                                        beam_dims,
+                                                                        VectorDims{0, 1},
+                                                                        0,
+                                                                        VectorDims{},
+                                                                        beam_desc->getStrides()));
+    // The per token scale/zp of the u8 cache are stored along L as well and are overwritten by the new tokens.
+    // The scale/zp of the last group quantized by channel still cover the remaining tokens of the group, which are
+    // dequantized and quantized again together with the new tokens.
+}
+
 void VariableStateKVcache::reset_impl() {
     // nothing to do
 }
@@ -431,4 +486,11 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+MemoryPtr VariableStateKVcache::make_kv_cache_memory(const dnnl::engine& eng,
+                                                     const MemoryDescPtr& desc,
+                                                     int numa_node) {
+    auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<GrowableMemoryBlock>(numa_node));
+    return std::make_shared<Memory>(eng, desc, block);
+}
 }  // namespace ov::intel_cpu
@@ -124,10 +124,12 @@ public:
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          bool quant_by_channel,
-                         size_t group_size = 0);
+                         size_t group_size = 0,
+                         int numa_node = -1);
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
+    void trim(size_t count) override;
 
     // ov::intel_cpu::VariableStateBase
     MemoryPtr input_mem() override;
@@ -160,8 +162,23 @@ public:
     }
     void set_scale_zp(const PlainTensor& t) {
         m_scale_zp = t;
+        m_scale_zp_mem = nullptr;
     }
 
+    // scale/zp table stored in a memory object created by make_kv_cache_memory, nullptr if the table owns its data
+    MemoryPtr scale_zp_mem() const {
+        return m_scale_zp_mem;
+    }
+    void assign_scale_zp_mem(const MemoryPtr& mem) {
+        m_scale_zp_mem = mem;
+        m_scale_zp.reset(mem);
+    }
+
+    // The KV cache memory is always created by this function: its storage grows along the outermost (sequence) axis
+    // keeping the stored tokens, so the cache may be extended by redefining the memory descriptor.
+    // The storage is bound to the NUMA node of the stream if it is not negative.
+    static MemoryPtr make_kv_cache_memory(const dnnl::engine& eng, const MemoryDescPtr& desc, int numa_node);
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
@@ -178,8 +195,10 @@ private:
 
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
+    MemoryPtr m_scale_zp_mem;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+    int m_numa_node = -1;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -528,6 +528,25 @@ public:
         return execIndex;
     }
 
+    /**
+     * @brief Sets the scratch pad of the graph context used by the node (see GraphContext::reserveScratchPads)
+     */
+    void setScratchPadSlot(size_t slot) {
+        *scratchPadSlot = slot;
+    }
+
+    size_t getScratchPadSlot() const {
+        return *scratchPadSlot;
+    }
+
+    /**
+     * @brief The scratch pad slot shared with the executor contexts of the node, which are created before the slot
+     * is assigned
+     */
+    ScratchPadSlotCPtr getSharedScratchPadSlot() const {
+        return scratchPadSlot;
+    }
+
     /**
      * @brief Register node to the allocation \context
      *
@@ -825,9 +844,13 @@ protected:
                                        NameFromType(getType()));
     }
 
+    DnnlScratchPadPtr getScratchPad() const {
+        return context->getScratchPad(*scratchPadSlot);
+    }
+
     MemoryPtr getScratchPadMem(const MemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            scratchpadMem = getScratchPad()->createScratchPadMem(desc);
         }
         return scratchpadMem;
     }
@@ -871,6 +894,7 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    std::shared_ptr<size_t> scratchPadSlot = std::make_shared<size_t>(0);
 
     PerfCount perfCounter;
     PerfCounters profiling;
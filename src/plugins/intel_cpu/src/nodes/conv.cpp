@@ -410,7 +410,10 @@ std::tuple<VecMemoryDescs, MemoryDescPtr> Convolution::initMemoryDescriptors(ov:
 }
 
 ExecutorFactoryPtr<ConvAttrs> Convolution::createExecutorFactory(const MemoryDescArgs& descs, const ConvAttrs& attrs) {
-    auto executionContext = std::make_shared<ExecutorContext>(context, getImplPriority(), privateWeightCache);
+    auto executionContext = std::make_shared<ExecutorContext>(context,
+                                                              getImplPriority(),
+                                                              getSharedScratchPadSlot(),
+                                                              privateWeightCache);
     return std::make_shared<ExecutorFactory<ConvAttrs>>(attrs, executionContext, descs, memoryFormatFilter);
 }
 
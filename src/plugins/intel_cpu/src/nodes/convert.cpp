@@ -121,11 +121,11 @@ void Convert::initSupportedPrimitiveDescriptors() {
         MemoryDescPtr dstMemoryDesc = config.outConfs[0].getMemDesc();
         convertParams.srcPrc = srcMemoryDesc->getPrecision();
         convertParams.dstPrc = dstMemoryDesc->getPrecision();
-        auto factory =
-            std::make_shared<ConvertExecutorFactory>(convertParams,
-                                                     srcMemoryDesc,
-                                                     dstMemoryDesc,
-                                                     std::make_shared<ExecutorContext>(context, getImplPriority()));
+        auto factory = std::make_shared<ConvertExecutorFactory>(
+            convertParams,
+            srcMemoryDesc,
+            dstMemoryDesc,
+            std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot()));
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, factory);
     };
 
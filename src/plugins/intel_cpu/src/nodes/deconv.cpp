@@ -1338,11 +1338,11 @@ void Deconvolution::initSupportedPrimitiveDescriptors() {
             dstMemoryDescs.push_back(config.outConfs[i].getMemDesc()->clone());
         }
 
-        auto factory =
-            std::make_shared<DeconvExecutorFactory>(deconvAttrs,
-                                                    srcMemoryDescs,
-                                                    dstMemoryDescs,
-                                                    std::make_shared<ExecutorContext>(context, getImplPriority()));
+        auto factory = std::make_shared<DeconvExecutorFactory>(
+            deconvAttrs,
+            srcMemoryDescs,
+            dstMemoryDescs,
+            std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot()));
 
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::gemm_acl, factory);
     };
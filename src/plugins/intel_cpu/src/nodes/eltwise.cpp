@@ -667,7 +667,7 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
     }
     descs[ARG_DST] = dstDesc;
 
-    auto executionContext = std::make_shared<ExecutorContext>(context, getImplPriority());
+    auto executionContext = std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot());
     m_factory = std::make_shared<ExecutorFactory<EltwiseAttrs>>(m_attrs, executionContext, descs, memoryFormatFilter);
 
     const std::vector<MemoryDescArgs> nodeDescriptorsList = m_factory->getProperMemoryDescriptors(descs);
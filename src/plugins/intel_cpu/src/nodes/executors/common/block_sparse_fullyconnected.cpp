@@ -0,0 +1,380 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "block_sparse_fullyconnected.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace ov::element;
+
+namespace {
+
+constexpr size_t blockSize = BlockSparseFCExecutor::blockSize;
+// number of tokens sharing one decompressed block in the kernel
+constexpr size_t tokensBlock = 8;
+
+using LoadBlockFn = void (*)(const uint8_t* src, float* dst);
+
+template <typename T>
+void loadBlock(const uint8_t* src, float* dst) {
+    const auto* typed = reinterpret_cast<const T*>(src);
+    for (size_t k = 0; k < blockSize; k++) {
+        dst[k] = static_cast<float>(typed[k]);
+    }
+}
+
+void loadBlockU4(const uint8_t* src, float* dst) {
+    for (size_t k = 0; k < blockSize; k += 2) {
+        const uint8_t byte = src[k / 2];
+        dst[k] = static_cast<float>(byte & 0xF);
+        dst[k + 1] = static_cast<float>(byte >> 4);
+    }
+}
+
+void loadBlockI4(const uint8_t* src, float* dst) {
+    for (size_t k = 0; k < blockSize; k += 2) {
+        const uint8_t byte = src[k / 2];
+        dst[k] = static_cast<float>(static_cast<int8_t>((byte & 0xF) ^ 0x8) - 8);
+        dst[k + 1] = static_cast<float>(static_cast<int8_t>((byte >> 4) ^ 0x8) - 8);
+    }
+}
+
+LoadBlockFn getLoadBlockFn(const ov::element::Type& precision) {
+    switch (precision) {
+    case f32:
+        return loadBlock<float>;
+    case f16:
+        return loadBlock<ov::float16>;
+    case bf16:
+        return loadBlock<ov::bfloat16>;
+    case i8:
+        return loadBlock<int8_t>;
+    case u8:
+        return loadBlock<uint8_t>;
+    case i4:
+        return loadBlockI4;
+    case u4:
+        return loadBlockU4;
+    default:
+        return nullptr;
+    }
+}
+
+size_t blockBytes(const ov::element::Type& precision) {
+    return blockSize * precision.bitwidth() / 8;
+}
+
+// Decompression scales and zero points have either a single value or [N, groups] shape.
+// The values are converted to f32 and broadcasted to [N, groups]
+std::vector<float> getDecompressionParams(const MemoryCPtr& memory, size_t N, size_t& groups) {
+    groups = 0;
+    if (!memory) {
+        return {};
+    }
+    const auto count = memory->getShape().getElementsCount();
+    std::vector<float> values(count);
+    cpu_convert(memory->getData(), values.data(), memory->getPrecision(), f32, count);
+    if (count == 1) {
+        groups = 1;
+        return std::vector<float>(N, values.front());
+    }
+    OPENVINO_ASSERT(count % N == 0, "BlockSparseFCExecutor: unexpected decompression parameters shape");
+    groups = count / N;
+    return values;
+}
+
+MemoryCPtr findMemory(const MemoryArgs& memory, int argId) {
+    const auto it = memory.find(argId);
+    if (it == memory.end() || it->second->getDesc().empty()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+float zeroPoint(const std::vector<float>& zeroPoints, size_t groups, size_t n, size_t k, size_t K) {
+    return zeroPoints.empty() ? 0.0F : zeroPoints[n * groups + k / (K / groups)];
+}
+
+// Checks which blocks of the [N, K] weights are zero after the decompression
+class ZeroBlocksScanner {
+public:
+    ZeroBlocksScanner(const MemoryCPtr& weights, const MemoryCPtr& zeroPoints)
+        : N(weights->getStaticDims()[0]),
+          K(weights->getStaticDims()[1]),
+          m_precision(weights->getPrecision()),
+          m_loadBlockFn(getLoadBlockFn(m_precision)),
+          m_data(weights->getDataAs<const uint8_t>()),
+          m_rowBytes(K * m_precision.bitwidth() / 8) {
+        m_zeroPoints = getDecompressionParams(zeroPoints, N, m_zeroPointsGroups);
+    }
+
+    [[nodiscard]] const uint8_t* block(size_t n, size_t kb) const {
+        return m_data + n * m_rowBytes + kb * blockBytes(m_precision);
+    }
+
+    [[nodiscard]] bool isZero(size_t n, size_t kb) const {
+        float values[blockSize];
+        m_loadBlockFn(block(n, kb), values);
+        const float zp = zeroPoint(m_zeroPoints, m_zeroPointsGroups, n, kb * blockSize, K);
+        return std::all_of(std::begin(values), std::end(values), [zp](float value) {
+            return value == zp;
+        });
+    }
+
+    const size_t N, K;
+
+private:
+    const ov::element::Type m_precision;
+    const LoadBlockFn m_loadBlockFn;
+    const uint8_t* const m_data;
+    const size_t m_rowBytes;
+    size_t m_zeroPointsGroups = 0;
+    std::vector<float> m_zeroPoints;
+};
+
+}  // namespace
+
+float BlockSparseFCExecutor::zeroBlocksRate(const MemoryCPtr& weights, const MemoryCPtr& zeroPoints) {
+    const auto& dims = weights->getShape().getStaticDims();
+    if (dims.size() != 2 || dims[1] % blockSize != 0 || !getLoadBlockFn(weights->getPrecision())) {
+        return 0.0F;
+    }
+
+    const ZeroBlocksScanner scanner(weights, zeroPoints);
+    const size_t kBlocks = scanner.K / blockSize;
+    const auto zeroBlocks = parallel_sum(scanner.N, static_cast<size_t>(0), [&](size_t n) {
+        size_t rowZeroBlocks = 0;
+        for (size_t kb = 0; kb < kBlocks; kb++) {
+            rowZeroBlocks += static_cast<size_t>(scanner.isZero(n, kb));
+        }
+        return rowZeroBlocks;
+    });
+
+    return static_cast<float>(zeroBlocks) / static_cast<float>(scanner.N * kBlocks);
+}
+
+/**
+ * Packed weights layout:
+ * int32 rowBegins[N + 1] - offsets of the output channels in the nonzero blocks list
+ * int32 blockIndices[nnz] - K block index of each nonzero block
+ * the nonzero blocks data in the weights precision
+ */
+static MemoryCPtr prepareWeightMemory(const MemoryCPtr& weightsMemory,
+                                      const MemoryCPtr& zeroPoints,
+                                      const ExecutorContext::CPtr& context) {
+    const auto& dims = weightsMemory->getStaticDims();
+    const size_t N = dims[0];
+    const size_t K = dims[1];
+    const auto precision = weightsMemory->getPrecision();
+
+    auto create = [&]() {
+        DEBUG_LOG("BlockSparseFCExecutor: pack weights");
+        const ZeroBlocksScanner scanner(weightsMemory, zeroPoints);
+        const size_t kBlocks = K / blockSize;
+        std::vector<uint8_t> zeroBlocks(N * kBlocks);
+        std::vector<int32_t> rowBegins(N + 1, 0);
+        parallel_for(N, [&](size_t n) {
+            int32_t nonzeroBlocks = 0;
+            for (size_t kb = 0; kb < kBlocks; kb++) {
+                zeroBlocks[n * kBlocks + kb] = static_cast<uint8_t>(scanner.isZero(n, kb));
+                nonzeroBlocks += static_cast<int32_t>(zeroBlocks[n * kBlocks + kb] == 0);
+            }
+            rowBegins[n + 1] = nonzeroBlocks;
+        });
+        std::partial_sum(rowBegins.begin(), rowBegins.end(), rowBegins.begin());
+        const auto nnz = static_cast<size_t>(rowBegins[N]);
+
+        const size_t indicesBytes = (rowBegins.size() + nnz) * sizeof(int32_t);
+        const size_t packedSize = indicesBytes + nnz * blockBytes(precision);
+        MemoryPtr packed =
+            std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(i8, intel_cpu::Shape{packedSize}));
+        auto* dst = packed->getDataAs<uint8_t>();
+        std::memcpy(dst, rowBegins.data(), rowBegins.size() * sizeof(int32_t));
+        auto* blockIndices = reinterpret_cast<int32_t*>(dst) + rowBegins.size();
+        auto* blocks = dst + indicesBytes;
+        parallel_for(N, [&](size_t n) {
+            auto b = static_cast<size_t>(rowBegins[n]);
+            for (size_t kb = 0; kb < kBlocks; kb++) {
+                if (zeroBlocks[n * kBlocks + kb] == 0) {
+                    blockIndices[b] = static_cast<int32_t>(kb);
+                    std::memcpy(blocks + b * blockBytes(precision), scanner.block(n, kb), blockBytes(precision));
+                    b++;
+                }
+            }
+        });
+        DEBUG_LOG("BlockSparseFCExecutor: nonzero blocks ", nnz, " of ", N * kBlocks);
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string string_hash = "block_sparse_fc_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                  std::to_string(weightsMemory->getSize()) + "_" +
+                                  std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        // the zero points decide which blocks are skipped, so they are a part of the key
+        if (zeroPoints) {
+            string_hash += "_" + std::to_string(zeroPoints->getSize()) + "_" +
+                           std::to_string(reinterpret_cast<uint64_t>(zeroPoints->getData()));
+        }
+        return MemoryCPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    return create();
+}
+
+bool BlockSparseFCExecutor::supports(const FCConfig& config) {
+    if (!config.attrs.blockSparseWeights) {
+        DEBUG_LOG("BlockSparseFCExecutor: the weights are not block sparse");
+        return false;
+    }
+
+    if (!config.attrs.postOps.empty()) {
+        DEBUG_LOG("BlockSparseFCExecutor: PostOps are not supported");
+        return false;
+    }
+
+    if (config.attrs.weightsNonTransposed) {
+        DEBUG_LOG("BlockSparseFCExecutor: only [N, K] weights layout is supported");
+        return false;
+    }
+
+    const auto& srcDesc = config.descs.at(ARG_SRC);
+    const auto& weiDesc = config.descs.at(ARG_WEI);
+    const auto& dstDesc = config.descs.at(ARG_DST);
+    if (srcDesc->getPrecision() != f32 || dstDesc->getPrecision() != f32) {
+        DEBUG_LOG("BlockSparseFCExecutor: only f32 activations are supported");
+        return false;
+    }
+
+    if (!getLoadBlockFn(weiDesc->getPrecision())) {
+        DEBUG_LOG("BlockSparseFCExecutor: unsupported weights precision ", weiDesc->getPrecision());
+        return false;
+    }
+
+    const auto& weiDims = weiDesc->getShape().getDims();
+    if (weiDims.size() != 2 || weiDims[1] % blockSize != 0) {
+        DEBUG_LOG("BlockSparseFCExecutor: the weights must be [N, K] with K divisible by ", blockSize);
+        return false;
+    }
+
+    if (config.attrs.withBias) {
+        const auto& biaDesc = config.descs.at(ARG_BIAS);
+        if (biaDesc->getPrecision() != f32 || biaDesc->getShape().getElementsCount() != weiDims[0]) {
+            DEBUG_LOG("BlockSparseFCExecutor: only f32 'by channel' bias is supported");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+BlockSparseFCExecutor::BlockSparseFCExecutor(const FCAttrs& attrs,
+                                             const MemoryArgs& memory,
+                                             const ExecutorContext::CPtr& context)
+    : m_attrs(attrs),
+      m_memoryArgs(memory),
+      m_weiPrecision(memory.at(ARG_WEI)->getPrecision()),
+      N(memory.at(ARG_WEI)->getStaticDims()[0]),
+      K(memory.at(ARG_WEI)->getStaticDims()[1]) {
+    const auto scales = findMemory(memory, ARG_WEI | ARG_ATTR_SCALES);
+    const auto zeroPoints = findMemory(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+    m_scales = getDecompressionParams(scales, N, m_scalesGroups);
+    m_zeroPoints = getDecompressionParams(zeroPoints, N, m_zeroPointsGroups);
+    // every block must be decompressed by a single scale and zero point
+    for (const auto groups : {m_scalesGroups, m_zeroPointsGroups}) {
+        OPENVINO_ASSERT(groups == 0 || (K % groups == 0 && (K / groups) % blockSize == 0),
+                        "BlockSparseFCExecutor: decompression group size must be divisible by ",
+                        blockSize);
+    }
+    m_packedWeights = prepareWeightMemory(memory.at(ARG_WEI), zeroPoints, context);
+}
+
+bool BlockSparseFCExecutor::update(const MemoryArgs& memory) {
+    const auto& outDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = std::accumulate(outDims.begin(), outDims.end() - 1, static_cast<size_t>(1), std::multiplies<>());
+    return true;
+}
+
+void BlockSparseFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = m_attrs.withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr;
+
+    const auto* rowBegins = m_packedWeights->getDataAs<const int32_t>();
+    const auto* blockIndices = rowBegins + N + 1;
+    const auto* blocks = reinterpret_cast<const uint8_t*>(blockIndices + rowBegins[N]);
+    const auto loadBlockFn = getLoadBlockFn(m_weiPrecision);
+    const auto bytes = blockBytes(m_weiPrecision);
+
+    // the decompressed block is reused by a tile of tokens, the tiles of consecutive output channels share the
+    // activations in cache
+    const size_t tokenTiles = div_up(M, tokensBlock);
+    parallel_for2d(tokenTiles, N, [&](size_t tile, size_t n) {
+        const size_t m0 = tile * tokensBlock;
+        const size_t tokens = std::min(tokensBlock, M - m0);
+        // the products are accumulated by the lanes of the block and reduced once per output channel, so the
+        // inner loops are elementwise and vectorized by the compiler
+        float acc[tokensBlock][blockSize] = {};
+
+        float weights[blockSize];
+        for (int32_t b = rowBegins[n]; b < rowBegins[n + 1]; b++) {
+            const size_t k0 = static_cast<size_t>(blockIndices[b]) * blockSize;
+            loadBlockFn(blocks + b * bytes, weights);
+            if (!m_zeroPoints.empty() || !m_scales.empty()) {
+                const float zp = zeroPoint(m_zeroPoints, m_zeroPointsGroups, n, k0, K);
+                const float scale = m_scales.empty() ? 1.0F : m_scales[n * m_scalesGroups + k0 / (K / m_scalesGroups)];
+                for (auto& weight : weights) {
+                    weight = (weight - zp) * scale;
+                }
+            }
+            for (size_t m = 0; m < tokens; m++) {
+                const float* x = src + (m0 + m) * K + k0;
+                for (size_t k = 0; k < blockSize; k++) {
+                    acc[m][k] += x[k] * weights[k];
+                }
+            }
+        }
+
+        for (size_t m = 0; m < tokens; m++) {
+            dst[(m0 + m) * N + n] = std::accumulate(std::begin(acc[m]), std::end(acc[m]), bias ? bias[n] : 0.0F);
+        }
+    });
+}
+
+void BlockSparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (m_attrs.withBias) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
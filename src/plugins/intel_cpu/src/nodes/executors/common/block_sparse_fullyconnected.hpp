@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief FullyConnected executor for the weights pruned by blocks.
+ *
+ * The [N, K] weights are split into 1 x blockSize blocks along K. The blocks which are zero after the decompression
+ * (the weights value is equal to the zero point) are dropped, the rest are stored in the original weights precision
+ * in the CSR order: the nonzero blocks of every output channel and their K block indices. The kernel decompresses
+ * only the stored blocks, so the work is proportional to the number of the nonzero blocks.
+ */
+class BlockSparseFCExecutor : public Executor {
+public:
+    static constexpr size_t blockSize = 32;
+
+    BlockSparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::gemm_sparse;
+    }
+
+    bool update(const MemoryArgs& memory) override;
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    static bool supports(const FCConfig& config);
+
+    /**
+     * @brief Returns the share of the weights blocks which are zero after the decompression
+     * @param weights [N, K] weights
+     * @param zeroPoints optional decompression zero points, may be nullptr
+     */
+    static float zeroBlocksRate(const MemoryCPtr& weights, const MemoryCPtr& zeroPoints);
+
+private:
+    const FCAttrs& m_attrs;
+    const MemoryArgs& m_memoryArgs;
+    const ov::element::Type m_weiPrecision;
+    const size_t N, K;
+    size_t M = 0;
+    size_t m_scalesGroups = 0;
+    size_t m_zeroPointsGroups = 0;
+    std::vector<float> m_scales;
+    std::vector<float> m_zeroPoints;
+    MemoryCPtr m_packedWeights;
+    int curNumaNode = -1;
+};
+
+using BlockSparseFCExecutorPtr = std::shared_ptr<BlockSparseFCExecutor>;
+
+}  // namespace ov::intel_cpu
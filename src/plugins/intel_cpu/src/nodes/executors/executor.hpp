@@ -47,6 +47,10 @@ enum class OperationType : uint8_t { FullyConnected, MatMul, Convolution, Eltwis
 std::string ExecutorTypeToString(ExecutorType type);
 ExecutorType ExecutorTypeFromString(const std::string& typeStr);
 
+// the scratch pad slot of the node (see GraphContext::reserveScratchPads), it is assigned when the graph is scheduled,
+// i.e. after the executor contexts of the node are created
+using ScratchPadSlotCPtr = std::shared_ptr<const size_t>;
+
 class ExecutorContext {
 public:
     using Ptr = std::shared_ptr<ExecutorContext>;
@@ -54,12 +58,14 @@ public:
 
     ExecutorContext(const GraphContext::CPtr& graphContext,
                     std::vector<impl_desc_type> implPriorities,
+                    ScratchPadSlotCPtr scratchPadSlot,
                     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr)
         : runtimeCache(graphContext->getParamsCache()),
-          scratchPads(graphContext->getScratchPads()),
+          graphContext(graphContext),
           weightsCache(graphContext->getWeightsCache()),
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
+          scratchPadSlot(std::move(scratchPadSlot)),
           privateWeighCache(std::move(privateWeighCache)),
           numNumaNodes(graphContext->getNumNumaNodes()) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
@@ -72,8 +78,12 @@ public:
         return runtimeCachePtr;
     }
 
+    // the scratch pad of the stream of the graph context, so the executors using it must not be shared between the
+    // streams through the runtime cache (see GraphContext::getPrivateParamsCache)
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
-        return scratchPads[curNumaNodeId];
+        auto graphContextPtr = graphContext.lock();
+        assert(graphContextPtr);
+        return graphContextPtr->getScratchPads(*scratchPadSlot)[curNumaNodeId];
     }
 
     [[nodiscard]] std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> getPrivateWeightCache() const {
@@ -96,10 +106,11 @@ private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
-    std::vector<DnnlScratchPadPtr> scratchPads;
+    std::weak_ptr<const GraphContext> graphContext;
     WeightsSharing::Ptr weightsCache;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
+    ScratchPadSlotCPtr scratchPadSlot;
     // @todo remove after global cache is used exclusevly
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache;
     int numNumaNodes;
@@ -19,6 +19,8 @@ struct FCAttrs {
     bool withBias = false;
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
+    // a significant part of the weights blocks is zero, see BlockSparseFCExecutor
+    bool blockSparseWeights = false;
     uint64_t dynamicQuantizationGroupSize = 0;
     bool nonConstantWeights = false;
 
@@ -10,6 +10,7 @@
 #include "debug_messages.hpp"
 #include "implementation_utils.hpp"
 #include "memory_desc/cpu_memory_desc.h"
+#include "nodes/executors/common/block_sparse_fullyconnected.hpp"
 #include "nodes/executors/convolution_config.hpp"
 #include "nodes/executors/dnnl/dnnl_fullyconnected.hpp"
 #include "nodes/executors/dnnl/dnnl_fullyconnected_primitive.hpp"
@@ -178,6 +179,24 @@ struct CreateOptimalConfigDefault {
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        // the weights get blockSparseWeights only when the rate of the zero blocks reaches
+        // ov::intel_cpu::sparse_weights_decompression_rate, the rest go to the dense implementations below
+        OV_CPU_INSTANCE_COMMON(
+            "fullyconnected_block_sparse",
+            ExecutorType::Common,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(noSparseDecompression(config), UNSUPPORTED_SPARSE_WEIGHTS);
+                VERIFY(BlockSparseFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            AcceptsAnyShape<FCAttrs>,
+            CreateDefault<BlockSparseFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
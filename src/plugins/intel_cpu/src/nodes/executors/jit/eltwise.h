@@ -144,7 +144,9 @@ private:
                           const ov::element::Type& outPrc,
                           const dnnl::post_ops& post_ops);
 
-    void updateWorkAmount(const VectorDims& dims_out);
+    // the executor is shared by the streams through the runtime cache, so the work amount of the runtime shape is not
+    // stored in it
+    static size_t getWorkAmount(const VectorDims& dims_out);
     void initializeDimsAndOffsets(const std::vector<VectorDims>& inpDims,
                                   const VectorDims& outBlkDims,
                                   [[maybe_unused]] const VectorDims& outOrder);
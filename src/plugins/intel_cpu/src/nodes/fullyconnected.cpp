@@ -31,6 +31,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
+#include "nodes/executors/common/block_sparse_fullyconnected.hpp"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/executor_factory.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
@@ -471,6 +472,7 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::brgconv_avx512_1x1,
         impl_desc_type::brgemm_avx512,
         impl_desc_type::brgemm_avx2,
+        impl_desc_type::gemm_sparse,
         impl_desc_type::gemm_blas,
         impl_desc_type::gemm_avx512,
         impl_desc_type::gemm_avx2,
@@ -560,12 +562,65 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
     return sparseRate >= minSparseRate;
 }
 
+// Float activations: the zero blocks of the weights are skipped by BlockSparseFCExecutor
+static bool useBlockSparseWeights(const NodePtr& weightsInput,
+                                  const NodePtr& zeroPointsInput,
+                                  const ov::element::Type inputType,
+                                  const float sparseWeiDecompressionRate) {
+    if (sparseWeiDecompressionRate == 1.F) {
+        return false;
+    }
+    // the configured rate is the threshold as is: the break-even point of the block sparse kernel
+    // against the dense implementations depends on the shapes and the ISA, so it is left to the user
+    const auto minSparseRate = sparseWeiDecompressionRate;
+
+    if (inputType != f32) {
+        return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
+    if (!constNode) {
+        return false;
+    }
+
+    MemoryCPtr zeroPoints;
+    if (zeroPointsInput) {
+        const auto zeroPointsNode = std::dynamic_pointer_cast<Input>(zeroPointsInput);
+        if (!zeroPointsNode) {
+            return false;
+        }
+        zeroPoints = zeroPointsNode->getMemoryPtr();
+    }
+
+    const auto weiMemory = constNode->getMemoryPtr();
+    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
+
+    const auto zeroBlocksRate = BlockSparseFCExecutor::zeroBlocksRate(weiMemory, zeroPoints);
+
+    DEBUG_LOG("Zero blocks rate = ",
+              zeroBlocksRate * 100,
+              "%, min sparse rate = ",
+              minSparseRate * 100,
+              "%, use block sparse weights = ",
+              zeroBlocksRate >= minSparseRate);
+
+    return zeroBlocksRate >= minSparseRate;
+}
+
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     attrs.withBias = getOriginalInputPrecisionAtPort(BIAS) != ov::element::dynamic;
 
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
+    if (!attrs.sparseWeights) {
+        const auto zeroPoints = m_atoi.find(ARG_WEI | ARG_ATTR_ZERO_POINTS);
+        attrs.blockSparseWeights =
+            useBlockSparseWeights(getParentEdgeAt(WEIGHTS)->getParent(),
+                                  zeroPoints != m_atoi.end() ? getParentEdgeAt(zeroPoints->second)->getParent() : nullptr,
+                                  getOriginalInputPrecisionAtPort(DATA),
+                                  context->getConfig().fcSparseWeiDecompressionRate);
+    }
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
 
@@ -602,7 +657,10 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
         {ARG_DST, dstDescs[0]},
     };
 
-    auto executionContext = std::make_shared<ExecutorContext>(context, getImplPriority(), privateWeightCache);
+    auto executionContext = std::make_shared<ExecutorContext>(context,
+                                                              getImplPriority(),
+                                                              getSharedScratchPadSlot(),
+                                                              privateWeightCache);
     factory = std::make_shared<ExecutorFactory<FCAttrs>>(attrs, executionContext, descs);
     const std::vector<MemoryDescArgs> nodeDescriptorsList = factory->getProperMemoryDescriptors(descs);
     const MemoryDescArgs& nodeDescriptors = nodeDescriptorsList.front();
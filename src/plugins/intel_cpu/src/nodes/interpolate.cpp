@@ -2263,7 +2263,7 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
                 interpAttrs,
                 srcMemoryDescs,
                 dstMemoryDescs,
-                std::make_shared<ExecutorContext>(context, getImplPriority()));
+                std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot()));
             if (!factory->isEmpty()) {
                 supportedPrimitiveDescriptors.emplace_back(config, implDetail, factory);
             }
@@ -2526,7 +2526,8 @@ void Interpolate::prepareParams() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    // the pillow executor writes to its own working buffer
+    auto cache = context->getPrivateParamsCache();
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 
@@ -8,6 +8,7 @@
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -32,6 +33,7 @@
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "paged_attn_kernel.hpp"
+#include "paged_attn_work_partitioner.hpp"
 #include "sage_attn.hpp"
 #include "softmax_kernel.hpp"
 #include "transpose_kernel.hpp"
@@ -1270,6 +1272,156 @@ struct MHAHelper {
         }
     }
 
+    // compute one token for the part [kv_beg, kv_end) of the kv cache (flash decoding): the output is not normalized,
+    // the max and the sum of exp of the part are stored to merge the parts by reduce_kv_splits
+    //  split_output: [H, SV], split_max_sum: [H, 2]
+    void exec_kernel_one_bh_kv_split(const PlainTensor& query,
+                                     const PlainTensor& present_key,
+                                     const PlainTensor& present_value,
+                                     const int32_t* block_table,
+                                     size_t ithr,
+                                     size_t hq_beg,
+                                     size_t hq_end,
+                                     size_t hk,
+                                     size_t kv_beg,
+                                     size_t kv_end,
+                                     size_t cur_kv_len,
+                                     const PlainTensor& alibi_slopes,
+                                     float* split_output,
+                                     float* split_max_sum) {
+        const auto kv_len = kv_end - kv_beg;
+#    if defined(OPENVINO_ARCH_X86_64)
+        if (any_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
+            _gemv->tile_config();
+            for (size_t pk = kv_beg, i = kv_beg / _block_size; pk < kv_end; pk += _block_size, i++) {
+                auto block_number = block_table[i];
+                for (size_t h = hq_beg; h < hq_end; h++) {
+                    (*_gemv)(query.ptr<DATA_TYPE>(h, 0),
+                             present_key.ptr<typename ov::element_type_traits<KEY_PREC>::value_type>(block_number, hk),
+                             _weight.ptr<float>(ithr, h - hq_beg, 0) + pk);
+                }
+            }
+            _gemv->tile_release();
+        } else {
+#    endif
+            for (size_t pk = kv_beg, i = kv_beg / _block_size; pk < kv_end; pk += _block_size, i++) {
+                auto block_number = block_table[i];
+                for (size_t h = hq_beg; h < hq_end; h++) {
+                    if constexpr (any_of(KEY_PREC, ov::element::i8, ov::element::u8, ov::element::u4)) {
+                        dot_product_block_quantized<DATA_TYPE, KEY_PREC>(
+                            query.ptr<DATA_TYPE>(h, 0),
+                            present_key.ptr<uint8_t, KEY_PREC>(block_number, hk),
+                            _weight.ptr<float>(ithr, h - hq_beg, 0) + pk,
+                            S,
+                            _params.quant_key_bychannel,
+                            std::min(_block_size, kv_end - pk),
+                            _params.key_group_size);
+                    } else {
+                        dot_product_block<DATA_TYPE, KEY_PREC>(
+                            query.ptr<DATA_TYPE>(h, 0),
+                            present_key.ptr<typename ov::element_type_traits<KEY_PREC>::value_type>(block_number, hk),
+                            _weight.ptr<float>(ithr, h - hq_beg, 0) + pk,
+                            S,
+                            std::min(_block_size, kv_end - pk),
+                            _params.key_group_size);
+                    }
+                }
+            }
+#    if defined(OPENVINO_ARCH_X86_64)
+        }
+#    endif
+
+        for (size_t h = hq_beg; h < hq_end; h++) {
+            auto* w = _weight.ptr<float>(ithr, h - hq_beg, 0) + kv_beg;
+            float max = std::numeric_limits<float>::lowest();
+            float sum = 0.0F;
+            if (alibi_slopes) {
+                const auto* alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - cur_kv_len + kv_beg;
+                scale_add2_reduce_max<true, false, false>(w,
+                                                          _d_scale,
+                                                          alibi_lookup,
+                                                          static_cast<const float*>(nullptr),
+                                                          nullptr,
+                                                          false,
+                                                          kv_len,
+                                                          alibi_slopes.ptr<float>()[h],
+                                                          max);
+            } else {
+                scale_add2_reduce_max<false, false, false>(w,
+                                                           _d_scale,
+                                                           nullptr,
+                                                           static_cast<const float*>(nullptr),
+                                                           nullptr,
+                                                           false,
+                                                           kv_len,
+                                                           0.0F,
+                                                           max);
+            }
+            exp_reduce_sum(w, max, kv_len, sum);
+            split_max_sum[h * 2] = max;
+            split_max_sum[h * 2 + 1] = sum;
+        }
+
+        memset(split_output + hq_beg * SV, 0, (hq_end - hq_beg) * SV * sizeof(float));
+        for (size_t pv = kv_beg, i = kv_beg / _block_size; pv < kv_end; pv += _block_size, i++) {
+            auto block_number = block_table[i];
+            for (size_t h = hq_beg; h < hq_end; h++) {
+                if constexpr (any_of(VALUE_PREC, ov::element::u8, ov::element::u4)) {
+                    attn_acc_value_block_quantized<uint8_t, VALUE_PREC>(
+                        split_output + h * SV,
+                        _weight.ptr<float>(ithr, h - hq_beg, 0) + pv,
+                        present_value.ptr<uint8_t, VALUE_PREC>(block_number, hk),
+                        SV,
+                        _params.quant_value_bychannel,
+                        std::min(_block_size, kv_end - pv),
+                        _params.value_group_size);
+                } else {
+                    auto* v_ptr =
+                        present_value.ptr<typename element_type_traits<VALUE_PREC>::value_type>(block_number, hk);
+                    attn_acc_value_block<typename element_type_traits<VALUE_PREC>::value_type, VALUE_PREC>(
+                        split_output + h * SV,
+                        _weight.ptr<float>(ithr, h - hq_beg, 0) + pv,
+                        v_ptr,
+                        SV,
+                        std::min(_block_size, kv_end - pv),
+                        _params.value_group_size);
+                }
+            }
+        }
+    }
+
+    // merge the parts of the split decode by their log-sum-exp into the output [H * SV]
+    //  split_output: [splits, H, SV], split_max_sum: [splits, H, 2]
+    void reduce_kv_splits(DATA_TYPE* output,
+                          const PlainTensor& split_output,
+                          const PlainTensor& split_max_sum,
+                          size_t split_beg,
+                          size_t split_cnt,
+                          size_t h,
+                          size_t ithr) {
+        float max = std::numeric_limits<float>::lowest();
+        for (size_t i = split_beg; i < split_beg + split_cnt; i++) {
+            max = std::max(max, split_max_sum.ptr<float>(i, h)[0]);
+        }
+        float sum = 0.0F;
+        auto* acc = _output.ptr<float>(ithr);
+        memset(acc, 0, SV * sizeof(float));
+        for (size_t i = split_beg; i < split_beg + split_cnt; i++) {
+            const auto* max_sum = split_max_sum.ptr<float>(i, h);
+            const auto factor = std::exp(max_sum[0] - max);
+            sum += max_sum[1] * factor;
+            const auto* src = split_output.ptr<float>(i, h);
+            for (size_t k = 0; k < SV; k++) {
+                acc[k] += src[k] * factor;
+            }
+        }
+        const auto inv_sum = 1.0F / sum;
+        for (size_t k = 0; k < SV; k++) {
+            acc[k] *= inv_sum;
+        }
+        cvt_copy(output + h * SV, acc, 1, SV, 0, 0);
+    }
+
     // compute one token, loop along batch, head dimensions and kv_len, it's special for very long kv_len with small
     // batch tokens. It will assume NO mixture execution of first and second token. all tensors such as query... have
     // batch dimension which is DIFFERENT from above
@@ -1491,6 +1643,26 @@ struct MHA {
     MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& _helper;
 
     WorkItems _workitems;
+    PagedAttnWorkPartitioner _partitioner;
+    std::vector<float> _attn_costs;
+
+    // attention work item or a part of the decode item split along the kv length
+    struct AttnTask {
+        int32_t item;
+        int32_t kv_split;  // index in the split buffers, -1 if the item is not split
+        int32_t kv_beg;
+        int32_t kv_end;
+    };
+    struct KVSplitItem {
+        int32_t item;
+        int32_t split_beg;
+        int32_t split_cnt;
+    };
+    std::vector<AttnTask> _attn_tasks;
+    std::vector<float> _task_costs;
+    std::vector<KVSplitItem> _kv_split_items;
+    PlainTensor _split_output;   // [splits, H, SV]
+    PlainTensor _split_max_sum;  // [splits, H, 2]
 
     MHA(MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& helper) : _helper(helper) {}
 
@@ -1622,7 +1794,7 @@ struct MHA {
         auto weight_h = loop_hk ? _helper.H / Hk : 1;
         _helper.resize_temporary_weight_buffer(weight_h);
         // attn_work_count num_sub_seq
-        parallel_for2d_dynamic(attn_work_count, loop_hk ? Hk : _helper.H, [&](size_t w, size_t hx) {
+        auto attn_loop = [&](size_t t, size_t hx) {
             size_t hk = 0;
             size_t hq_beg = 0;
             size_t hq_end = 0;
@@ -1636,7 +1808,8 @@ struct MHA {
                 hk = hx / _helper._h_each_group_len;
             }
 
-            const auto& item = _workitems.get_attn_work_item(w);
+            const auto& task = _attn_tasks[t];
+            const auto& item = _workitems.get_attn_work_item(task.item);
             const auto batch_in_seq = item.batch_in_seq;
             const auto batch_in_token = subsequence_begins.ptr<int32_t>()[batch_in_seq];
             const auto q_len = static_cast<size_t>(item.q_len);
@@ -1644,6 +1817,24 @@ struct MHA {
 
             if (q_len == 1) {
                 const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + 1;
+                if (task.kv_split >= 0) {
+                    _helper.exec_kernel_one_bh_kv_split(
+                        q.slice(0, batch_in_token, batch_in_token),
+                        k_cache,
+                        v_cache,
+                        block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[batch_in_seq],
+                        ithr,
+                        hq_beg,
+                        hq_end,
+                        hk,
+                        static_cast<size_t>(task.kv_beg),
+                        static_cast<size_t>(task.kv_end),
+                        cur_kv_len,
+                        alibi_slopes,
+                        _split_output.ptr<float>(task.kv_split),
+                        _split_max_sum.ptr<float>(task.kv_split));
+                    return;
+                }
                 float* score_output = nullptr;
                 if (output_score) {
                     const auto score_win_len =
@@ -1763,7 +1954,84 @@ struct MHA {
                     score_info_ptr);
 #    endif
             }
+        };
+
+        // prefill chunks and decode items of a continuous batch have very different costs, so the work is ordered
+        // by the estimated cost to not leave the long contexts to the end of the loop
+        const auto h_dims = loop_hk ? Hk : _helper.H;
+        float total_cost = 0.0F;
+        _attn_costs.resize(attn_work_count);
+        for (size_t w = 0; w < attn_work_count; w++) {
+            const auto& item = _workitems.get_attn_work_item(w);
+            const auto past_len = static_cast<size_t>(past_lens.ptr<int32_t>()[item.batch_in_seq]);
+            if (item.q_len == 1) {
+                _attn_costs[w] = PagedAttnWorkPartitioner::cost(1, past_len + 1);
+            } else {
+                const auto q_beg = item.q_block_id * _helper._block_size;
+                const auto q_cnt = std::min(_helper._block_size, static_cast<size_t>(item.q_len) - q_beg);
+                _attn_costs[w] = PagedAttnWorkPartitioner::cost(q_cnt, past_len + q_beg + q_cnt);
+            }
+            total_cost += _attn_costs[w];
+        }
+
+        // the long decode items outweighing a thread are split along the kv length (flash decoding), the scores
+        // output needs the whole softmax of the item, so nothing is split then
+        const auto avg_thread_load = total_cost * static_cast<float>(h_dims) / static_cast<float>(_helper._nthr);
+        _attn_tasks.clear();
+        _task_costs.clear();
+        _kv_split_items.clear();
+        int32_t split_count = 0;
+        for (size_t w = 0; w < attn_work_count; w++) {
+            const auto& item = _workitems.get_attn_work_item(w);
+            if (item.q_len == 1 && !output_score) {
+                const auto kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[item.batch_in_seq]) + 1;
+                const auto kv_blocks = div_up(kv_len, _helper._block_size);
+                const auto split_blocks =
+                    PagedAttnWorkPartitioner::decode_kv_split_blocks(kv_len, _helper._block_size, avg_thread_load);
+                if (split_blocks < kv_blocks) {
+                    const auto split_len = split_blocks * _helper._block_size;
+                    const auto split_cnt = static_cast<int32_t>(div_up(kv_blocks, split_blocks));
+                    _kv_split_items.push_back(KVSplitItem{static_cast<int32_t>(w), split_count, split_cnt});
+                    for (size_t kv_beg = 0; kv_beg < kv_len; kv_beg += split_len) {
+                        const auto kv_end = std::min(kv_len, kv_beg + split_len);
+                        _attn_tasks.push_back(AttnTask{static_cast<int32_t>(w),
+                                                       split_count++,
+                                                       static_cast<int32_t>(kv_beg),
+                                                       static_cast<int32_t>(kv_end)});
+                        _task_costs.push_back(PagedAttnWorkPartitioner::cost(1, kv_end - kv_beg));
+                    }
+                    continue;
+                }
+            }
+            _attn_tasks.push_back(AttnTask{static_cast<int32_t>(w), -1, 0, 0});
+            _task_costs.push_back(_attn_costs[w]);
+        }
+        if (split_count > 0) {
+            _split_output.resize<float>({static_cast<size_t>(split_count), _helper.H, _helper.SV});
+            _split_max_sum.resize<float>({static_cast<size_t>(split_count), _helper.H, 2});
+        }
+
+        // the threads still pick the work dynamically, the costliest tasks just go first
+        _partitioner.reset(_task_costs);
+        const auto& order = _partitioner.get_order();
+        parallel_for2d_dynamic(order.size(), h_dims, [&](size_t i, size_t hx) {
+            attn_loop(static_cast<size_t>(order[i]), hx);
         });
+
+        if (!_kv_split_items.empty()) {
+            parallel_for2d_dynamic(_kv_split_items.size(), _helper.H, [&](size_t i, size_t h) {
+                const auto& split = _kv_split_items[i];
+                const auto& item = _workitems.get_attn_work_item(split.item);
+                const auto batch_in_token = subsequence_begins.ptr<int32_t>()[item.batch_in_seq];
+                _helper.reduce_kv_splits(output_emb.ptr<DATA_TYPE>(batch_in_token),
+                                         _split_output,
+                                         _split_max_sum,
+                                         split.split_beg,
+                                         split.split_cnt,
+                                         h,
+                                         static_cast<size_t>(parallel_get_thread_num()));
+            });
+        }
         if (output_score) {
             parallel_for2d_dynamic(past_lens.m_dims[0], 1, [&](size_t b, [[maybe_unused]] size_t pq) {
                 auto seq_len = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b + 1] -
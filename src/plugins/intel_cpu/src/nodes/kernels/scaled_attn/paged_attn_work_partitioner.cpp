@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "paged_attn_work_partitioner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace ov::Extensions::Cpu {
+
+float PagedAttnWorkPartitioner::cost(size_t q_cnt, size_t kv_len) {
+    const auto kv = static_cast<float>(kv_len);
+    if (q_cnt == 1) {
+        return decode_cost_factor * kv + item_overhead;
+    }
+    return static_cast<float>(q_cnt) * kv + item_overhead;
+}
+
+size_t PagedAttnWorkPartitioner::decode_kv_split_blocks(size_t kv_len, size_t block_size, float avg_thread_load) {
+    const auto kv_blocks = (kv_len + block_size - 1) / block_size;
+    const auto item_cost = cost(1, kv_len);
+    if (item_cost <= avg_thread_load) {
+        return kv_blocks;
+    }
+    // parts of a half of the average load leave the room to balance them with the rest of the work
+    const auto parts = static_cast<size_t>(std::ceil(2.0F * item_cost / avg_thread_load));
+    const auto min_blocks = (min_kv_split_len + block_size - 1) / block_size;
+    const auto blocks = std::max(min_blocks, (kv_blocks + parts - 1) / parts);
+    return std::min(blocks, kv_blocks);
+}
+
+void PagedAttnWorkPartitioner::reset(const std::vector<float>& item_costs) {
+    m_order.resize(item_costs.size());
+    std::iota(m_order.begin(), m_order.end(), 0);
+    // uniform batches (e.g. the decode only ones of the same length) are already in order
+    if (std::is_sorted(item_costs.begin(), item_costs.end(), std::greater<>())) {
+        return;
+    }
+    std::stable_sort(m_order.begin(), m_order.end(), [&](int32_t a, int32_t b) {
+        return item_costs[a] > item_costs[b];
+    });
+}
+
+}  // namespace ov::Extensions::Cpu
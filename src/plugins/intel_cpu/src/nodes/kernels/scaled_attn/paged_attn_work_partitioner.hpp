@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov::Extensions::Cpu {
+
+/**
+ * @brief Orders the attention work items of a continuous batch by their estimated cost.
+ *
+ * A batch may mix the prefill chunks of long prompts with the single token decode of the other sequences, the costs of
+ * their work items differ by orders of magnitude. The items are still scheduled dynamically, the partitioner only puts
+ * the costly ones first, so they are not picked up last and the cheap ones fill the tail of the loop. The cost affects
+ * the order only, an inaccurate estimate cannot leave the threads idle.
+ */
+class PagedAttnWorkPartitioner {
+public:
+    // cost of a kv position of the decode relative to a (query, kv) pair of the prefill,
+    // the decode is memory bound while the prefill chunks reuse the loaded K/V blocks for all their queries
+    static constexpr float decode_cost_factor = 4.0F;
+    // fixed cost of a work item in the kv positions: the scratch setup, softmax and the output write
+    static constexpr float item_overhead = 64.0F;
+    // minimal kv length of a part of the split decode item
+    static constexpr size_t min_kv_split_len = 512;
+
+    /**
+     * @brief Estimates the cost of the attention work item
+     * @param q_cnt number of the queries of the item, 1 for the decode
+     * @param kv_len number of the kv positions visible to the last query of the item
+     */
+    static float cost(size_t q_cnt, size_t kv_len);
+
+    /**
+     * @brief Returns the number of the kv blocks in a part of the decode item split along the kv length
+     *
+     * A decode item costlier than the average load of a thread bounds the latency of the whole batch (e.g. a long
+     * context when batch * heads is less than the number of the threads), so its kv range is split into the parts
+     * computed in parallel and merged by their log-sum-exp (flash decoding).
+     * @param kv_len kv length of the decode item
+     * @param block_size kv cache block size
+     * @param avg_thread_load total cost of the batch divided by the number of the threads
+     * @return number of the blocks per part, all the kv blocks if the item should not be split
+     */
+    static size_t decode_kv_split_blocks(size_t kv_len, size_t block_size, float avg_thread_load);
+
+    /**
+     * @brief Builds the order of the work items, the costliest first
+     * @param item_costs cost of every work item
+     */
+    void reset(const std::vector<float>& item_costs);
+
+    /**
+     * @brief Returns the work item ids in the order of decreasing cost
+     */
+    [[nodiscard]] const std::vector<int32_t>& get_order() const {
+        return m_order;
+    }
+
+private:
+    std::vector<int32_t> m_order;
+};
+
+}  // namespace ov::Extensions::Cpu
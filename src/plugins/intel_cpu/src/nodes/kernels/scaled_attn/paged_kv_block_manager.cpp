@@ -0,0 +1,252 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "paged_kv_block_manager.hpp"
+
+#include <algorithm>
+#include <common/utils.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "utils/general_utils.h"
+#include "utils/plain_tensor.hpp"
+
+namespace ov::Extensions::Cpu {
+
+PagedKVBlockManager::PagedKVBlockManager(size_t num_blocks, size_t block_size)
+    : m_block_size(block_size),
+      m_blocks(num_blocks) {
+    OPENVINO_ASSERT(block_size > 0, "PagedKVBlockManager: block size must be positive");
+    m_free_blocks.resize(num_blocks);
+    // the blocks with the lower numbers are allocated first
+    for (size_t i = 0; i < num_blocks; i++) {
+        m_free_blocks[i] = static_cast<int32_t>(num_blocks - 1 - i);
+    }
+}
+
+size_t PagedKVBlockManager::add_sequence(uint64_t seq_id, const std::vector<int64_t>& tokens) {
+    OPENVINO_ASSERT(m_sequences.count(seq_id) == 0, "PagedKVBlockManager: sequence ", seq_id, " already exists");
+    OPENVINO_ASSERT(!tokens.empty(), "PagedKVBlockManager: sequence ", seq_id, " has no tokens");
+    Sequence sequence;
+    // at least the last token is computed to get its logits
+    const size_t max_shared_blocks = (tokens.size() - 1) / m_block_size;
+    size_t parent_hash = 0;
+    for (size_t i = 0; i < max_shared_blocks; i++) {
+        const int64_t* block_tokens = tokens.data() + i * m_block_size;
+        const size_t hash = hash_block(parent_hash, block_tokens);
+        const int32_t block = find_cached_block(parent_hash, hash, block_tokens);
+        if (block < 0) {
+            break;
+        }
+        acquire_block(block);
+        sequence.blocks.push_back(block);
+        parent_hash = hash;
+    }
+    sequence.num_computed = sequence.blocks.size() * m_block_size;
+    try {
+        reserve_slots(sequence, tokens.size());
+    } catch (...) {
+        for (auto block : sequence.blocks) {
+            release_block(block);
+        }
+        throw;
+    }
+    sequence.tokens = tokens;
+    const size_t num_cached = sequence.num_computed;
+    m_sequences.emplace(seq_id, std::move(sequence));
+    return num_cached;
+}
+
+void PagedKVBlockManager::append_tokens(uint64_t seq_id, const std::vector<int64_t>& tokens) {
+    auto& sequence = get_sequence(seq_id);
+    reserve_slots(sequence, sequence.tokens.size() + tokens.size());
+    sequence.tokens.insert(sequence.tokens.end(), tokens.begin(), tokens.end());
+}
+
+void PagedKVBlockManager::fork_sequence(uint64_t parent_id, uint64_t child_id) {
+    OPENVINO_ASSERT(m_sequences.count(child_id) == 0, "PagedKVBlockManager: sequence ", child_id, " already exists");
+    Sequence child = get_sequence(parent_id);
+    for (auto block : child.blocks) {
+        acquire_block(block);
+    }
+    m_sequences.emplace(child_id, std::move(child));
+}
+
+void PagedKVBlockManager::free_sequence(uint64_t seq_id) {
+    auto& sequence = get_sequence(seq_id);
+    // release from the tail, so the prefix blocks are evicted last
+    for (auto it = sequence.blocks.rbegin(); it != sequence.blocks.rend(); ++it) {
+        release_block(*it);
+    }
+    m_sequences.erase(seq_id);
+}
+
+void PagedKVBlockManager::commit(const std::vector<uint64_t>& seq_ids) {
+    for (auto seq_id : seq_ids) {
+        auto& sequence = get_sequence(seq_id);
+        const size_t first_block = sequence.num_computed / m_block_size;
+        const size_t full_blocks = sequence.tokens.size() / m_block_size;
+        for (size_t i = first_block; i < full_blocks; i++) {
+            auto& block = m_blocks[sequence.blocks[i]];
+            const int64_t* block_tokens = sequence.tokens.data() + i * m_block_size;
+            const size_t parent_hash = i > 0 ? m_blocks[sequence.blocks[i - 1]].hash : 0;
+            block.parent_hash = parent_hash;
+            block.hash = hash_block(parent_hash, block_tokens);
+            block.tokens.assign(block_tokens, block_tokens + m_block_size);
+            // the block shared by the forked sequences is registered once, the same prefix computed by another
+            // sequence in the same step is kept as a private block
+            if (!block.cached && find_cached_block(parent_hash, block.hash, block_tokens) < 0) {
+                m_prefix_table.emplace(block.hash, sequence.blocks[i]);
+                block.cached = true;
+            }
+        }
+        sequence.num_computed = sequence.tokens.size();
+    }
+}
+
+PagedKVBlockManager::Inputs PagedKVBlockManager::get_inputs(const std::vector<uint64_t>& seq_ids) const {
+    Inputs inputs;
+    inputs.subsequence_begins.push_back(0);
+    inputs.block_indices_begins.push_back(0);
+    for (auto seq_id : seq_ids) {
+        const auto& sequence = get_sequence(seq_id);
+        const auto num_scheduled = sequence.tokens.size() - sequence.num_computed;
+        inputs.past_lens.push_back(static_cast<int32_t>(sequence.num_computed));
+        inputs.subsequence_begins.push_back(inputs.subsequence_begins.back() + static_cast<int32_t>(num_scheduled));
+        inputs.block_indices.insert(inputs.block_indices.end(), sequence.blocks.begin(), sequence.blocks.end());
+        inputs.block_indices_begins.push_back(static_cast<int32_t>(inputs.block_indices.size()));
+    }
+    return inputs;
+}
+
+std::vector<PagedKVBlockManager::BlockCopy> PagedKVBlockManager::take_copies() {
+    std::vector<BlockCopy> copies;
+    copies.swap(m_copies);
+    return copies;
+}
+
+const std::vector<int32_t>& PagedKVBlockManager::get_block_table(uint64_t seq_id) const {
+    return get_sequence(seq_id).blocks;
+}
+
+size_t PagedKVBlockManager::get_num_free_blocks() const {
+    return m_free_blocks.size() + m_evictable_blocks.size();
+}
+
+size_t PagedKVBlockManager::get_ref_count(int32_t block) const {
+    return m_blocks.at(block).ref_count;
+}
+
+PagedKVBlockManager::Sequence& PagedKVBlockManager::get_sequence(uint64_t seq_id) {
+    auto it = m_sequences.find(seq_id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedKVBlockManager: unknown sequence ", seq_id);
+    return it->second;
+}
+
+const PagedKVBlockManager::Sequence& PagedKVBlockManager::get_sequence(uint64_t seq_id) const {
+    auto it = m_sequences.find(seq_id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedKVBlockManager: unknown sequence ", seq_id);
+    return it->second;
+}
+
+int32_t PagedKVBlockManager::allocate_block() {
+    int32_t block = -1;
+    if (!m_free_blocks.empty()) {
+        block = m_free_blocks.back();
+        m_free_blocks.pop_back();
+    } else {
+        OPENVINO_ASSERT(!m_evictable_blocks.empty(), "PagedKVBlockManager: out of KV cache blocks");
+        block = m_evictable_blocks.front();
+        m_evictable_blocks.pop_front();
+        auto range = m_prefix_table.equal_range(m_blocks[block].hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == block) {
+                m_prefix_table.erase(it);
+                break;
+            }
+        }
+    }
+    auto& info = m_blocks[block];
+    info.ref_count = 1;
+    info.cached = false;
+    info.tokens.clear();
+    return block;
+}
+
+void PagedKVBlockManager::acquire_block(int32_t block) {
+    auto& info = m_blocks[block];
+    if (info.ref_count == 0 && info.cached) {
+        m_evictable_blocks.erase(info.lru_pos);
+    }
+    info.ref_count++;
+}
+
+void PagedKVBlockManager::release_block(int32_t block) {
+    auto& info = m_blocks[block];
+    OPENVINO_ASSERT(info.ref_count > 0, "PagedKVBlockManager: block ", block, " is released twice");
+    if (--info.ref_count > 0) {
+        return;
+    }
+    if (info.cached) {
+        info.lru_pos = m_evictable_blocks.insert(m_evictable_blocks.end(), block);
+    } else {
+        m_free_blocks.push_back(block);
+    }
+}
+
+void PagedKVBlockManager::reserve_slots(Sequence& sequence, size_t num_tokens) {
+    const size_t current_tokens = sequence.tokens.size();
+    if (num_tokens <= current_tokens) {
+        return;
+    }
+    // the partially filled last block is written by the new tokens, so it is copied if shared
+    if (current_tokens % m_block_size != 0) {
+        auto& last = sequence.blocks.back();
+        if (m_blocks[last].ref_count > 1) {
+            const int32_t copy = allocate_block();
+            m_copies.push_back(BlockCopy{last, copy});
+            release_block(last);
+            last = copy;
+        }
+    }
+    const size_t num_blocks = ov::intel_cpu::div_up(num_tokens, m_block_size);
+    while (sequence.blocks.size() < num_blocks) {
+        sequence.blocks.push_back(allocate_block());
+    }
+}
+
+int32_t PagedKVBlockManager::find_cached_block(size_t parent_hash, size_t hash, const int64_t* tokens) const {
+    auto range = m_prefix_table.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto& block = m_blocks[it->second];
+        if (block.parent_hash == parent_hash && std::equal(block.tokens.begin(), block.tokens.end(), tokens)) {
+            return it->second;
+        }
+    }
+    return -1;
+}
+
+size_t PagedKVBlockManager::hash_block(size_t parent_hash, const int64_t* tokens) const {
+    size_t seed = parent_hash;
+    for (size_t i = 0; i < m_block_size; i++) {
+        seed = dnnl::impl::hash_combine(seed, tokens[i]);
+    }
+    return seed;
+}
+
+void copy_blocks(const ov::intel_cpu::PlainTensor& key_cache,
+                 const ov::intel_cpu::PlainTensor& value_cache,
+                 const std::vector<PagedKVBlockManager::BlockCopy>& copies) {
+    // [block_number, H, block_size, S], a block is contiguous for all the heads
+    parallel_for(copies.size(), [&](size_t i) {
+        const auto& copy = copies[i];
+        std::memcpy(key_cache.ptr_v(copy.dst), key_cache.ptr_v(copy.src), key_cache.stride_bytes(0));
+        std::memcpy(value_cache.ptr_v(copy.dst), value_cache.ptr_v(copy.src), value_cache.stride_bytes(0));
+    });
+}
+
+}  // namespace ov::Extensions::Cpu
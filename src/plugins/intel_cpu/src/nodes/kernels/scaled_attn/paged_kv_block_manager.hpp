@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/plain_tensor.hpp"
+
+namespace ov::Extensions::Cpu {
+
+/**
+ * @brief Manages the blocks of the PagedAttention KV cache ([block_number, H, block_size, S]) for a set of sequences.
+ *
+ * The blocks are reference counted, so the sequences may share them:
+ *  - the full blocks of the prompts are registered in the prefix table by the hash of all the tokens up to the end of
+ *    the block, so a new sequence starting with the same prefix (e.g. system prompt) reuses the computed blocks and
+ *    only its tail has to be processed by the prefill;
+ *  - a forked sequence shares all the blocks of the parent one, the shared partially filled block is copied before it
+ *    is written (copy-on-write).
+ * The released blocks of the prefix table stay cached until their space is needed by a new allocation (LRU order).
+ *
+ * The expected flow of a generation step:
+ *  1. add_sequence / append_tokens / fork_sequence / free_sequence to schedule the step;
+ *  2. copy_blocks with take_copies() to apply the pending copy-on-write copies to the cache;
+ *  3. get_inputs to fill the past_lens, subsequence_begins, block_indices and block_indices_begins inputs of
+ *     PagedAttention and execute it;
+ *  4. commit with the same sequences to mark their scheduled tokens computed and share their full blocks.
+ * The class is not thread-safe.
+ */
+class PagedKVBlockManager {
+public:
+    struct BlockCopy {
+        int32_t src;
+        int32_t dst;
+    };
+
+    struct Inputs {
+        std::vector<int32_t> past_lens;
+        std::vector<int32_t> subsequence_begins;
+        std::vector<int32_t> block_indices;
+        std::vector<int32_t> block_indices_begins;
+    };
+
+    PagedKVBlockManager(size_t num_blocks, size_t block_size);
+
+    /**
+     * @brief Adds a new sequence with the given prompt
+     * @return The number of the prompt tokens found in the cache, which do not need to be computed
+     */
+    size_t add_sequence(uint64_t seq_id, const std::vector<int64_t>& tokens);
+
+    /**
+     * @brief Appends the tokens (e.g. the generated ones) to be computed by the next step
+     */
+    void append_tokens(uint64_t seq_id, const std::vector<int64_t>& tokens);
+
+    /**
+     * @brief Creates a new sequence sharing all the tokens and blocks of the parent one
+     */
+    void fork_sequence(uint64_t parent_id, uint64_t child_id);
+
+    void free_sequence(uint64_t seq_id);
+
+    /**
+     * @brief Marks the scheduled tokens of the given sequences computed and registers their full blocks in the prefix
+     * table. The sequences must be the ones executed by the step, the rest keep their tokens scheduled.
+     */
+    void commit(const std::vector<uint64_t>& seq_ids);
+
+    /**
+     * @brief Fills the PagedAttention inputs for the scheduled tokens of the given sequences
+     */
+    [[nodiscard]] Inputs get_inputs(const std::vector<uint64_t>& seq_ids) const;
+
+    /**
+     * @brief Returns the copies which must be applied to the cache before the next execution and clears them
+     */
+    std::vector<BlockCopy> take_copies();
+
+    [[nodiscard]] const std::vector<int32_t>& get_block_table(uint64_t seq_id) const;
+    [[nodiscard]] size_t get_num_free_blocks() const;
+    [[nodiscard]] size_t get_ref_count(int32_t block) const;
+
+private:
+    struct Block {
+        size_t ref_count = 0;
+        size_t hash = 0;              // hash of the tokens from the beginning of the sequence up to the end of the block
+        size_t parent_hash = 0;       // hash of the previous block
+        std::vector<int64_t> tokens;  // tokens of the block, to verify the matches of the prefix table
+        bool cached = false;          // registered in the prefix table
+        std::list<int32_t>::iterator lru_pos;
+    };
+
+    struct Sequence {
+        std::vector<int64_t> tokens;
+        std::vector<int32_t> blocks;
+        size_t num_computed = 0;
+    };
+
+    Sequence& get_sequence(uint64_t seq_id);
+    [[nodiscard]] const Sequence& get_sequence(uint64_t seq_id) const;
+    int32_t allocate_block();
+    void acquire_block(int32_t block);
+    void release_block(int32_t block);
+    void reserve_slots(Sequence& sequence, size_t num_tokens);
+    [[nodiscard]] int32_t find_cached_block(size_t parent_hash, size_t hash, const int64_t* tokens) const;
+    [[nodiscard]] size_t hash_block(size_t parent_hash, const int64_t* tokens) const;
+
+    size_t m_block_size;
+    std::vector<Block> m_blocks;
+    std::vector<int32_t> m_free_blocks;
+    // the cached blocks which are not used by any sequence, the least recently used first
+    std::list<int32_t> m_evictable_blocks;
+    std::unordered_multimap<size_t, int32_t> m_prefix_table;
+    std::unordered_map<uint64_t, Sequence> m_sequences;
+    std::vector<BlockCopy> m_copies;
+};
+
+/**
+ * @brief Copies the blocks of the key and value caches, e.g. to apply the copy-on-write copies of PagedKVBlockManager
+ */
+void copy_blocks(const ov::intel_cpu::PlainTensor& key_cache,
+                 const ov::intel_cpu::PlainTensor& value_cache,
+                 const std::vector<PagedKVBlockManager::BlockCopy>& copies);
+
+}  // namespace ov::Extensions::Cpu
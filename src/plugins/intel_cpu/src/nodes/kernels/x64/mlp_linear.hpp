@@ -0,0 +1,313 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <oneapi/dnnl/dnnl_types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "mlp_kernel.hpp"
+#include "mlp_utils.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+#include "utils/debug_capabilities.h"
+
+// Linear layers of the LLM MLP built on MKernel, shared by the LLMMLP and MoE nodes
+
+namespace ov::intel_cpu {
+
+template <typename T>
+class LinearKsplit2 {
+public:
+    std::vector<Work> works;
+
+    int used_nthr = 0;
+
+    WeightBuffer wbuffer;
+
+    LinearKsplit2() = default;
+
+    // weight [N, K]
+    // Gate & Up are interleaved in N dimension: 16-gate / 16-up
+    // and post-ops will compute  silu(gate)*up in unit of 16 elements
+    // and store out as bfloat16.
+    void setup(void* p_weight, int stride, int N, int K, const LLMMLPNode::Config& config) {
+        bool is_quantized = config.down_quantized;
+
+        auto reg_blk_K_size = is_quantized ? REG_BLK_K_SIZE_I8 : REG_BLK_K_SIZE;
+        auto cache_blk_k_size = CACHE_BLK_K_SIZE;
+        auto weight_element_size = is_quantized ? sizeof(int8_t) : sizeof(ov::float16);
+
+        OPENVINO_ASSERT((N % REG_BLK_N_SIZE) == 0);
+        OPENVINO_ASSERT((K % reg_blk_K_size) == 0);
+        m_threads_num = parallel_get_max_threads();
+        auto num_blk_N = N / REG_BLK_N_SIZE;
+        works.resize(m_threads_num);
+
+        auto K_splits = 2;
+        // split task on more cores is better on TBB
+        auto valid_nthr = m_threads_num / 2;
+        auto blkN_per_thread = (num_blk_N) / valid_nthr;
+        auto blkN_leftover = num_blk_N - (blkN_per_thread * valid_nthr);
+        auto start_blkN = 0;
+        used_nthr = 0;
+
+        for (int ithr = 0; ithr < m_threads_num; ithr += K_splits) {
+            auto blkN = std::min(num_blk_N - start_blkN, blkN_per_thread);
+            if (blkN_leftover > 0) {
+                blkN_leftover--;
+                blkN++;
+            }
+            if (blkN) {
+                auto shared_atomic = std::make_shared<std::atomic_int>(0);
+
+                // split K dimension in unit of 32 evenly among 2 worker-threads
+                auto start_blkK = 0;
+                auto num_blk_K = K / reg_blk_K_size;
+                auto blkK_per_thread = (num_blk_K + 1) / 2;
+                for (int ik = 0; ik < K_splits; ik++) {
+                    auto blk_K = std::min(num_blk_K - start_blkK, blkK_per_thread);
+
+                    auto& work = works[ithr + ik];
+
+                    work.sync_flag = shared_atomic;
+                    work.blk_K_size = cache_blk_k_size;
+
+                    work.n0 = (start_blkN)*REG_BLK_N_SIZE;
+                    work.n1 = (start_blkN + blkN) * REG_BLK_N_SIZE;
+                    work.BN = blkN * REG_BLK_N_SIZE;
+                    work.k0 = start_blkK * reg_blk_K_size;
+                    work.k1 = (start_blkK + blk_K) * reg_blk_K_size;
+                    work.quant_i8 = is_quantized;
+                    work.is_f16 = std::is_same_v<T, ov::float16>;
+
+                    start_blkK += blk_K;
+                    used_nthr++;
+                }
+            }
+
+            start_blkN += blkN;
+        }
+
+        DEBUG_LOG("Linear N,K=", N, ",", K, " used_nthr=", used_nthr);
+
+        wbuffer.alloc(works, weight_element_size);
+
+        ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, [[maybe_unused]] const size_t nthr) {
+            auto& work = works[ithr];
+            if (work) {
+                if (is_quantized) {
+                    work.setup(wbuffer.get<int8_t>(ithr), reinterpret_cast<int8_t*>(p_weight), stride, true);
+                } else {
+                    work.setup(wbuffer.get<T>(ithr), reinterpret_cast<ov::float16*>(p_weight), stride);
+                }
+            }
+        });
+        DEBUG_LOG("   setup is done. weight @ ", static_cast<void*>(p_weight));
+    }
+
+    void run(uint8_t* pA,
+             int strideA,
+             int M,
+             T* dstC,
+             int strideC,
+             const LLMMLPNode::Config& config,
+             MatrixDynQuantPerRow& src_dq,
+             float* w_scale) {
+        static ReduceAdd2bh jit_reduce2cvt(true, std::is_same_v<T, ov::float16>);
+
+        ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, [[maybe_unused]] const size_t nthr) {
+            auto& work = works[ithr];
+            auto& workC = work.m_C;
+            if (work) {
+                work.run(M, pA, strideA);
+
+                if (config.down_quantized) {
+                    // de-quantize i32 results in-place into f32
+                    auto* ptr_c = work.m_C.template ptr<float>();
+                    auto* ptr_wsum = work.w_sum_per_oc.template ptr<float>();
+                    auto stride_c = work.m_C.stride(0);
+                    ov::Extensions::Cpu::XARCH::llm_mlp_dequantize_i32_f32(M,
+                                                                           work.BN,
+                                                                           reinterpret_cast<int32_t*>(ptr_c),
+                                                                           stride_c,
+                                                                           ptr_c,
+                                                                           stride_c,
+                                                                           src_dq.scale,
+                                                                           src_dq.zp,
+                                                                           ptr_wsum,
+                                                                           w_scale + work.n0,
+                                                                           src_dq.asym);
+                }
+
+                auto sync_id = work.sync_flag->fetch_add(1);
+                // (0,1) (2,3)
+                if (sync_id & 1) {
+                    auto peer_ithr = (ithr & 1) ? (ithr - 1) : (ithr + 1);
+                    auto* p_peerC = works[peer_ithr].m_C.template ptr<float>();
+                    // the other one has finished, we can do the reduce sum
+                    auto* p_curC = workC.template ptr<float>();
+                    jit_reduce2cvt
+                        .call(p_curC, p_peerC, workC.stride(0), dstC + work.n0, strideC / sizeof(*dstC), M, work.BN);
+                }
+            }
+        });
+    }
+
+private:
+    int m_threads_num = 0;
+};
+
+template <typename T>
+class LinearGateUp {
+public:
+    std::vector<Work> works;
+
+    int used_nthr = 0;
+
+    LinearGateUp() = default;
+
+    WeightBuffer wbuffer;
+
+    GateUpCombine* jit_gateup = nullptr;
+
+    // weight [N, K]
+    // Gate & Up are interleaved in N dimension: 16-gate / 16-up
+    // and post-ops will compute  silu(gate)*up in unit of 16 elements
+    // and store out as bfloat16.
+    void setup(void* p_weight_gate, void* p_weight_up, int stride, int N, int K, const LLMMLPNode::Config& config) {
+        static GateUpCombine jit_gateup_silu(dnnl_eltwise_swish, std::is_same_v<T, ov::float16>);
+        static GateUpCombine jit_gateup_gelu(dnnl_eltwise_gelu_tanh, std::is_same_v<T, ov::float16>);
+
+        if (config.act == LLMMLPNode::ACT_FN::GELU) {
+            jit_gateup = &jit_gateup_gelu;
+        } else if (config.act == LLMMLPNode::ACT_FN::SILU) {
+            jit_gateup = &jit_gateup_silu;
+        } else {
+            OPENVINO_THROW("unsupported act in GateUpCombine");
+        }
+
+        bool quantized_int8 = config.gate_up_quantized;
+
+        auto reg_blk_K_size = quantized_int8 ? REG_BLK_K_SIZE_I8 : REG_BLK_K_SIZE;
+        auto cache_blk_k_size = CACHE_BLK_K_SIZE;
+        auto weight_element_size = quantized_int8 ? sizeof(int8_t) : sizeof(ov::float16);
+
+        // prepare weights, split N among threads
+        // in unit of 32
+        OPENVINO_ASSERT((N % REG_BLK_N_SIZE) == 0);
+        OPENVINO_ASSERT((K % reg_blk_K_size) == 0);
+        m_threads_num = parallel_get_max_threads();
+        auto num_blk_N = N / REG_BLK_N_SIZE;
+        works.resize(m_threads_num);
+
+        // split task on more cores is better on TBB
+        auto valid_nthr = m_threads_num;
+        auto blkN_per_thread = (num_blk_N) / valid_nthr;
+        auto blkN_leftover = num_blk_N - (blkN_per_thread * valid_nthr);
+        auto start_blkN = 0;
+        used_nthr = 0;
+
+        for (int ithr = 0; ithr < m_threads_num; ithr++) {
+            auto blkN = std::min(num_blk_N - start_blkN, blkN_per_thread);
+            if (blkN_leftover > 0) {
+                blkN_leftover--;
+                blkN++;
+            }
+            if (blkN) {
+                auto& work = works[ithr];
+                work.sync_flag = std::make_shared<std::atomic_int>(0);
+                work.blk_K_size = cache_blk_k_size;
+
+                work.n0 = (start_blkN)*REG_BLK_N_SIZE;
+                work.n1 = (start_blkN + blkN) * REG_BLK_N_SIZE;
+                work.BN = blkN * REG_BLK_N_SIZE;
+                work.k0 = 0;
+                work.k1 = K;
+                work.quant_i8 = quantized_int8;
+                work.is_f16 = std::is_same_v<T, ov::float16>;
+                used_nthr++;
+            }
+
+            start_blkN += blkN;
+        }
+        wbuffer.alloc(works, weight_element_size);
+
+        DEBUG_LOG("Linear N,K=", N, ",", K, " used_nthr=", used_nthr);
+        ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, [[maybe_unused]] const size_t nthr) {
+            auto& work = works[ithr];
+            if (work) {
+                if (quantized_int8) {
+                    work.setup(wbuffer.get<int8_t>(ithr),
+                               reinterpret_cast<int8_t*>(p_weight_gate),
+                               reinterpret_cast<int8_t*>(p_weight_up),
+                               stride,
+                               true);
+                } else {
+                    work.setup(wbuffer.get<T>(ithr),
+                               reinterpret_cast<ov::float16*>(p_weight_gate),
+                               reinterpret_cast<ov::float16*>(p_weight_up),
+                               stride);
+                }
+            }
+        });
+        DEBUG_LOG("   setup is done. weight @ ", static_cast<void*>(p_weight_gate));
+    }
+
+    // gate & up are interleaved: 16 gates + 16 up
+    void runGateUp(uint8_t* pA,
+                   int strideA_in_bytes,
+                   int M,
+                   T* dstC,
+                   int strideC,
+                   const LLMMLPNode::Config& config,
+                   MatrixDynQuantPerRow& src_dq,
+                   float* w_scale) {
+        ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, [[maybe_unused]] const size_t nthr) {
+            auto& work = works[ithr];
+            if (work) {
+                work.run(M, pA, strideA_in_bytes);
+
+                // K reduce is done, results of [M, BN] sub-block is ready in L2.
+                // combine Gate & Up
+                float* ptr_c = nullptr;
+                size_t stride_c = 0;
+                if (config.gate_up_quantized) {
+                    // dequantize m_C in-place
+                    ptr_c = work.m_C.template ptr<float>();
+                    stride_c = work.m_C.stride(0);
+                    auto* p_wsum = work.w_sum_per_oc.template ptr<float>();
+                    ov::Extensions::Cpu::XARCH::llm_mlp_dequantize_i32_f32(M,
+                                                                           work.BN,
+                                                                           reinterpret_cast<int32_t*>(ptr_c),
+                                                                           stride_c,
+                                                                           ptr_c,
+                                                                           stride_c,
+                                                                           src_dq.scale,
+                                                                           src_dq.zp,
+                                                                           p_wsum,
+                                                                           w_scale + work.n0,
+                                                                           src_dq.asym);
+                } else {
+                    ptr_c = work.m_C.template ptr<float>();
+                    stride_c = work.m_C.stride(0);
+                }
+                jit_gateup->call(ptr_c, stride_c, dstC + (work.n0 / 2), strideC / sizeof(*dstC), M, work.BN);
+            }
+        });
+    }
+
+private:
+    int m_threads_num = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -4,28 +4,55 @@
 
 #include "lora.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cpu_memory.h"
+#include "cpu_shape.h"
+#include "cpu_types.h"
+#include "dnnl_extension_utils.h"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "node.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "nodes/input.h"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 #include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
+namespace {
+
+constexpr size_t MAIN_INPUT = 0;
+constexpr size_t LORA_INPUT = 1;
+constexpr size_t A_INPUT = 2;
+constexpr size_t ALPHA_INPUT = 3;
+constexpr size_t B_INPUT = 4;
+constexpr size_t ADAPTER_INDICES_INPUT = 5;
+
+}  // namespace
+
 bool LoRA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<ov::op::internal::LoraSubgraph>(op)) {
@@ -52,6 +79,36 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    m_multiAdapter = op->get_input_size() == ADAPTER_INDICES_INPUT + 1;
+    if (!m_multiAdapter) {
+        return;
+    }
+    // the adapter banks are gathered by the adapter indices and passed to the MatMuls as the second input
+    bool foundA = false;
+    bool foundB = false;
+    bool supportedMatMuls = true;
+    for (const auto& bodyOp : m_body->get_ops()) {
+        const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(bodyOp);
+        if (!matmul) {
+            continue;
+        }
+        const auto gather = ov::as_type_ptr<ov::op::v8::Gather>(matmul->get_input_node_shared_ptr(1));
+        const auto bank =
+            gather ? ov::as_type_ptr<ov::op::v0::Parameter>(gather->get_input_node_shared_ptr(0)) : nullptr;
+        if (!bank || matmul->get_transpose_a()) {
+            supportedMatMuls = false;
+            break;
+        }
+        const auto bankIdx = m_body->get_parameter_index(bank);
+        if (bankIdx == static_cast<int64_t>(A_INPUT)) {
+            m_transposeA = matmul->get_transpose_b();
+            foundA = true;
+        } else if (bankIdx == static_cast<int64_t>(B_INPUT)) {
+            m_transposeB = matmul->get_transpose_b();
+            foundB = true;
+        }
+    }
+    m_knownBankLayouts = supportedMatMuls && foundA && foundB;
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
@@ -68,7 +125,8 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
     graphInputConfig.emplace_back(node::Input::InputConfig{mainInputDesc, isInPlace});
 
     for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
+        const auto prc = m_multiAdapter && i == ADAPTER_INDICES_INPUT ? ov::element::i32 : mainInputPrc;
+        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(prc);
         inConfs.emplace_back(desc);
         graphInputConfig.emplace_back(node::Input::InputConfig{desc, isInPlace});
     }
@@ -139,10 +197,17 @@ void LoRA::createPrimitive() {
     }
 
     m_graph.Activate();
+    if (inputShapesDefined()) {
+        prepareAdapters();
+    }
 }
 
-void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
-    m_graph.Infer();
+void LoRA::execute(const dnnl::stream& strm) {
+    if (!m_applyAdaptersDirectly) {
+        m_graph.Infer();
+        return;
+    }
+    applyAdapters(strm);
 }
 
 void LoRA::executeDynamicImpl(const dnnl::stream& strm) {
@@ -154,6 +219,216 @@ void LoRA::prepareParams() {
         // since the external and internal descriptors are compatible, we may pass the descriptor
         subgraphMemoryPtrs[i]->redefineDesc(getSrcMemoryAtPort(i)->getDescPtr());
     }
+    prepareAdapters();
+}
+
+bool LoRA::canApplyAdaptersDirectly() const {
+    if (!m_multiAdapter || !m_knownBankLayouts) {
+        return false;
+    }
+    const auto prc = getSrcMemoryAtPort(MAIN_INPUT)->getDesc().getPrecision();
+    if (none_of(prc, ov::element::f32, ov::element::bf16, ov::element::f16)) {
+        return false;
+    }
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (!getSrcMemoryAtPort(i)->getDesc().hasLayoutType(LayoutType::ncsp)) {
+            return false;
+        }
+    }
+    // main: [B, S, N], x: [B, S, K], A: [num_adapters, rank, K], alpha: [num_adapters, 1, rank],
+    // B: [num_adapters, N, rank], adapter indices: [B] (A and B are transposed when transpose_b is not set)
+    const auto& main = getSrcMemoryAtPort(MAIN_INPUT)->getStaticDims();
+    const auto& x = getSrcMemoryAtPort(LORA_INPUT)->getStaticDims();
+    const auto& a = getSrcMemoryAtPort(A_INPUT)->getStaticDims();
+    const auto& alpha = getSrcMemoryAtPort(ALPHA_INPUT)->getStaticDims();
+    const auto& b = getSrcMemoryAtPort(B_INPUT)->getStaticDims();
+    const auto& indices = getSrcMemoryAtPort(ADAPTER_INDICES_INPUT)->getStaticDims();
+    if (main.size() != 3 || x.size() != 3 || a.size() != 3 || alpha.size() != 3 || b.size() != 3 ||
+        indices.size() != 1) {
+        return false;
+    }
+    const size_t rank = m_transposeA ? a[1] : a[2];
+    const size_t K = m_transposeA ? a[2] : a[1];
+    const size_t bRank = m_transposeB ? b[2] : b[1];
+    const size_t N = m_transposeB ? b[1] : b[2];
+    return x[0] == main[0] && x[1] == main[1] && indices[0] == main[0] && K == x[2] && N == main[2] &&
+           a[0] == alpha[0] && a[0] == b[0] && alpha[1] == 1 && alpha[2] == rank && bRank == rank;
+}
+
+void LoRA::prepareAdapters() {
+    m_applyAdaptersDirectly = false;
+    if (!canApplyAdaptersDirectly()) {
+        return;
+    }
+    using dnnl::memory;
+    const auto& a = getSrcMemoryAtPort(A_INPUT)->getStaticDims();
+    const auto rank = static_cast<memory::dim>(m_transposeA ? a[1] : a[2]);
+    const auto K = static_cast<memory::dim>(m_transposeA ? a[2] : a[1]);
+    const auto N = static_cast<memory::dim>(getSrcMemoryAtPort(MAIN_INPUT)->getStaticDims()[2]);
+    const auto dataType =
+        DnnlExtensionUtils::ElementTypeToDataType(getSrcMemoryAtPort(MAIN_INPUT)->getDesc().getPrecision());
+    // row major [rows, cols] matrix or the column major one for a transposed bank
+    auto matrixDesc = [&](memory::dim rows, memory::dim cols, bool columnMajor) {
+        return memory::desc({rows, cols}, dataType, columnMajor ? memory::dims{1, rows} : memory::dims{cols, 1});
+    };
+    const auto aDesc = matrixDesc(K, rank, m_transposeA);
+    const auto bDesc = matrixDesc(rank, N, m_transposeB);
+    // the number of tokens is a runtime dim, so the primitives are recreated only for another shape of the adapters
+    if (m_downProjection && m_aMem.get_desc() == aDesc && m_bMem.get_desc() == bDesc) {
+        m_applyAdaptersDirectly = true;
+        return;
+    }
+    const memory::dim tokens = DNNL_RUNTIME_DIM_VAL;
+
+    dnnl::post_ops downOps;
+    downOps.append_binary(dnnl::algorithm::binary_mul, matrixDesc(1, rank, false));
+    dnnl::primitive_attr downAttr;
+    downAttr.set_post_ops(downOps);
+    const auto downPd = dnnl::matmul::primitive_desc(getEngine(),
+                                                     matrixDesc(tokens, K, false),
+                                                     aDesc,
+                                                     matrixDesc(tokens, rank, false),
+                                                     downAttr,
+                                                     true);
+
+    dnnl::post_ops upOps;
+    upOps.append_sum();
+    dnnl::primitive_attr upAttr;
+    upAttr.set_post_ops(upOps);
+    const auto upPd = dnnl::matmul::primitive_desc(getEngine(),
+                                                   matrixDesc(tokens, rank, false),
+                                                   bDesc,
+                                                   matrixDesc(tokens, N, false),
+                                                   upAttr,
+                                                   true);
+    // e.g. f16 without the hardware support, the inner graph is used then
+    if (!downPd || !upPd) {
+        return;
+    }
+    m_downProjection = dnnl::matmul(downPd);
+    m_upProjection = dnnl::matmul(upPd);
+    m_aMem = memory(downPd.weights_desc(), getEngine(), DNNL_MEMORY_NONE);
+    m_alphaMem = memory(matrixDesc(1, rank, false), getEngine(), DNNL_MEMORY_NONE);
+    m_bMem = memory(upPd.weights_desc(), getEngine(), DNNL_MEMORY_NONE);
+    m_applyAdaptersDirectly = true;
+}
+
+// Segmented (SGMV-like) multi-adapter LoRA: the rows are grouped by the adapter and each segment is computed by
+// two oneDNN matmuls reading the adapter directly from its bank, the low-rank update is accumulated into the output,
+// which shares the memory with the main flow input.
+void LoRA::applyAdapters(const dnnl::stream& strm) {
+    const auto& mainMem = getSrcMemoryAtPort(MAIN_INPUT);
+    const auto& dstMem = getDstMemoryAtPort(0);
+    if (dstMem->getData() != mainMem->getData()) {
+        cpu_memcpy(dstMem->getData(), mainMem->getData(), mainMem->getSize());
+    }
+
+    const auto& dims = getSrcMemoryAtPort(A_INPUT)->getStaticDims();
+    const size_t num_adapters = dims[0];
+    const size_t rank = m_transposeA ? dims[1] : dims[2];
+    const size_t K = m_transposeA ? dims[2] : dims[1];
+    const auto& dstDims = dstMem->getStaticDims();
+    const size_t batch = dstDims[0];
+    const size_t seq = dstDims[1];
+    const size_t N = dstDims[2];
+    if (num_adapters == 0 || rank == 0 || batch * seq == 0) {
+        return;
+    }
+
+    // Gather semantic: the negative indices count from the end, the rows with out of range indices are not adapted
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(ADAPTER_INDICES_INPUT);
+    m_rows.clear();
+    m_rowAdapters.resize(batch);
+    for (size_t i = 0; i < batch; i++) {
+        const int64_t adapter = indices[i] < 0 ? indices[i] + static_cast<int64_t>(num_adapters) : indices[i];
+        m_rowAdapters[i] = adapter;
+        if (adapter >= 0 && adapter < static_cast<int64_t>(num_adapters)) {
+            m_rows.push_back(i);
+        }
+    }
+    if (m_rows.empty()) {
+        return;
+    }
+    std::stable_sort(m_rows.begin(), m_rows.end(), [&](size_t lhs, size_t rhs) {
+        return m_rowAdapters[lhs] < m_rowAdapters[rhs];
+    });
+    auto segmentEnd = [&](size_t begin) {
+        size_t end = begin + 1;
+        while (end < m_rows.size() && m_rowAdapters[m_rows[end]] == m_rowAdapters[m_rows[begin]]) {
+            end++;
+        }
+        return end;
+    };
+    size_t maxSegmentRows = 0;
+    for (size_t begin = 0; begin < m_rows.size(); begin = segmentEnd(begin)) {
+        maxSegmentRows = std::max(maxSegmentRows, segmentEnd(begin) - begin);
+    }
+
+    // the scratch pad holds the low-rank activations of a segment and its gathered rows of x and of the output
+    const auto prc = mainMem->getDesc().getPrecision();
+    const size_t maxTokens = maxSegmentRows * seq;
+    const auto scratchDesc = std::make_shared<CpuBlockedMemoryDesc>(prc, Shape{maxTokens * (rank + K + N)});
+    auto* lowRank = getScratchPadMem(scratchDesc)->getDataAs<uint8_t>();
+    auto* xGathered = lowRank + maxTokens * rank * prc.size();
+    auto* dstGathered = xGathered + maxTokens * K * prc.size();
+
+    const auto* x = getSrcDataAtPortAs<const uint8_t>(LORA_INPUT);
+    const auto* a = getSrcDataAtPortAs<const uint8_t>(A_INPUT);
+    const auto* alpha = getSrcDataAtPortAs<const uint8_t>(ALPHA_INPUT);
+    const auto* b = getSrcDataAtPortAs<const uint8_t>(B_INPUT);
+    auto* dst = dstMem->getDataAs<uint8_t>();
+    const size_t xRowSize = seq * K * prc.size();
+    const size_t dstRowSize = seq * N * prc.size();
+    const auto dataType = DnnlExtensionUtils::ElementTypeToDataType(prc);
+    // the row major [tokens, cols] matrix of a segment
+    auto tokensMemory = [&](size_t tokens, size_t cols, const uint8_t* ptr) {
+        using dnnl::memory;
+        const auto rows = static_cast<memory::dim>(tokens);
+        const auto rowSize = static_cast<memory::dim>(cols);
+        return memory(memory::desc({rows, rowSize}, dataType, memory::dims{rowSize, 1}),
+                      getEngine(),
+                      const_cast<uint8_t*>(ptr));
+    };
+
+    for (size_t begin = 0, end = 0; begin < m_rows.size(); begin = end) {
+        const auto adapter = static_cast<size_t>(m_rowAdapters[m_rows[begin]]);
+        end = segmentEnd(begin);
+        const size_t segmentRows = end - begin;
+        const size_t tokens = segmentRows * seq;
+        // the rows are sorted within the segment, so it is contiguous when the rows are consecutive in the batch
+        const bool contiguous = m_rows[end - 1] - m_rows[begin] == segmentRows - 1;
+        const uint8_t* xSegment = x + m_rows[begin] * xRowSize;
+        uint8_t* dstSegment = dst + m_rows[begin] * dstRowSize;
+        if (!contiguous) {
+            parallel_for(segmentRows, [&](size_t i) {
+                const size_t row = m_rows[begin + i];
+                cpu_memcpy(xGathered + i * xRowSize, x + row * xRowSize, xRowSize);
+                cpu_memcpy(dstGathered + i * dstRowSize, dst + row * dstRowSize, dstRowSize);
+            });
+            xSegment = xGathered;
+            dstSegment = dstGathered;
+        }
+
+        m_aMem.set_data_handle(const_cast<uint8_t*>(a + adapter * rank * K * prc.size()));
+        m_alphaMem.set_data_handle(const_cast<uint8_t*>(alpha + adapter * rank * prc.size()));
+        m_bMem.set_data_handle(const_cast<uint8_t*>(b + adapter * N * rank * prc.size()));
+        const auto lowRankMem = tokensMemory(tokens, rank, lowRank);
+        m_downProjection.execute(strm,
+                                 {{DNNL_ARG_SRC, tokensMemory(tokens, K, xSegment)},
+                                  {DNNL_ARG_WEIGHTS, m_aMem},
+                                  {DNNL_ARG_DST, lowRankMem},
+                                  {DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_SRC_1, m_alphaMem}});
+        m_upProjection.execute(strm,
+                               {{DNNL_ARG_SRC, lowRankMem},
+                                {DNNL_ARG_WEIGHTS, m_bMem},
+                                {DNNL_ARG_DST, tokensMemory(tokens, N, dstSegment)}});
+
+        if (!contiguous) {
+            parallel_for(segmentRows, [&](size_t i) {
+                cpu_memcpy(dst + m_rows[begin + i] * dstRowSize, dstGathered + i * dstRowSize, dstRowSize);
+            });
+        }
+    }
 }
 
 }  // namespace ov::intel_cpu::node
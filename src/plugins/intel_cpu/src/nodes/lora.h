@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <vector>
@@ -35,13 +37,34 @@ public:
     int registerToAllocationContext(int offset, AllocationContext& context) override;
     void createPrimitive() override;
     void prepareParams() override;
-    void execute([[maybe_unused]] const dnnl::stream& strm) override;
+    void execute(const dnnl::stream& strm) override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    bool canApplyAdaptersDirectly() const;
+    void prepareAdapters();
+    void applyAdapters(const dnnl::stream& strm);
+
     std::shared_ptr<const ov::Model> m_body;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
+    // multi-adapter mode: the LoRA matrices are the adapter banks selected by the per-row adapter indices
+    bool m_multiAdapter = false;
+    // the multi-adapter LoRA is computed by the segmented kernel instead of the inner graph
+    bool m_applyAdaptersDirectly = false;
+    // the layouts of the adapter banks are defined by the transpose_b flags of the body MatMuls:
+    // A is [num_adapters, rank, K] or [num_adapters, K, rank], B is [num_adapters, N, rank] or [num_adapters, rank, N]
+    bool m_knownBankLayouts = false;
+    bool m_transposeA = false;
+    bool m_transposeB = false;
+    // the matmuls of an adapter segment (the batch rows using the same adapter), the number of tokens is a runtime dim
+    dnnl::matmul m_downProjection;  // x * A^T * alpha
+    dnnl::matmul m_upProjection;    // accumulates the projection by B into the output
+    dnnl::memory m_aMem;
+    dnnl::memory m_alphaMem;
+    dnnl::memory m_bMem;
+    std::vector<size_t> m_rows;
+    std::vector<int64_t> m_rowAdapters;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -0,0 +1,522 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "dnnl_scratch_pad.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <algorithm>
+#    include <cmath>
+#    include <cstddef>
+#    include <limits>
+#    include <type_traits>
+#    include <utility>
+
+#    include "cpu_memory.h"
+#    include "kernels/x64/mlp_kernel.hpp"
+#    include "kernels/x64/mlp_linear.hpp"
+#    include "memory_desc/blocked_memory_desc.h"
+#    include "memory_desc/cpu_blocked_memory_desc.h"
+#    include "openvino/core/parallel.hpp"
+#    include "openvino/core/shape.hpp"
+#    include "openvino/core/type/bfloat16.hpp"
+#    include "openvino/core/type/float16.hpp"
+#    include "utils/plain_tensor.hpp"
+#endif
+
+namespace ov::intel_cpu::node {
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+// Tokens are routed to their top-k experts and sorted by expert, so every expert runs its MLP
+// only for the rows which selected it:
+//  1. softmax + top-k of the router logits per token
+//  2. counting sort of (token, weight) pairs by expert id
+//  3. per expert: gather rows -> gate_up -> down -> weighted scatter-add into the f32 accumulator
+//  4. accumulator is converted into the output precision
+template <typename T>
+struct MoE::Executor : public MoE::ExecutorBase {
+    struct Expert {
+        LinearGateUp<T> gate_up;
+        LinearKsplit2<T> down;
+        PlainTensor w_scale_gateup;
+        float* w_scale_down = nullptr;
+    };
+
+    MoE* m_pnode;
+    const MoENode::Config m_config;
+    const LLMMLPNode::Config& m_mlp;
+    DnnlScratchPadPtr m_scrachPad;
+    MemoryPtr m_scratchMem;
+    uint8_t* m_scratch_base = nullptr;
+
+    std::vector<std::unique_ptr<Expert>> m_experts;
+    int m_N;
+    int m_M = 0;
+
+    // per-expert activations: in scratch buffer
+    PlainTensor m_gathered;
+    PlainTensor m_actUp;
+    PlainTensor m_expertOut;
+    MatrixDynQuantPerRow m_quant_act;
+    MatrixDynQuantPerRow m_quant_up_act;
+
+    // routing results
+    std::vector<int32_t> m_topk_ids;
+    std::vector<float> m_topk_weights;
+    std::vector<int32_t> m_expert_offsets;
+    std::vector<int32_t> m_sorted_tokens;
+    std::vector<float> m_sorted_weights;
+    std::vector<float> m_acc;
+
+    Executor(MoE* pnode, const MoENode::Config& config, DnnlScratchPadPtr scrachPad)
+        : m_pnode(pnode),
+          m_config(config),
+          m_mlp(m_config.mlp),
+          m_scrachPad(std::move(scrachPad)),
+          m_N(m_config.mlp.up_size) {
+        const auto expert_input_size = MoENode::expert_input_size(m_mlp);
+        for (int e = 0; e < m_config.num_experts; e++) {
+            const auto port = 2 + static_cast<size_t>(e) * expert_input_size;
+            auto expert = std::make_unique<Expert>();
+            PlainTensor w_gate(pnode->getSrcMemoryAtPort(port));
+            PlainTensor w_up(pnode->getSrcMemoryAtPort(port + 1));
+            PlainTensor w_down(pnode->getSrcMemoryAtPort(port + 2));
+
+            // same weights preparation as in LLMMLP
+            auto K = w_gate.size(1);
+            auto N = w_gate.size(0);
+            OPENVINO_ASSERT(w_gate.stride_bytes(0) == w_up.stride_bytes(0));
+            if (m_mlp.gate_up_combined) {
+                N = w_gate.size(0) / 2;
+                expert->gate_up.setup(w_gate.ptr_v(), w_up.ptr_v(N, 0), w_up.stride_bytes(0), N * 2, K, m_mlp);
+            } else {
+                expert->gate_up.setup(w_gate.ptr_v(), w_up.ptr_v(), w_up.stride_bytes(0), N * 2, K, m_mlp);
+            }
+            expert->down.setup(w_down.ptr_v(), w_down.stride_bytes(0), K, N, m_mlp);
+            OPENVINO_ASSERT(static_cast<int>(N) == m_N, "MoE experts have different up size");
+
+            if (m_mlp.gate_up_quantized) {
+                expert->w_scale_gateup.resize<float>({N * 2});
+                auto* w_scale_gate = pnode->getSrcMemoryAtPort(port + 3)->getDataAs<float>();
+                auto* w_scale_up = pnode->getSrcMemoryAtPort(port + 4)->getDataAs<float>();
+                auto* dst = expert->w_scale_gateup.ptr<float>();
+                if (m_mlp.gate_up_combined) {
+                    w_scale_up = w_scale_gate + N;
+                }
+                for (size_t i = 0; i < N; i += 16) {
+                    memcpy(dst, w_scale_gate + i, 16 * sizeof(float));
+                    dst += 16;
+                    memcpy(dst, w_scale_up + i, 16 * sizeof(float));
+                    dst += 16;
+                }
+            }
+            if (m_mlp.down_quantized) {
+                expert->w_scale_down = pnode->getSrcMemoryAtPort(port + expert_input_size - 1)->getDataAs<float>();
+            }
+            m_experts.push_back(std::move(expert));
+        }
+    }
+
+    void setM(int M) {
+        uint8_t* cur_scratch_base = nullptr;
+        if (m_scratchMem) {
+            cur_scratch_base = m_scratchMem->getDataAs<uint8_t>();
+        }
+        // new M larger than previous or the scratch pointer is changed after the following allocation
+        if (m_M < M || cur_scratch_base != m_scratch_base) {
+            ScratchBuffAllocator allocator;
+            const auto hidden_size = static_cast<size_t>(m_mlp.hidden_size);
+
+            allocator.register_allocation(M * hidden_size * sizeof(T), [&](void* ptr) {
+                m_gathered.resize<T>({static_cast<size_t>(M), hidden_size}, reinterpret_cast<T*>(ptr));
+            });
+            allocator.register_allocation(M * m_N * sizeof(T), [&](void* ptr) {
+                m_actUp.resize<T>({static_cast<size_t>(M), static_cast<size_t>(m_N)}, reinterpret_cast<T*>(ptr));
+            });
+            allocator.register_allocation(M * hidden_size * sizeof(T), [&](void* ptr) {
+                m_expertOut.resize<T>({static_cast<size_t>(M), hidden_size}, reinterpret_cast<T*>(ptr));
+            });
+
+            // experts run one after another and have the same work partitioning, so they share the C buffers
+            m_threads_num = parallel_get_max_threads();
+            auto& expert0 = *m_experts.front();
+            for (size_t ithr = 0LU; ithr < m_threads_num; ithr++) {
+                auto C1_size = expert0.gate_up.works[ithr].set_C(M, reinterpret_cast<float*>(cur_scratch_base));
+                auto C2_size = expert0.down.works[ithr].set_C(M, reinterpret_cast<float*>(cur_scratch_base));
+                auto max_C_size = std::max(C1_size, C2_size);
+                allocator.register_allocation(max_C_size, [this, ithr, M](void* ptr) {
+                    for (auto& expert : m_experts) {
+                        expert->gate_up.works[ithr].set_C(M, reinterpret_cast<float*>(ptr));
+                        expert->down.works[ithr].set_C(M, reinterpret_cast<float*>(ptr));
+                    }
+                });
+            }
+
+            if (m_mlp.gate_up_quantized) {
+                m_quant_act.M = M;
+                m_quant_act.K = m_mlp.hidden_size;
+                allocator.register_allocation(m_quant_act.size(), [&](void* ptr) {
+                    m_quant_act.setup(ptr);
+                });
+            }
+
+            if (m_mlp.down_quantized) {
+                m_quant_up_act.M = M;
+                m_quant_up_act.K = m_mlp.up_size;
+                allocator.register_allocation(m_quant_up_act.size(), [&](void* ptr) {
+                    m_quant_up_act.setup(ptr);
+                });
+            }
+
+            auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{allocator.size()});
+            m_scratchMem = m_scrachPad->createScratchPadMem(newMemDesc);
+            m_scratch_base = m_scratchMem->getDataAs<uint8_t>();
+
+            allocator.finalize(m_scratch_base);
+            m_M = M;
+        }
+    }
+
+    void route(int M) {
+        auto logits = m_pnode->getSrcMemoryAtPort(1);
+        const auto* p_logits = logits->getDataAs<float>();
+        const auto& logitsStrides = logits->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const auto stride_logits = logitsStrides[logitsStrides.size() - 2];
+        const auto num_experts = m_config.num_experts;
+        const auto top_k = m_config.top_k;
+
+        m_topk_ids.resize(static_cast<size_t>(M) * top_k);
+        m_topk_weights.resize(static_cast<size_t>(M) * top_k);
+        ov::parallel_for(M, [&](size_t m) {
+            const auto* src = p_logits + m * stride_logits;
+            auto* ids = m_topk_ids.data() + m * top_k;
+            auto* weights = m_topk_weights.data() + m * top_k;
+
+            // softmax is monotonic, so top-k is selected on the logits directly (insertion into a sorted list)
+            float max_logit = -std::numeric_limits<float>::infinity();
+            int count = 0;
+            for (int e = 0; e < num_experts; e++) {
+                max_logit = std::max(max_logit, src[e]);
+                if (count == top_k && src[e] <= weights[count - 1]) {
+                    continue;
+                }
+                int i = (count < top_k) ? count++ : count - 1;
+                for (; i > 0 && weights[i - 1] < src[e]; i--) {
+                    weights[i] = weights[i - 1];
+                    ids[i] = ids[i - 1];
+                }
+                weights[i] = src[e];
+                ids[i] = e;
+            }
+
+            float sum = 0.0F;
+            for (int e = 0; e < num_experts; e++) {
+                sum += std::exp(src[e] - max_logit);
+            }
+            float topk_sum = 0.0F;
+            for (int i = 0; i < top_k; i++) {
+                weights[i] = std::exp(weights[i] - max_logit) / sum;
+                topk_sum += weights[i];
+            }
+            if (m_config.normalize_topk) {
+                for (int i = 0; i < top_k; i++) {
+                    weights[i] /= topk_sum;
+                }
+            }
+        });
+
+        // counting sort of the (token, weight) pairs by expert
+        m_expert_offsets.assign(num_experts + 1, 0);
+        for (auto id : m_topk_ids) {
+            m_expert_offsets[id + 1]++;
+        }
+        for (int e = 0; e < num_experts; e++) {
+            m_expert_offsets[e + 1] += m_expert_offsets[e];
+        }
+        m_sorted_tokens.resize(m_topk_ids.size());
+        m_sorted_weights.resize(m_topk_ids.size());
+        std::vector<int32_t> cursor(m_expert_offsets.begin(), m_expert_offsets.end() - 1);
+        for (size_t i = 0; i < m_topk_ids.size(); i++) {
+            auto dst = cursor[m_topk_ids[i]]++;
+            m_sorted_tokens[dst] = static_cast<int32_t>(i / top_k);
+            m_sorted_weights[dst] = m_topk_weights[i];
+        }
+    }
+
+    void execute() override {
+        auto input = m_pnode->getSrcMemoryAtPort(0);
+        const auto& ishape = input->getStaticDims();
+        const auto* pA = input->getDataAs<T>();
+        const auto& srcStrides = input->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const auto strideA = srcStrides[srcStrides.size() - 2];
+        const int M = shape_size(ishape) / ishape[ishape.size() - 1];
+        if (M == 0) {
+            return;
+        }
+        const auto hidden_size = static_cast<size_t>(m_mlp.hidden_size);
+
+        route(M);
+
+        int max_rows = 0;
+        for (int e = 0; e < m_config.num_experts; e++) {
+            max_rows = std::max(max_rows, m_expert_offsets[e + 1] - m_expert_offsets[e]);
+        }
+        setM(std::min(max_rows, CACHE_BLK_M_SIZE));
+
+        m_acc.resize(M * hidden_size);
+        ov::parallel_for(M, [&](size_t m) {
+            std::fill_n(m_acc.data() + m * hidden_size, hidden_size, 0.0F);
+        });
+
+        for (int e = 0; e < m_config.num_experts; e++) {
+            auto& expert = *m_experts[e];
+            for (int m = m_expert_offsets[e]; m < m_expert_offsets[e + 1];) {
+                const int BM = std::min(m_expert_offsets[e + 1] - m, CACHE_BLK_M_SIZE);
+                const auto* tokens = m_sorted_tokens.data() + m;
+                const auto* token_weights = m_sorted_weights.data() + m;
+
+                ov::parallel_for(BM, [&](size_t i) {
+                    memcpy(m_gathered.ptr<T>(i), pA + tokens[i] * strideA, hidden_size * sizeof(T));
+                });
+
+                auto* psrc = reinterpret_cast<uint8_t*>(m_gathered.ptr<T>());
+                auto stride_src_in_bytes = m_gathered.stride_bytes(0);
+                if (m_mlp.gate_up_quantized) {
+                    m_quant_act.quantize(BM, m_gathered.ptr<T>(), m_gathered.stride(0));
+                    psrc = reinterpret_cast<uint8_t*>(m_quant_act.data);
+                    stride_src_in_bytes = m_quant_act.K;
+                }
+
+                // dequantize is fused into gate_up
+                expert.gate_up.runGateUp(psrc,
+                                         stride_src_in_bytes,
+                                         BM,
+                                         m_actUp.ptr<T>(),
+                                         m_actUp.stride_bytes(0),
+                                         m_mlp,
+                                         m_quant_act,
+                                         expert.w_scale_gateup.ptr<float>());
+
+                auto* p_up_act = reinterpret_cast<uint8_t*>(m_actUp.ptr<T>());
+                size_t stride_up_act = m_actUp.stride_bytes(0);
+                if (m_mlp.down_quantized) {
+                    m_quant_up_act.quantize(BM, m_actUp.ptr<T>(), m_actUp.stride(0));
+                    p_up_act = reinterpret_cast<uint8_t*>(m_quant_up_act.data);
+                    stride_up_act = m_quant_up_act.stride();
+                }
+
+                expert.down.run(p_up_act,
+                                stride_up_act,
+                                BM,
+                                m_expertOut.ptr<T>(),
+                                m_expertOut.stride_bytes(0),
+                                m_mlp,
+                                m_quant_up_act,
+                                expert.w_scale_down);
+
+                // a token selects an expert at most once, so the rows of one expert never collide
+                ov::parallel_for(BM, [&](size_t i) {
+                    const auto* src = m_expertOut.ptr<T>(i);
+                    auto* dst = m_acc.data() + tokens[i] * hidden_size;
+                    const auto w = token_weights[i];
+                    for (size_t k = 0; k < hidden_size; k++) {
+                        dst[k] += w * static_cast<float>(src[k]);
+                    }
+                });
+
+                m += BM;
+            }
+        }
+
+        auto output = m_pnode->getDstMemoryAtPort(0);
+        auto* dstC = output->getDataAs<T>();
+        const auto& dstStrides = output->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const auto strideC = dstStrides[dstStrides.size() - 2];
+        ov::parallel_for(M, [&](size_t m) {
+            const auto* src = m_acc.data() + m * hidden_size;
+            auto* dst = dstC + m * strideC;
+            for (size_t k = 0; k < hidden_size; k++) {
+                dst[k] = static_cast<T>(src[k]);
+            }
+        });
+    }
+
+private:
+    size_t m_threads_num = 0LU;
+};
+#else
+template <typename T>
+struct MoE::Executor : public MoE::ExecutorBase {
+    Executor(MoE* node, const MoENode::Config& config, const DnnlScratchPadPtr& scratchPad) {
+        (void)node;
+        (void)config;
+        (void)scratchPad;
+    }
+
+    void execute() override {}
+};
+#endif
+
+MoE::MoE(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    const auto& config = context->getConfig();
+    if (!isSupportedOperation(op, errorMessage, config.fcDynamicQuantizationGroupSize)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    const auto node_moe = ov::as_type_ptr<const MoENode>(op);
+    m_moe_config = node_moe->get_config();
+}
+
+void MoE::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs;
+    std::vector<PortConfigurator> outPortConfigs;
+
+    auto rtPrecision = getOriginalInputPrecisionAtPort(0);
+
+    if (rtPrecision == ov::element::f32) {
+        // fallback to supported precision if possible
+        if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx_fp16)) {
+            rtPrecision = ov::element::f16;
+        } else if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx)) {
+            rtPrecision = ov::element::bf16;
+        }
+    }
+
+    OPENVINO_ASSERT(any_of(rtPrecision, ov::element::bf16, ov::element::f16), "Unexpected rtPrecision:", rtPrecision);
+
+    const auto& mlp = m_moe_config.mlp;
+    const auto gateUpPrecision = mlp.gate_up_quantized ? ov::element::i8 : ov::element::f16;
+    const auto downPrecision = mlp.down_quantized ? ov::element::i8 : ov::element::f16;
+
+    inPortConfigs.emplace_back(LayoutType::ncsp, rtPrecision, getInputShapeAtPort(0), false, -1);       // input
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(1), false, -1);  // logits
+    for (size_t port = 2; port < getOriginalInputsNumber(); port += MoENode::expert_input_size(mlp)) {
+        inPortConfigs.emplace_back(LayoutType::ncsp, gateUpPrecision, getInputShapeAtPort(port), false, -1);  // gate
+        inPortConfigs.emplace_back(LayoutType::ncsp, gateUpPrecision, getInputShapeAtPort(port + 1), false, -1);  // up
+        inPortConfigs.emplace_back(LayoutType::ncsp, downPrecision, getInputShapeAtPort(port + 2), false, -1);  // down
+        size_t scales_port = port + 3;
+        if (mlp.gate_up_quantized) {
+            inPortConfigs.emplace_back(LayoutType::ncsp,
+                                       ov::element::f32,
+                                       getInputShapeAtPort(scales_port++),
+                                       false,
+                                       -1);  // gate_weight scales per OC
+            inPortConfigs.emplace_back(LayoutType::ncsp,
+                                       ov::element::f32,
+                                       getInputShapeAtPort(scales_port++),
+                                       false,
+                                       -1);  // up_weight scales per OC
+        }
+        if (mlp.down_quantized) {
+            inPortConfigs.emplace_back(LayoutType::ncsp,
+                                       ov::element::f32,
+                                       getInputShapeAtPort(scales_port),
+                                       false,
+                                       -1);  // down_weight scales per OC
+        }
+    }
+
+    // initialize output port
+    outPortConfigs.emplace_back(LayoutType::ncsp, rtPrecision, getOutputShapeAtPort(0), false, -1);
+
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
+}
+
+void MoE::createPrimitive() {
+    auto rtPrecision = getInputPrecisions()[0];
+#ifdef OPENVINO_ARCH_X86_64
+    if (rtPrecision == ov::element::bf16) {
+        m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_moe_config, getScratchPad());
+    } else if (rtPrecision == ov::element::f16) {
+        m_executor = std::make_shared<Executor<ov::float16>>(this, m_moe_config, getScratchPad());
+    }
+#endif
+    if (!m_executor) {
+        CPU_NODE_THROW("Executor creation fails with precision " + rtPrecision.to_string());
+    }
+}
+
+void MoE::execute([[maybe_unused]] const dnnl::stream& strm) {
+    m_executor->execute();
+}
+
+bool MoE::isSupportedOperation([[maybe_unused]] const std::shared_ptr<const ov::Node>& op,
+                               [[maybe_unused]] std::string& errorMessage,
+                               [[maybe_unused]] uint64_t fcDynamicQuantizationGroupSize) noexcept {
+#if defined(OPENVINO_ARCH_X86_64)
+    try {
+        const auto node_moe = ov::as_type_ptr<const MoENode>(op);
+        if (!node_moe) {
+            errorMessage = "Only MoENode operation is supported";
+            return false;
+        }
+        const auto& config = node_moe->get_config();
+        const auto expert_input_size = MoENode::expert_input_size(config.mlp);
+        for (size_t port = 2; port < op->get_input_size(); port += expert_input_size) {
+            auto gate_proj_w_pshape = op->input_value(port).get_partial_shape();
+            if (!gate_proj_w_pshape.is_static()) {
+                errorMessage = "MoENode expert weight shape is not static";
+                return false;
+            }
+            // same restrictions as for LLMMLP
+            auto down_size = gate_proj_w_pshape[0].get_length();
+            auto up_size = gate_proj_w_pshape[1].get_length();
+            if (down_size % REG_BLK_K_SIZE) {
+                errorMessage = "MoENode down_proj size is not multiple of register blocking size";
+                return false;
+            }
+            if (up_size % REG_BLK_N_SIZE) {
+                errorMessage = "MoENode up_proj size is not multiple of register blocking size";
+                return false;
+            }
+        }
+
+        if (config.mlp.gate_up_quantized &&
+            (fcDynamicQuantizationGroupSize < static_cast<uint64_t>(config.mlp.hidden_size))) {
+            errorMessage = "MoENode gate-up-proj only support per-token dynamic quantization";
+            return false;
+        }
+
+        if (config.mlp.down_quantized && (fcDynamicQuantizationGroupSize < static_cast<uint64_t>(config.mlp.up_size))) {
+            errorMessage = "MoENode down_proj only support per-token dynamic quantization";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace ov::intel_cpu::node
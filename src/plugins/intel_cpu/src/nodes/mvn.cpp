@@ -2072,11 +2072,11 @@ void MVN::initSupportedPrimitiveDescriptors() {
                 dstMemoryDescs.push_back(outConf.getMemDesc());
             }
 
-            auto factory =
-                std::make_shared<MVNExecutorFactory>(mvnAttrs,
-                                                     srcMemoryDescs,
-                                                     dstMemoryDescs,
-                                                     std::make_shared<ExecutorContext>(context, getImplPriority()));
+            auto factory = std::make_shared<MVNExecutorFactory>(
+                mvnAttrs,
+                srcMemoryDescs,
+                dstMemoryDescs,
+                std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot()));
             if (!factory->isEmpty()) {
                 supportedPrimitiveDescriptors.emplace_back(config, impl_type, factory);
             }
@@ -219,7 +219,8 @@ void PagedAttention::createPrimitive() {
 #endif
     };
 
-    auto cache = context->getParamsCache();
+    // the executor owns the MHA scratch buffers, so it must not be used by several streams at once
+    auto cache = context->getPrivateParamsCache();
     auto result = cache->getOrCreate(key, builder);
     if (!result.first) {
         CPU_NODE_THROW("AttentionExecutor creation fails with precision " + rtPrecision.to_string());
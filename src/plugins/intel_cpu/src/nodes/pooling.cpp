@@ -688,11 +688,11 @@ void Pooling::initSupportedPrimitiveDescriptors() {
                 dstMemoryDescs.push_back(config.outConfs[i].getMemDesc());
             }
 
-            auto factory =
-                std::make_shared<PoolingExecutorFactory>(poolingAttrs,
-                                                         srcMemoryDescs,
-                                                         dstMemoryDescs,
-                                                         std::make_shared<ExecutorContext>(context, getImplPriority()));
+            auto factory = std::make_shared<PoolingExecutorFactory>(
+                poolingAttrs,
+                srcMemoryDescs,
+                dstMemoryDescs,
+                std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot()));
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::undef, factory);
         };
 
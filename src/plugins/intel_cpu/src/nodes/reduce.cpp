@@ -2210,11 +2210,11 @@ void Reduce::initSupportedPrimitiveDescriptors() {
                 dstMemoryDescs.push_back(outConf.getMemDesc());
             }
 
-            auto factory =
-                std::make_shared<ReduceExecutorFactory>(reduceAttrs,
-                                                        srcMemoryDescs,
-                                                        dstMemoryDescs,
-                                                        std::make_shared<ExecutorContext>(context, getImplPriority()));
+            auto factory = std::make_shared<ReduceExecutorFactory>(
+                reduceAttrs,
+                srcMemoryDescs,
+                dstMemoryDescs,
+                std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot()));
             if (!factory->isEmpty()) {
                 supportedPrimitiveDescriptors.emplace_back(config, impl_type, factory);
             }
@@ -195,7 +195,7 @@ void Reorder::prepareReorderAsTranspose(const MemoryDescPtr& parentDesc, const M
     transposeParams.permuteParams.order = transposeOrder;
     transposeParams.permuteParams.data_size = parentDesc->getPrecision().size();
 
-    auto transpose_context = std::make_shared<ExecutorContext>(context, getImplPriority());
+    auto transpose_context = std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot());
     auto factory = std::make_shared<TransposeExecutorFactory>(transposeParams,
                                                               std::vector<MemoryDescPtr>{parentDesc},
                                                               std::vector<MemoryDescPtr>{transposedDesc},
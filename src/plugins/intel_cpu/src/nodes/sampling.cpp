@@ -0,0 +1,237 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "kernels/scaled_attn/softmax.hpp"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+// the higher logit first, the lower id first for the equal ones
+bool isBetter(const std::pair<float, int32_t>& lhs, const std::pair<float, int32_t>& rhs) {
+    return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+}
+
+}  // namespace
+
+bool Sampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto sampling = ov::as_type_ptr<const SamplingNode>(op);
+        if (!sampling) {
+            errorMessage = "Only Sampling from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+Sampling::Sampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    m_config = ov::as_type_ptr<const SamplingNode>(op)->get_config();
+    m_scratch.resize(parallel_get_max_threads());
+}
+
+void Sampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32}},
+                         {{LayoutType::ncsp, m_config.output_type}},
+                         ref_any);
+}
+
+void Sampling::prepareParams() {
+    const auto& logitsDims = getSrcMemoryAtPort(0)->getStaticDims();
+    CPU_NODE_ASSERT(logitsDims.size() == 2, "has incompatible 'logits' shape ", PartialShape(logitsDims));
+    m_batch = logitsDims[0];
+    m_vocab = logitsDims[1];
+    CPU_NODE_ASSERT(m_vocab <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                    "has too large vocabulary size ",
+                    m_vocab);
+}
+
+bool Sampling::neverExecute() const {
+    return getSelectedPrimitiveDescriptor()->hasZeroInputDimsAtPort(0);
+}
+
+bool Sampling::isExecutable() const {
+    return !isInputTensorAtPortEmpty(0);
+}
+
+int64_t Sampling::sampleRow(const float* logits, float random, Scratch& scratch) const {
+    auto& probs = scratch.probs;
+    auto& ids = scratch.ids;
+    size_t count = m_vocab;
+    // the probabilities are in the descending order, the token ids are in ids
+    bool sorted = false;
+    if (m_config.top_k > 0) {
+        // a single pass over the vocabulary with the min-heap of the best top_k logits
+        count = std::min(m_config.top_k, m_vocab);
+        auto& heap = scratch.heap;
+        heap.clear();
+        for (size_t i = 0; i < m_vocab; i++) {
+            std::pair<float, int32_t> candidate{logits[i], static_cast<int32_t>(i)};
+            if (heap.size() < count) {
+                heap.push_back(candidate);
+                std::push_heap(heap.begin(), heap.end(), isBetter);
+            } else if (isBetter(candidate, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), isBetter);
+                heap.back() = candidate;
+                std::push_heap(heap.begin(), heap.end(), isBetter);
+            }
+        }
+        std::sort_heap(heap.begin(), heap.end(), isBetter);
+        probs.resize(count);
+        ids.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            probs[i] = heap[i].first;
+            ids[i] = heap[i].second;
+        }
+        sorted = true;
+    } else {
+        probs.assign(logits, logits + m_vocab);
+    }
+
+    // the temperature is applied as the scale of the logits
+    ov::Extensions::Cpu::XARCH::attn_softmax(probs.data(),
+                                             probs.data(),
+                                             1.0F / m_config.temperature,
+                                             nullptr,
+                                             nullptr,
+                                             nullptr,
+                                             false,
+                                             count,
+                                             count,
+                                             ov::element::f32,
+                                             ov::element::f32,
+                                             ov::element::f32);
+
+    if (m_config.top_p < 1.0F && !sorted) {
+        // the nucleus is usually small, so only the prefix of the tokens is sorted, growing until it covers top_p
+        ids.resize(count);
+        std::iota(ids.begin(), ids.end(), 0);
+        auto more_probable = [&](int32_t lhs, int32_t rhs) {
+            return probs[lhs] > probs[rhs] || (probs[lhs] == probs[rhs] && lhs < rhs);
+        };
+        size_t prefix = std::min<size_t>(256, count);
+        size_t sorted_prefix = 0;
+        float mass = 0.0F;
+        while (true) {
+            std::partial_sort(ids.begin() + sorted_prefix, ids.begin() + prefix, ids.end(), more_probable);
+            for (; sorted_prefix < prefix && mass < m_config.top_p; sorted_prefix++) {
+                mass += probs[ids[sorted_prefix]];
+            }
+            if (mass >= m_config.top_p || prefix == count) {
+                break;
+            }
+            prefix = std::min(prefix * 4, count);
+        }
+        // gather the probabilities of the nucleus in the descending order
+        auto& nucleus = scratch.heap;
+        nucleus.resize(sorted_prefix);
+        for (size_t i = 0; i < sorted_prefix; i++) {
+            nucleus[i] = {probs[ids[i]], ids[i]};
+        }
+        for (size_t i = 0; i < sorted_prefix; i++) {
+            probs[i] = nucleus[i].first;
+        }
+        count = sorted_prefix;
+        sorted = true;
+    }
+
+    // the smallest prefix of the sorted tokens with the probability of at least top_p
+    float kept_mass = 0.0F;
+    size_t kept = 0;
+    const float top_p = sorted ? m_config.top_p : 1.0F;
+    for (; kept < count && (kept_mass < top_p || top_p == 1.0F); kept++) {
+        kept_mass += probs[kept];
+    }
+
+    // the first token with the cumulative probability not less than the random part of the kept mass
+    const float threshold = random * kept_mass;
+    float cdf = 0.0F;
+    size_t selected = kept - 1;
+    for (size_t i = 0; i < kept; i++) {
+        cdf += probs[i];
+        if (threshold <= cdf) {
+            selected = i;
+            break;
+        }
+    }
+    return sorted ? ids[selected] : static_cast<int64_t>(selected);
+}
+
+template <typename O>
+void Sampling::executeImpl() {
+    const auto* logits = getSrcDataAtPortAs<const float>(0);
+    auto* output = getDstDataAtPortAs<O>(0);
+
+    // the same random values as of Multinomial with the same seeds
+    std::mt19937 gen;
+    if (all_of(0U, m_config.global_seed, m_config.op_seed)) {
+        gen.seed(std::time(nullptr));
+    } else {
+        std::seed_seq seed{m_config.global_seed, m_config.op_seed};
+        gen.seed(seed);
+    }
+    const auto gen_max = static_cast<float>(std::mt19937::max());
+    std::vector<float> random(m_batch);
+    std::generate(random.begin(), random.end(), [&]() {
+        return static_cast<float>(gen()) / gen_max;
+    });
+
+    parallel_for(m_batch, [&](size_t b) {
+        auto& scratch = m_scratch[parallel_get_thread_num()];
+        output[b] = static_cast<O>(sampleRow(logits + b * m_vocab, random[b], scratch));
+    });
+}
+
+void Sampling::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_config.output_type == ov::element::i32) {
+        executeImpl<int32_t>();
+    } else if (m_config.output_type == ov::element::i64) {
+        executeImpl<int64_t>();
+    } else {
+        CPU_NODE_THROW("Unsupported output precision: ", m_config.output_type);
+    }
+}
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+
+namespace ov::intel_cpu::node {
+
+class Sampling : public Node {
+public:
+    Sampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    void prepareParams() override;
+    void execute(const dnnl::stream& strm) override;
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+    [[nodiscard]] bool neverExecute() const override;
+    [[nodiscard]] bool isExecutable() const override;
+    [[nodiscard]] bool created() const override {
+        return getType() == Type::Sampling;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // per thread buffers of the candidate tokens
+    struct Scratch {
+        std::vector<float> probs;
+        std::vector<int32_t> ids;
+        std::vector<std::pair<float, int32_t>> heap;
+    };
+
+    template <typename O>
+    void executeImpl();
+    // returns the id of the token sampled by the uniform random value in [0, 1]
+    int64_t sampleRow(const float* logits, float random, Scratch& scratch) const;
+
+    intel_cpu::SamplingNode::Config m_config;
+    size_t m_batch = 0;
+    size_t m_vocab = 0;
+    std::vector<Scratch> m_scratch;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -1331,7 +1331,8 @@ void ScaledDotProductAttention::createPrimitive() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    // the executor keeps the intermediate buffers of the attention between the calls
+    auto cache = context->getPrivateParamsCache();
     auto result = cache->getOrCreate(key, builder);
     CPU_NODE_ASSERT(result.first, "AttentionExecutor creation fails with precision " + rtPrecision.to_string());
     m_executor = result.first;
@@ -1443,6 +1444,15 @@ std::vector<T> permute_axes(const std::vector<T>& shape, const std::vector<size_
     return results;
 }
 
+// The stateful KV cache is extended by the blocks of this number of tokens
+constexpr size_t kvCacheBlockSize = 256;
+
+// Capacity of the KV cache (in tokens) to store the given number of tokens. When the storage grows in place, only the
+// blocks covering the new tokens are added. Otherwise the capacity is doubled to amortize the copying.
+static size_t kv_cache_capacity(size_t tokens) {
+    return rnd_up(GrowableMemoryBlock::growsInPlace() ? tokens : tokens * 2, kvCacheBlockSize);
+}
+
 void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                      const MemoryPtr& mem_cur_v,
                                                      const MemoryPtr& mem_beam_idx) {
@@ -1501,18 +1511,23 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
         // shape is the shape used by the original model which maybe different from BHLS, reverse here is to permute
         // BHLS to original model shape. BHLS is the stated input shape of SDPA, however internally we use LBHS for
         // KV-cache storage. real_order is used to permute the original shape to LBHS
-        std::vector<size_t> shape = reverse({B, H, (L0 + L1) * 2, S});
+        const size_t capacity = kv_cache_capacity(L0 + L1);
+        std::vector<size_t> shape = reverse({B, H, capacity, S});
         auto mem_desc_k = std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
                                                                  Shape(shape),
                                                                  permute_axes(shape, real_order),
                                                                  real_order);
-        auto new_internal_mem_k = std::make_shared<Memory>(getEngine(), mem_desc_k);
-        shape = reverse({B, H, (L0 + L1) * 2, SV});
+        auto new_internal_mem_k = VariableStateKVcache::make_kv_cache_memory(getEngine(),
+                                                                             mem_desc_k,
+                                                                             context->getNumaNodeId());
+        shape = reverse({B, H, capacity, SV});
         auto mem_desc_v = std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
                                                                  Shape(shape),
                                                                  permute_axes(shape, real_order),
                                                                  real_order);
-        auto new_internal_mem_v = std::make_shared<Memory>(getEngine(), mem_desc_v);
+        auto new_internal_mem_v = VariableStateKVcache::make_kv_cache_memory(getEngine(),
+                                                                             mem_desc_v,
+                                                                             context->getNumaNodeId());
 
         PlainTensor new_pastk;
         PlainTensor new_pastv;
@@ -1549,10 +1564,10 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                 std::vector<size_t> shape;
                 if (quant_param.isByChannel) {
                     // round_up to group_size
-                    size_t group_nums = div_up((L0 + L1) * 2, quant_param.groupSize) * 2;
+                    size_t group_nums = div_up(capacity, quant_param.groupSize) * 2;
                     shape = reverse({B, H, group_nums, hidden_states});
                 } else {
-                    shape = reverse({B, H, (L0 + L1) * 2, hidden_states / quant_param.groupSize * 2});
+                    shape = reverse({B, H, capacity, hidden_states / quant_param.groupSize * 2});
                 }
                 return permute_axes(shape, real_order);
             };
@@ -1627,7 +1642,7 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
                 ov::element::f32,
                 ov::intel_cpu::Shape{static_cast<size_t>(parallel_get_max_threads()), m_key_quant_param.groupSize * S});
-            auto scratchMem = context->getScratchPad()->createScratchPadMem(newMemDesc);
+            auto scratchMem = getScratchPad()->createScratchPadMem(newMemDesc);
             auto* temp_buffer = scratchMem->getDataAs<float>();
             attn_quantkv(cur_k,
                          cur_v,
@@ -1646,8 +1661,8 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
 
         m_k_state->assign_internal_state(new_internal_mem_k);
         m_v_state->assign_internal_state(new_internal_mem_v);
-        m_k_state->assign_internal_state_max_size(B * H * (L0 + L1) * 2 * S);
-        m_v_state->assign_internal_state_max_size(B * H * (L0 + L1) * 2 * SV);
+        m_k_state->assign_internal_state_max_size(B * H * capacity * S);
+        m_v_state->assign_internal_state_max_size(B * H * capacity * SV);
     }
     // 3. create beam table
     {
@@ -1888,91 +1903,87 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     size_t L0 = v_dims.at(order[2]);
     auto B_state = v_dims.at(order[0]);
     CPU_NODE_ASSERT(B == B_state, "pastkv batch: ", B, " is not equal to batch of state: ", B_state);
+    auto&& k_dims = getParentEdgeAt(inputNumber - 2)->getMemory().getStaticDims();
+    CPU_NODE_ASSERT(k_dims.at(order[2]) == L0,
+                    "past key length: ",
+                    k_dims.at(order[2]),
+                    " is not equal to past value length: ",
+                    L0,
+                    ", the key and value states must be trimmed by the same count");
     CPU_NODE_ASSERT(B * (L0 + L1) > 0, "B or (L0+L1) is zero, B: ", B, ", L0: ", L0, ", L1: ", L1);
     // resize buffer
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
     bool need_redefine = true;
     if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size()) {
+        const size_t capacity = kv_cache_capacity(L0 + L1);
         // new_shape is the shape used by the original model which maybe different from BHLS, reverse here is to permute
         // BHLS to original model shape. BHLS is the stated input shape of SDPA, however internally we use LBHS for
         // KV-cache storage. real_order is used to permute the original shape to LBHS
-        auto new_memory = [&](size_t new_S) {
-            std::vector<size_t> new_shape = reverse({B, H, (L0 + L1) * 2, new_S});
+        auto capacity_desc = [&](size_t new_S) {
+            std::vector<size_t> new_shape = reverse({B, H, capacity, new_S});
             auto real_shape = permute_axes(new_shape, real_order);
-            auto mem_desc =
-                std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision, Shape(new_shape), real_shape, real_order);
-            return std::make_shared<Memory>(getEngine(), mem_desc);
+            return std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision, Shape(new_shape), real_shape, real_order);
         };
-
-        auto new_internal_mem_k = new_memory(S);
-        auto new_internal_mem_v = new_memory(SV);
-
-        PlainTensor new_pastk;
-        PlainTensor new_pastv;
-        new_pastk.reset(new_internal_mem_k);
-        new_pastv.reset(new_internal_mem_v);
-        new_pastk = new_pastk.permute(order);
-        new_pastv = new_pastv.permute(order);
-        if (L0 > 0 && !is_reset) {
-            past_k.reset(internal_mem_k);
-            past_v.reset(internal_mem_v);
-            past_k = past_k.permute(order);
-            past_v = past_v.permute(order);
-            attn_memcpy(past_k, past_v, new_pastk, new_pastv);
+        // L is the outermost axis of the storage, so the stored tokens stay in place and only the new blocks are added
+        const bool grow_in_place = L0 > 0 && !is_reset;
+        if (grow_in_place) {
+            internal_mem_k->redefineDesc(capacity_desc(S));
+            internal_mem_v->redefineDesc(capacity_desc(SV));
+        } else {
+            internal_mem_k = VariableStateKVcache::make_kv_cache_memory(getEngine(),
+                                                                        capacity_desc(S),
+                                                                        context->getNumaNodeId());
+            internal_mem_v = VariableStateKVcache::make_kv_cache_memory(getEngine(),
+                                                                        capacity_desc(SV),
+                                                                        context->getNumaNodeId());
+            m_k_state->assign_internal_state(internal_mem_k);
+            m_v_state->assign_internal_state(internal_mem_v);
         }
-        internal_mem_k = new_internal_mem_k;
-        internal_mem_v = new_internal_mem_v;
-        past_k = new_pastk;
-        past_v = new_pastv;
-        m_k_state->assign_internal_state(new_internal_mem_k);
-        m_v_state->assign_internal_state(new_internal_mem_v);
-        m_k_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * S);
-        m_v_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * SV);
+        m_k_state->assign_internal_state_max_size(capacity * B * H * S);
+        m_v_state->assign_internal_state_max_size(capacity * B * H * SV);
         if (kvcache_precision == ov::element::u8) {
-            auto& old_scale_zp_k = m_k_state->get_scale_zp();
-            auto& old_scale_zp_v = m_v_state->get_scale_zp();
-            PlainTensor new_scale_zp_k;
-            PlainTensor new_scale_zp_v;
             auto get_scale_zp_shape = [&](const SDPAQuantParam& quant_param, const size_t hidden_states) {
                 std::vector<size_t> shape;
                 if (quant_param.isByChannel) {
                     // round_up to group_size
-                    size_t group_nums = div_up((L0 + L1) * 2, quant_param.groupSize) * 2;
+                    size_t group_nums = div_up(capacity, quant_param.groupSize) * 2;
                     shape = reverse({B, H, group_nums, hidden_states});
                 } else {
-                    shape = reverse({B, H, (L0 + L1) * 2, hidden_states / quant_param.groupSize * 2});
+                    shape = reverse({B, H, capacity, hidden_states / quant_param.groupSize * 2});
                 }
                 return permute_axes(shape, real_order);
             };
-            std::vector<size_t> real_shape = get_scale_zp_shape(m_key_quant_param, S);
-            new_scale_zp_k.resize<float>(real_shape);
-            real_shape = get_scale_zp_shape(m_value_quant_param, SV);
-            new_scale_zp_v.resize<float>(real_shape);
-            if (L0 > 0 && !is_reset) {
-                auto update_scales_zp =
-                    [&](const SDPAQuantParam& quant_param, PlainTensor& new_scale_zp, PlainTensor& old_scale_zp) {
-                        if (quant_param.isByChannel) {
-                            size_t group_nums = div_up(L0, quant_param.groupSize) * 2;
-                            parallel_for(group_nums, [&](size_t m) {
-                                memcpy(new_scale_zp.ptr<float>(m),
-                                       old_scale_zp.ptr<float>(m),
-                                       sizeof(float) * old_scale_zp.m_dims[1] * old_scale_zp.m_dims[2] *
-                                           old_scale_zp.m_dims[3]);
-                            });
-                        } else {
-                            parallel_for(L0, [&](size_t m) {
-                                memcpy(new_scale_zp.ptr<float>(m),
-                                       old_scale_zp.ptr<float>(m),
-                                       sizeof(float) * old_scale_zp.m_dims[1] * old_scale_zp.m_dims[2] *
-                                           old_scale_zp.m_dims[3]);
-                            });
-                        }
-                    };
-                update_scales_zp(m_key_quant_param, new_scale_zp_k, old_scale_zp_k);
-                update_scales_zp(m_value_quant_param, new_scale_zp_v, old_scale_zp_v);
-            }
-            m_k_state->set_scale_zp(new_scale_zp_k);
-            m_v_state->set_scale_zp(new_scale_zp_v);
+            // the scale/zp tables are also stored along L (or the groups of L) as the outermost axis
+            auto update_scales_zp =
+                [&](const SDPAQuantParam& quant_param, const std::shared_ptr<VariableStateKVcache>& state, size_t hs) {
+                    auto scale_zp_shape = Shape(get_scale_zp_shape(quant_param, hs));
+                    auto scale_zp_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, scale_zp_shape);
+                    auto scale_zp_mem = state->scale_zp_mem();
+                    if (grow_in_place && scale_zp_mem) {
+                        scale_zp_mem->redefineDesc(scale_zp_desc);
+                        state->assign_scale_zp_mem(scale_zp_mem);
+                        return;
+                    }
+                    // the table is created by set_state or beam reordering, copy it once to the growable storage
+                    auto& old_scale_zp = state->get_scale_zp();
+                    PlainTensor new_scale_zp;
+                    auto new_scale_zp_mem = VariableStateKVcache::make_kv_cache_memory(getEngine(),
+                                                                                       scale_zp_desc,
+                                                                                       context->getNumaNodeId());
+                    new_scale_zp.reset(new_scale_zp_mem);
+                    if (grow_in_place) {
+                        size_t rows = quant_param.isByChannel ? div_up(L0, quant_param.groupSize) * 2 : L0;
+                        parallel_for(rows, [&](size_t m) {
+                            memcpy(new_scale_zp.ptr<float>(m),
+                                   old_scale_zp.ptr<float>(m),
+                                   sizeof(float) * old_scale_zp.m_dims[1] * old_scale_zp.m_dims[2] *
+                                       old_scale_zp.m_dims[3]);
+                        });
+                    }
+                    state->assign_scale_zp_mem(new_scale_zp_mem);
+                };
+            update_scales_zp(m_key_quant_param, m_k_state, S);
+            update_scales_zp(m_value_quant_param, m_v_state, SV);
         }
     } else if (is_reset) {
         // when reset and not resize, just reset the desc
@@ -2056,7 +2067,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
                     ov::element::f32,
                     ov::intel_cpu::Shape{static_cast<size_t>(parallel_get_max_threads()),
                                          m_key_quant_param.groupSize * S});
-                auto scratchMem = context->getScratchPad()->createScratchPadMem(newMemDesc);
+                auto scratchMem = getScratchPad()->createScratchPadMem(newMemDesc);
                 auto* temp_buffer = scratchMem->getDataAs<float>();
                 // L0 is set to 0 here because past_kv is reset by set_state API, re-initializing
                 attn_quantkv(init_k,
@@ -2082,7 +2093,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
             ov::element::f32,
             ov::intel_cpu::Shape{static_cast<size_t>(parallel_get_max_threads()), m_key_quant_param.groupSize * S});
-        auto scratchMem = context->getScratchPad()->createScratchPadMem(newMemDesc);
+        auto scratchMem = getScratchPad()->createScratchPadMem(newMemDesc);
         auto* temp_buffer = scratchMem->getDataAs<float>();
         attn_quantkv(cur_k,
                      cur_v,
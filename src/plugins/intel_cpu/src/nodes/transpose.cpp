@@ -99,7 +99,7 @@ void Transpose::initSupportedPrimitiveDescriptors() {
         creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::i32, getInputShapeAtPort(INPUT_ORDER_IDX)));
     config.outConfs[0].inPlace(isOptimized ? 0 : -1);
     config.outConfs[0].constant(false);
-    transpose_context = std::make_shared<ExecutorContext>(context, getImplPriority());
+    transpose_context = std::make_shared<ExecutorContext>(context, getImplPriority(), getSharedScratchPadSlot());
 
     auto supportedPrimitiveDescriptorsBuilder = [this](const NodeConfig& config,
                                                        const TransposeParams& transposeParams) {
@@ -215,7 +215,8 @@ void Transpose::prepareParams() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    // the executor keeps the executor context of this node, which refers to the scratch pads of this stream
+    auto cache = context->getPrivateParamsCache();
     auto result = cache->getOrCreate(transposeParams.permuteParams, builder);
 
     CPU_NODE_ASSERT(result.first, "Primitive descriptor was not found.");
@@ -119,6 +119,7 @@ enum impl_desc_type : int64_t {
     gemm_acl = gemm | acl,
     winograd_acl = winograd | acl,
     gemm_mlas = gemm | mlas,
+    gemm_sparse = gemm | sparse,
 
     jit_asimd = jit | asimd,
     jit_sve128 = jit | sve128,
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <exception>
 #include <fstream>
 #include <istream>
 #include <memory>
@@ -49,6 +50,7 @@
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/util/log.hpp"
 #include "sigstack_manager.h"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
@@ -553,6 +555,10 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             RW_property(ov::log::level.name()),
             RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RW_property(ov::intel_cpu::enable_tensor_parallel.name()),
+            RW_property(ov::intel_cpu::enable_inter_op_parallel.name()),
+            RW_property(ov::intel_cpu::enable_lm_head_slicing.name()),
+            RW_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+            RW_property(ov::intel_cpu::cpu_runtime_cache_warmup.name()),
             RW_property(ov::hint::dynamic_quantization_group_size.name()),
             RW_property(ov::hint::kv_cache_precision.name()),
             RW_property(ov::key_cache_precision.name()),
@@ -628,6 +634,19 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
     if (name == ov::intel_cpu::enable_tensor_parallel) {
         return static_cast<decltype(ov::intel_cpu::enable_tensor_parallel)::value_type>(engConfig.enableTensorParallel);
     }
+    if (name == ov::intel_cpu::enable_inter_op_parallel) {
+        return static_cast<decltype(ov::intel_cpu::enable_inter_op_parallel)::value_type>(
+            engConfig.enableInterOpParallel);
+    }
+    if (name == ov::intel_cpu::enable_lm_head_slicing) {
+        return static_cast<decltype(ov::intel_cpu::enable_lm_head_slicing)::value_type>(engConfig.enableLMHeadSlicing);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_shared) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_shared)::value_type>(engConfig.rtCacheShared);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_warmup) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_warmup)::value_type>(engConfig.rtCacheWarmup);
+    }
     if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{get_device_name()};
     }
@@ -762,6 +781,14 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
     // import config props from caching model
     calculate_streams(conf, model, true);
     auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    if (conf.rtCacheWarmup && !deserializer.get_warmup_shapes().empty()) {
+        // the warm-up is an optimization only, the imported model is usable even if it fails
+        try {
+            compiled_model->warm_up(deserializer.get_warmup_shapes());
+        } catch (const std::exception& e) {
+            OPENVINO_WARN("CPU runtime cache warm-up failed: ", e.what());
+        }
+    }
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::SamplingNode::SamplingNode(const ov::Output<Node>& logits, Config config)
+    : Op({logits}),
+      m_config(std::move(config)) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::SamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(SamplingNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::SamplingNode>(new_args.at(0), m_config);
+}
+
+bool ov::intel_cpu::SamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(SamplingNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("temperature", m_config.temperature);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("top_p", m_config.top_p);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
+
+void ov::intel_cpu::SamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(SamplingNode_validate_and_infer_types);
+    OPENVINO_ASSERT(m_config.temperature > 0.0F, "temperature must be positive, got ", m_config.temperature);
+    OPENVINO_ASSERT(m_config.top_p > 0.0F && m_config.top_p <= 1.0F,
+                    "top_p must be in the range (0, 1], got ",
+                    m_config.top_p);
+    OPENVINO_ASSERT(m_config.output_type == ov::element::i32 || m_config.output_type == ov::element::i64,
+                    "output_type must be i32 or i64 whereas it is ",
+                    m_config.output_type);
+
+    const auto& logits_et = get_input_element_type(0);
+    const auto& logits_shape = get_input_partial_shape(0);
+    OPENVINO_ASSERT(logits_et.is_real() || logits_et.is_dynamic(),
+                    "'logits' input must be real whereas current element type is ",
+                    logits_et);
+    OPENVINO_ASSERT(logits_shape.rank().compatible(2),
+                    "'logits' input must have 2D shape whereas current shape is ",
+                    logits_shape);
+
+    const auto batch = logits_shape.rank().is_static() ? logits_shape[0] : ov::Dimension::dynamic();
+    set_output_type(0, m_config.output_type, ov::PartialShape{batch, 1});
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+/**
+ * The operation samples the next token ids from the logits in a single pass: the temperature scaling, the top-k and
+ * nucleus (top-p) filtering, the softmax and the multinomial sampling.
+ * Inputs:
+ *     1. Logits of type T - shape [B, V], where B - batch size, V - vocabulary size. Required
+ * Outputs:
+ *     1. Token ids of type output_type - shape [B, 1].
+ * Attributes:
+ *     temperature - the logits are divided by the temperature, must be positive
+ *     top_k - the number of the most probable tokens to sample from, 0 means the whole vocabulary
+ *     top_p - the tokens are sampled from the smallest set of the most probable ones with the cumulative probability
+ *             of at least top_p, 1 disables the filtering. Along with top_k it filters the top_k tokens after their
+ *             probabilities are renormalized
+ *     global_seed, op_seed - the seeds of the random generator, the same as of Multinomial
+ * If both top_k and top_p are disabled, the tokens are sampled in the vocabulary order as Multinomial after Softmax
+ * does, otherwise in the order of the descending probability as Multinomial after TopK and Softmax does.
+ * Types:
+ *     T - f32, bf16, f16
+ *     output_type - i32, i64
+ */
+class SamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("Sampling", "cpu_plugin_opset");
+
+    struct Config {
+        float temperature = 1.0F;
+        size_t top_k = 0;
+        float top_p = 1.0F;
+        uint64_t global_seed = 0;
+        uint64_t op_seed = 0;
+        ov::element::Type output_type = ov::element::i64;
+    };
+
+    SamplingNode() = default;
+    SamplingNode(const ov::Output<Node>& logits, Config config);
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling_fusion.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/gather_elements.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+#include "transformations/utils/utils.hpp"
+
+namespace {
+
+bool is_last_axis(int64_t axis) {
+    return axis == 1 || axis == -1;
+}
+
+// Returns the node consuming the sampled positions in the TopK values to get the token ids, or nullptr
+std::shared_ptr<ov::Node> get_topk_indices_gather(const std::shared_ptr<ov::op::util::TopKBase>& topk,
+                                                  const std::shared_ptr<ov::Node>& multinomial) {
+    const auto& consumers = multinomial->get_output_target_inputs(0);
+    if (consumers.size() != 1 || topk->get_output_target_inputs(1).size() != 1) {
+        return nullptr;
+    }
+    auto gather = consumers.begin()->get_node()->shared_from_this();
+    if (consumers.begin()->get_index() != 1 || gather->input_value(0) != topk->output(1)) {
+        return nullptr;
+    }
+    if (const auto gather_v8 = ov::as_type_ptr<ov::op::v8::Gather>(gather)) {
+        return gather_v8->get_batch_dims() == 1 && gather_v8->get_axis() == 1 ? gather : nullptr;
+    }
+    if (const auto gather_elements = ov::as_type_ptr<ov::op::v6::GatherElements>(gather)) {
+        return is_last_axis(gather_elements->get_axis()) ? gather : nullptr;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+ov::intel_cpu::SamplingFusion::SamplingFusion() {
+    MATCHER_SCOPE(SamplingFusion);
+    using namespace ov::pass::pattern;
+
+    auto logits_m = any_input(rank_equals(2));
+    auto temperature_m = wrap_type<ov::op::v0::Constant>();
+    auto scaled_logits_m =
+        wrap_type<ov::op::v1::Divide, ov::op::v1::Multiply>({logits_m, temperature_m}, consumers_count(1));
+    auto softmax_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{scaled_logits_m, logits_m});
+    auto softmax_m = wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax, ov::op::v5::LogSoftmax>({softmax_input_m},
+                                                                                                  consumers_count(1));
+    auto num_samples_m = wrap_type<ov::op::v0::Constant>();
+    auto multinomial_m = wrap_type<ov::op::v13::Multinomial>({softmax_m, num_samples_m});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto multinomial = ov::as_type_ptr<ov::op::v13::Multinomial>(m.get_match_root());
+        const auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        if (!multinomial || transformation_callback(multinomial)) {
+            return false;
+        }
+
+        // the token ids are sampled one per batch
+        const auto num_samples =
+            ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(num_samples_m).get_node_shared_ptr());
+        if (!ov::op::util::constantIsEqualTo(num_samples, 1)) {
+            return false;
+        }
+
+        const bool log_softmax = ov::is_type<ov::op::v5::LogSoftmax>(softmax);
+        if (log_softmax != multinomial->get_log_probs()) {
+            return false;
+        }
+        int64_t axis = 0;
+        if (const auto softmax_v1 = ov::as_type_ptr<ov::op::v1::Softmax>(softmax)) {
+            axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else if (const auto softmax_v8 = ov::as_type_ptr<ov::op::v8::Softmax>(softmax)) {
+            axis = softmax_v8->get_axis();
+        } else {
+            axis = ov::as_type_ptr<ov::op::v5::LogSoftmax>(softmax)->get_axis();
+        }
+        if (!is_last_axis(axis)) {
+            return false;
+        }
+
+        SamplingNode::Config config;
+        config.global_seed = multinomial->get_global_seed();
+        config.op_seed = multinomial->get_op_seed();
+        config.output_type = multinomial->get_convert_type();
+
+        if (pattern_map.count(scaled_logits_m)) {
+            const auto temperature =
+                ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(temperature_m).get_node_shared_ptr());
+            if (ov::shape_size(temperature->get_shape()) != 1) {
+                return false;
+            }
+            const auto value = temperature->cast_vector<float>()[0];
+            const bool divide = ov::is_type<ov::op::v1::Divide>(pattern_map.at(scaled_logits_m).get_node_shared_ptr());
+            if (!(value > 0.0F)) {
+                return false;
+            }
+            config.temperature = divide ? value : 1.0F / value;
+        }
+
+        auto logits = pattern_map.at(logits_m);
+        std::shared_ptr<ov::Node> replaced = multinomial;
+        ov::NodeVector fused_nodes = m.get_matched_nodes();
+        // the sampled positions in the TopK values are converted to the token ids by the TopK indices
+        const auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(logits.get_node_shared_ptr());
+        if (topk && logits.get_index() == 0 && topk->get_output_target_inputs(0).size() == 1 &&
+            topk->get_input_partial_shape(0).rank().is_static() && topk->get_axis() == 1 && topk->get_k() > 0 &&
+            topk->get_mode() == ov::op::TopKMode::MAX && topk->get_sort_type() == ov::op::TopKSortType::SORT_VALUES) {
+            if (const auto gather = get_topk_indices_gather(topk, multinomial)) {
+                config.top_k = topk->get_k();
+                config.output_type = gather->get_output_element_type(0);
+                logits = topk->input_value(0);
+                replaced = gather;
+                fused_nodes.push_back(topk);
+                fused_nodes.push_back(gather);
+            }
+        }
+        if (config.output_type != ov::element::i32 && config.output_type != ov::element::i64) {
+            return false;
+        }
+
+        auto sampling = std::make_shared<SamplingNode>(logits, config);
+        sampling->set_friendly_name(replaced->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, sampling);
+        ov::replace_node(replaced, sampling);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(multinomial_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the sampling of the token ids from the logits into the Sampling operation:
+ *     logits -> [TopK(values)] -> [Divide/Multiply by temperature] -> Softmax/LogSoftmax -> Multinomial(1 sample)
+ *         -> [Gather/GatherElements(TopK indices)]
+ */
+class SamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("SamplingFusion");
+    SamplingFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.hpp"
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "transformations/itt.hpp"
+
+namespace ov::intel_cpu {
+
+bool MoENode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(MoENode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("num_experts", m_config.num_experts);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("normalize_topk", m_config.normalize_topk);
+    visitor.on_attribute("act", m_config.mlp.act);
+    visitor.on_attribute("gate_up_quantized", m_config.mlp.gate_up_quantized);
+    visitor.on_attribute("down_quantized", m_config.mlp.down_quantized);
+    visitor.on_attribute("hidden_size", m_config.mlp.hidden_size);
+    visitor.on_attribute("up_size", m_config.mlp.up_size);
+    visitor.on_attribute("gate_up_combined", m_config.mlp.gate_up_combined);
+    visitor.finish_structure();
+    return true;
+}
+
+void MoENode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(MoENode_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, m_config.num_experts > 0, "number of experts must be positive");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.top_k > 0 && m_config.top_k <= m_config.num_experts,
+                          "top_k must be in range [1, num_experts]");
+
+    const auto input_size = get_input_size();
+    const auto expect_input_size = 2 + static_cast<size_t>(m_config.num_experts) * expert_input_size(m_config.mlp);
+    NODE_VALIDATION_CHECK(this, input_size == expect_input_size);
+
+    const auto& ishape = get_input_partial_shape(0);
+    const auto& itype = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, ishape.rank().is_static() && ishape.rank() == 3, "feature shape rank must be 3");
+    NODE_VALIDATION_CHECK(this, ishape[2].is_static());
+    NODE_VALIDATION_CHECK(this, itype.is_real(), "feature data type must be real");
+
+    const auto& logits_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          logits_shape.rank().is_static() && logits_shape.rank() == 3,
+                          "router logits shape rank must be 3");
+    NODE_VALIDATION_CHECK(this,
+                          logits_shape[2].compatible(m_config.num_experts),
+                          "router logits last dimension must be equal to the number of experts");
+    NODE_VALIDATION_CHECK(this, get_input_element_type(1).is_real(), "router logits data type must be real");
+
+    // the down projection restores the hidden size, so the output has the same shape as the input
+    set_output_type(0, itype, ishape);
+}
+
+std::shared_ptr<Node> MoENode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(MoENode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<MoENode>(new_args, m_config);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+
+namespace ov::intel_cpu {
+
+// Mixture of experts: router softmax + top-k selection followed by the weighted sum of the selected experts' MLPs.
+class MoENode : public ov::op::Op {
+public:
+    OPENVINO_OP("MoE", "cpu_plugin_opset");
+
+    MoENode() = default;
+
+    struct Config {
+        int num_experts;
+        int top_k;
+        // re-normalize the top-k routing weights to sum up to 1
+        bool normalize_topk;
+        // all the experts share the same MLP configuration
+        LLMMLPNode::Config mlp;
+    };
+
+    // args:
+    //      0: hidden states [batch, length, hidden_size]
+    //      1: router logits [batch, length, num_experts]
+    //      2...: inputs 1... of the LLMMLP of every expert in the order of expert ids
+    MoENode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
+        validate_and_infer_types();
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+    // number of the inputs per expert
+    static size_t expert_input_size(const LLMMLPNode::Config& mlp) {
+        return 3 + (mlp.gate_up_quantized ? 2 : 0) + (mlp.down_quantized ? 1 : 0);
+    }
+
+private:
+    Config m_config{};
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe_fusion.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace {
+
+using ov::intel_cpu::LLMMLPNode;
+
+bool has_single_consumer(const ov::Output<ov::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+// Checks that the node reduces the last dimension of its input and keeps it
+bool is_last_dim_reduce_sum(const std::shared_ptr<ov::Node>& node) {
+    auto reduce = ov::as_type_ptr<ov::op::v1::ReduceSum>(node);
+    if (!reduce || !reduce->get_keep_dims()) {
+        return false;
+    }
+    const auto rank = reduce->get_input_partial_shape(0).rank();
+    auto axes = ov::as_type_ptr<ov::op::v0::Constant>(reduce->get_input_node_shared_ptr(1));
+    if (!axes || rank.is_dynamic() || ov::shape_size(axes->get_shape()) != 1) {
+        return false;
+    }
+    const auto axis = axes->cast_vector<int64_t>()[0];
+    return axis == -1 || axis == rank.get_length() - 1;
+}
+
+bool is_last_dim_softmax(const std::shared_ptr<ov::Node>& node) {
+    const auto rank = node->get_input_partial_shape(0).rank();
+    if (rank.is_dynamic()) {
+        return false;
+    }
+    if (auto softmax = ov::as_type_ptr<ov::op::v8::Softmax>(node)) {
+        return softmax->get_axis() == -1 || softmax->get_axis() == rank.get_length() - 1;
+    }
+    if (auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(node)) {
+        return static_cast<int64_t>(softmax->get_axis()) == rank.get_length() - 1;
+    }
+    return false;
+}
+
+// Flattens the tree of Add nodes into its addends, the inner nodes must not be used elsewhere
+void collect_addends(const ov::Output<ov::Node>& output, bool is_root, ov::OutputVector& addends) {
+    auto add = ov::as_type_ptr<ov::op::v1::Add>(output.get_node_shared_ptr());
+    if (add && (is_root || has_single_consumer(output))) {
+        collect_addends(add->input_value(0), false, addends);
+        collect_addends(add->input_value(1), false, addends);
+        return;
+    }
+    addends.push_back(output);
+}
+
+struct ExpertRouting {
+    std::shared_ptr<ov::op::util::TopKBase> topk;
+    bool normalized = false;
+    int64_t expert_id = -1;
+};
+
+// Parses ReduceSum(values * Convert(Equal(indices, expert_id)), -1, keep_dims)
+bool parse_routing_weight(const ov::Output<ov::Node>& output, ExpertRouting& routing) {
+    const auto reduce = output.get_node_shared_ptr();
+    if (!is_last_dim_reduce_sum(reduce) || !has_single_consumer(output)) {
+        return false;
+    }
+    auto mul = ov::as_type_ptr<ov::op::v1::Multiply>(reduce->get_input_node_shared_ptr(0));
+    if (!mul) {
+        return false;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        auto values = mul->input_value(i);
+        auto one_hot = mul->get_input_node_shared_ptr(1 - i);
+        if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(one_hot)) {
+            one_hot = convert->get_input_node_shared_ptr(0);
+        }
+        auto equal = ov::as_type_ptr<ov::op::v1::Equal>(one_hot);
+        if (!equal) {
+            continue;
+        }
+
+        // values are either the TopK values or them divided by their sum
+        routing.normalized = false;
+        if (auto divide = ov::as_type_ptr<ov::op::v1::Divide>(values.get_node_shared_ptr())) {
+            const auto sum = divide->get_input_node_shared_ptr(1);
+            if (!is_last_dim_reduce_sum(sum) || sum->input_value(0) != divide->input_value(0)) {
+                continue;
+            }
+            values = divide->input_value(0);
+            routing.normalized = true;
+        }
+        routing.topk = ov::as_type_ptr<ov::op::util::TopKBase>(values.get_node_shared_ptr());
+        if (!routing.topk || values.get_index() != 0) {
+            continue;
+        }
+
+        for (size_t j = 0; j < 2; j++) {
+            const auto indices = equal->input_value(j);
+            auto id = ov::as_type_ptr<ov::op::v0::Constant>(equal->get_input_node_shared_ptr(1 - j));
+            if (indices.get_node() != routing.topk.get() || indices.get_index() != 1 || !id ||
+                ov::shape_size(id->get_shape()) != 1) {
+                continue;
+            }
+            routing.expert_id = id->cast_vector<int64_t>()[0];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool is_same_config(const LLMMLPNode::Config& a, const LLMMLPNode::Config& b) {
+    return a.act == b.act && a.gate_up_quantized == b.gate_up_quantized && a.down_quantized == b.down_quantized &&
+           a.hidden_size == b.hidden_size && a.up_size == b.up_size && a.gate_up_combined == b.gate_up_combined;
+}
+
+}  // namespace
+
+ov::intel_cpu::MoEFusion::MoEFusion() {
+    MATCHER_SCOPE(MoEFusion);
+
+    auto experts_sum = wrap_type<ov::op::v1::Add>();
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        auto root = m.get_match_root();
+
+        ov::OutputVector addends;
+        collect_addends(root->output(0), true, addends);
+        if (addends.size() < 2) {
+            return false;
+        }
+
+        std::shared_ptr<ov::op::util::TopKBase> topk;
+        bool normalized = false;
+        Output<Node> hidden_states;
+        LLMMLPNode::Config mlp_config{};
+        std::vector<std::shared_ptr<LLMMLPNode>> experts(addends.size());
+        ov::NodeVector fused_nodes;
+        for (const auto& addend : addends) {
+            auto mul = ov::as_type_ptr<ov::op::v1::Multiply>(addend.get_node_shared_ptr());
+            if (!mul || !has_single_consumer(addend)) {
+                return false;
+            }
+            std::shared_ptr<LLMMLPNode> mlp;
+            ExpertRouting routing;
+            for (size_t i = 0; i < 2 && !mlp; i++) {
+                auto candidate = ov::as_type_ptr<LLMMLPNode>(mul->get_input_node_shared_ptr(i));
+                if (candidate && has_single_consumer(mul->input_value(i)) &&
+                    parse_routing_weight(mul->input_value(1 - i), routing)) {
+                    mlp = candidate;
+                }
+            }
+            if (!mlp) {
+                return false;
+            }
+
+            if (!topk) {
+                topk = routing.topk;
+                normalized = routing.normalized;
+                hidden_states = mlp->input_value(0);
+                mlp_config = mlp->get_config();
+            }
+            if (routing.topk != topk || routing.normalized != normalized || mlp->input_value(0) != hidden_states ||
+                !is_same_config(mlp->get_config(), mlp_config)) {
+                return false;
+            }
+            // every expert must be present exactly once
+            if (routing.expert_id < 0 || routing.expert_id >= static_cast<int64_t>(experts.size()) ||
+                experts[routing.expert_id]) {
+                return false;
+            }
+            experts[routing.expert_id] = mlp;
+            fused_nodes.push_back(mul);
+            fused_nodes.push_back(mlp);
+        }
+
+        const auto softmax = topk->get_input_node_shared_ptr(0);
+        if (!is_last_dim_softmax(softmax) || topk->get_mode() != ov::op::TopKMode::MAX) {
+            return false;
+        }
+        const auto& probs_shape = topk->get_input_partial_shape(0);
+        if (probs_shape.rank().is_dynamic() || topk->get_axis() != static_cast<uint64_t>(probs_shape.size() - 1) ||
+            probs_shape[probs_shape.size() - 1] != static_cast<int64_t>(experts.size())) {
+            return false;
+        }
+        const auto top_k = topk->get_k();
+        if (top_k == 0 || top_k > experts.size()) {
+            return false;
+        }
+
+        MoENode::Config config{};
+        config.num_experts = static_cast<int>(experts.size());
+        config.top_k = static_cast<int>(top_k);
+        config.normalize_topk = normalized;
+        config.mlp = mlp_config;
+
+        OutputVector new_args{hidden_states, softmax->input_value(0)};
+        for (const auto& expert : experts) {
+            for (size_t i = 1; i < expert->get_input_size(); i++) {
+                new_args.push_back(expert->input_value(i));
+            }
+        }
+
+        auto new_node = std::make_shared<MoENode>(new_args, config);
+        new_node->set_friendly_name(root->get_friendly_name());
+        fused_nodes.push_back(root);
+        fused_nodes.push_back(topk);
+        fused_nodes.push_back(softmax);
+        ov::copy_runtime_info(fused_nodes, new_node);
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        ov::replace_node(root, new_node);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(experts_sum, matcher_name);
+    this->register_matcher(m, callback);
+}
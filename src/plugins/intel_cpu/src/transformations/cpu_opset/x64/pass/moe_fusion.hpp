@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Fuses the dense form of the mixture of experts into MoENode:
+ *
+ *   probs = Softmax(router_logits); values, indices = TopK(probs, k) [; values /= ReduceSum(values)]
+ *   output = Sum_e LLMMLP_e(x) * ReduceSum(values * Convert(Equal(indices, e)), -1, keep_dims)
+ *
+ * All the experts 0..num_experts-1 must be present and share the same input and LLMMLP configuration,
+ * so the pass is expected to run after MLPFusion.
+ */
+class MoEFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("MoEFusion");
+    MoEFusion();
+};
+
+}  // namespace ov::intel_cpu
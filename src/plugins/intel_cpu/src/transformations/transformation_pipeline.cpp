@@ -129,6 +129,7 @@
 #include "transformations/op_conversions/unique_decomposition.hpp"
 #include "transformations/opset_conversions/convert_opset2_to_opset1.hpp"
 #include "transformations/rt_info/keep_const_precision.hpp"
+#include "transformations/sdpa_to_paged_attention/slice_before_lm_head.hpp"
 #include "transformations/smart_reshape/matmul_sr.hpp"
 #include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
 #include "utils/general_utils.h"
@@ -147,6 +148,7 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
+#include "transformations/cpu_opset/common/pass/sampling_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
@@ -224,6 +226,7 @@
 #    include "low_precision/fuse_convert.hpp"
 #    include "low_precision/weightable_layer_transformation.hpp"
 #    include "nodes/llm_mlp.h"
+#    include "nodes/moe.h"
 #    include "nodes/qkv_proj.h"
 #    include "nodes/rms_norm.h"
 #    include "onednn/dnnl.h"
@@ -239,6 +242,7 @@
 #    include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
 #    include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
 #    include "transformations/cpu_opset/x64/pass/mlp_fusion.hpp"
+#    include "transformations/cpu_opset/x64/pass/moe_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/qkv_proj_fusion.hpp"
 #    include "transformations/op_conversions/group_normalization_decomposition.hpp"
 #    include "transformations/op_conversions/hsigmoid_decomposition.hpp"
@@ -499,6 +503,25 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
 
     ov::pass::Manager manager("Plugin:CPU");
     manager.set_per_pass_validation(false);
+    if (config.enableLMHeadSlicing) {
+        // only the generation loops of the LLMs, stateful or with PagedAttention, use the logits of the last token,
+        // the logits of all the tokens of a stateless model may be needed (e.g. to score the prompt)
+        const auto& ops = model->get_ops();
+        const bool has_paged_attention = std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
+            return ov::is_type<ov::op::PagedAttentionExtension>(op);
+        });
+        // PagedAttention models select the last token of each sequence by the subsequence_begins input
+        const auto& parameters = model->get_parameters();
+        const auto subsequence_begins =
+            std::find_if(parameters.begin(), parameters.end(), [](const std::shared_ptr<ov::op::v0::Parameter>& param) {
+                return param->output(0).get_names().count("subsequence_begins") != 0;
+            });
+        if (has_paged_attention && subsequence_begins != parameters.end()) {
+            CPU_REGISTER_PASS_COMMON(manager, ov::pass::SliceBeforeLMHead, (*subsequence_begins)->output(0));
+        } else if (!has_paged_attention && !model->get_variables().empty()) {
+            CPU_REGISTER_PASS_COMMON(manager, ov::pass::SliceBeforeLMHead);
+        }
+    }
     if (useLpt) {
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantization, defaultPrecisions);
     }
@@ -1077,6 +1100,7 @@ void Transformations::PostLpt() {
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionFlux);
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionChatGLMHF);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, SamplingFusion);
 
 #if defined(OPENVINO_ARCH_X86_64)
     // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
@@ -1096,6 +1120,15 @@ void Transformations::PostLpt() {
             },
             MLPFusionPass);
 
+        CPU_REGISTER_PASS_X64(postLPTPassManager, MoEFusion);
+        CPU_SET_CALLBACK_X64(
+            postLPTPassManager,
+            [fcDynamicQuantizationGroupSize](const_node_ptr& node) -> bool {
+                std::string errorMsg;
+                return node::MoE::isSupportedOperation(node, errorMsg, fcDynamicQuantizationGroupSize);
+            },
+            MoEFusion);
+
         size_t concurrency = config.streamExecutorConfig.get_threads_per_stream();
         if (concurrency == 0) {
             concurrency = parallel_get_max_threads();
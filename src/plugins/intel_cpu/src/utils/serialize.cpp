@@ -10,9 +10,11 @@
 #include <istream>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -28,13 +30,28 @@ namespace ov::intel_cpu {
 
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn)
+ModelSerializer::ModelSerializer(std::ostream& ostream,
+                                 const CacheEncrypt& encrypt_fn,
+                                 const std::vector<InputShapes>& warmup_shapes)
     : ov::pass::StreamSerialize(
           ostream,
-          [](std::ostream& stream) {
+          [warmup_shapes](std::ostream& stream) {
               pugi::xml_document xml_doc;
               pugi::xml_node root = xml_doc.append_child("cnndata");
               root.append_child("outputs");
+              if (!warmup_shapes.empty()) {
+                  auto warmup = root.append_child("warmup");
+                  for (const auto& input_shapes : warmup_shapes) {
+                      auto infer = warmup.append_child("infer");
+                      for (const auto& shape : input_shapes) {
+                          std::ostringstream dims;
+                          for (size_t i = 0; i < shape.size(); i++) {
+                              dims << (i == 0 ? "" : ",") << shape[i];
+                          }
+                          infer.append_child("input").append_attribute("shape").set_value(dims.str().c_str());
+                      }
+                  }
+              }
               xml_doc.save(stream);
           },
           encrypt_fn) {};
@@ -77,7 +94,21 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
     }
 }
 
-void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
+void ModelDeserializer::set_info(pugi::xml_node& root, [[maybe_unused]] std::shared_ptr<ov::Model>& model) {
+    m_warmup_shapes.clear();
+    for (auto infer = root.child("warmup").child("infer"); infer; infer = infer.next_sibling("infer")) {
+        InputShapes input_shapes;
+        for (auto input = infer.child("input"); input; input = input.next_sibling("input")) {
+            ov::Shape shape;
+            std::istringstream dims(input.attribute("shape").as_string());
+            for (std::string dim; std::getline(dims, dim, ',');) {
+                shape.push_back(static_cast<size_t>(std::stoull(dim)));
+            }
+            input_shapes.push_back(std::move(shape));
+        }
+        m_warmup_shapes.push_back(std::move(input_shapes));
+    }
+}
 
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     std::visit(
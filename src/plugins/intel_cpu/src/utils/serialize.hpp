@@ -10,19 +10,30 @@
 #include <pugixml.hpp>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "utils/codec_xor.hpp"
 
 namespace ov::intel_cpu {
 
+// input shapes of a single inference, ordered by the model input index
+using InputShapes = std::vector<ov::Shape>;
+
 class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    explicit ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn = {});
+    /**
+     * @param warmup_shapes input shapes observed during the inference, which are stored in the custom data section
+     *        to pre-populate the runtime caches on import
+     */
+    explicit ModelSerializer(std::ostream& ostream,
+                             const CacheEncrypt& encrypt_fn = {},
+                             const std::vector<InputShapes>& warmup_shapes = {});
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
@@ -49,8 +60,16 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Returns the warm-up input shapes read from the custom data section (empty for the blobs without it).
+     * Valid after the model is deserialized.
+     */
+    [[nodiscard]] const std::vector<InputShapes>& get_warmup_shapes() const {
+        return m_warmup_shapes;
+    }
+
 protected:
-    static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
+    void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
     void process_model(std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::AlignedBuffer>& model_buffer);
     void process_model(std::shared_ptr<ov::Model>& model, std::reference_wrapper<std::istream> model_stream);
@@ -59,6 +78,7 @@ protected:
     ModelBuilder m_model_builder;
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
+    std::vector<InputShapes> m_warmup_shapes;
 };
 
 }  // namespace ov::intel_cpu
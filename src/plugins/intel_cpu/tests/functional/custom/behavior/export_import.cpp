@@ -7,8 +7,11 @@
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
+#include "internal_properties.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
+#include "openvino/op/add.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/softmax.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
@@ -124,4 +127,125 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExportImportTest,
                                                              testing_property_for_enable_hyper_threading,
                                                              testing_property_for_enable_cpu_pinning)));
 
+std::shared_ptr<ov::Model> MakeDynamicMatMulModel(const ov::PartialShape& input_shape = {-1, 64}) {
+    ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, input_shape)};
+    auto matmul_const = ov::test::utils::make_constant(ov::element::f32, {64, 32});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(params[0], matmul_const);
+    auto softmax = std::make_shared<ov::opset9::Softmax>(matmul);
+
+    ov::OutputVector results{softmax};
+    return std::make_shared<ov::Model>(results, params, "DynamicMatMulModel");
+}
+
+uint64_t GetRuntimeCacheMisses(const ov::CompiledModel& network) {
+    uint64_t misses = 0;
+    for (const auto& [name, value] :
+         network.get_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()).as<std::map<std::string, uint64_t>>()) {
+        if (name.size() > 7 && name.compare(name.size() - 7, 7, ".misses") == 0) {
+            misses += value;
+        }
+    }
+    return misses;
+}
+
+TEST(ExportImportWarmUp, RuntimeCacheIsPopulatedOnImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    const ov::AnyMap properties = {ov::num_streams(1),
+                                   ov::intel_cpu::cpu_runtime_cache_shared(true),
+                                   ov::intel_cpu::cpu_runtime_cache_warmup(true)};
+
+    const ov::Shape input_shape = {3, 64};
+    auto original_network = core.compile_model(MakeDynamicMatMulModel(), "CPU", properties);
+    auto original_request = original_network.create_infer_request();
+    original_request.set_input_tensor(ov::Tensor(ov::element::f32, input_shape));
+    original_request.infer();
+
+    std::stringstream exported_model;
+    original_network.export_model(exported_model);
+
+    auto imported_network = core.import_model(exported_model, "CPU", properties);
+    const auto misses_after_import = GetRuntimeCacheMisses(imported_network);
+    EXPECT_GT(misses_after_import, 0u);
+
+    // the shape was replayed on import, so the inference does not create new runtime parameters
+    auto imported_request = imported_network.create_infer_request();
+    imported_request.set_input_tensor(ov::Tensor(ov::element::f32, input_shape));
+    imported_request.infer();
+    EXPECT_EQ(misses_after_import, GetRuntimeCacheMisses(imported_network));
+}
+
+TEST(ExportImportWarmUp, DeclaredShapesAreStoredInCacheDir) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const std::string cache_dir = "ExportImportWarmUpCacheDir";
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeDir(cache_dir);
+
+    const ov::AnyMap properties = {ov::num_streams(1),
+                                   ov::cache_dir(cache_dir),
+                                   ov::intel_cpu::cpu_runtime_cache_shared(true),
+                                   ov::intel_cpu::cpu_runtime_cache_warmup(true)};
+    // the blob is exported right after the compilation, so only the declared shape bounds can be stored in it
+    const auto model = MakeDynamicMatMulModel({{1, 8}, 64});
+    {
+        ov::Core core;
+        auto compiled_network = core.compile_model(model, "CPU", properties);
+        EXPECT_FALSE(compiled_network.get_property(ov::loaded_from_cache));
+    }
+
+    ov::Core core;
+    auto cached_network = core.compile_model(model, "CPU", properties);
+    EXPECT_TRUE(cached_network.get_property(ov::loaded_from_cache));
+    const auto misses_after_import = GetRuntimeCacheMisses(cached_network);
+    EXPECT_GT(misses_after_import, 0u);
+
+    for (const auto& input_shape : {ov::Shape{1, 64}, ov::Shape{8, 64}}) {
+        auto request = cached_network.create_infer_request();
+        request.set_input_tensor(ov::Tensor(ov::element::f32, input_shape));
+        request.infer();
+    }
+    EXPECT_EQ(misses_after_import, GetRuntimeCacheMisses(cached_network));
+
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeDir(cache_dir);
+}
+
+TEST(ExportImportWarmUp, InconsistentDeclaredShapesAreSkipped) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const std::string cache_dir = "ExportImportWarmUpInconsistentCacheDir";
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeDir(cache_dir);
+
+    const ov::AnyMap properties = {ov::num_streams(1),
+                                   ov::cache_dir(cache_dir),
+                                   ov::intel_cpu::cpu_runtime_cache_shared(true),
+                                   ov::intel_cpu::cpu_runtime_cache_warmup(true)};
+    // the lower bounds of the inputs can not be added, so only the upper bounds are stored for the warm-up
+    ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{{2, 8}, 64}),
+                               std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{{3, 8}, 64})};
+    auto add = std::make_shared<ov::op::v1::Add>(params[0], params[1]);
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(add, ov::test::utils::make_constant(ov::element::f32, {64, 32}));
+    const auto model = std::make_shared<ov::Model>(ov::OutputVector{matmul}, params, "InconsistentBoundsModel");
+    {
+        ov::Core core;
+        auto compiled_network = core.compile_model(model, "CPU", properties);
+        EXPECT_FALSE(compiled_network.get_property(ov::loaded_from_cache));
+    }
+
+    ov::Core core;
+    auto cached_network = core.compile_model(model, "CPU", properties);
+    EXPECT_TRUE(cached_network.get_property(ov::loaded_from_cache));
+    const auto misses_after_import = GetRuntimeCacheMisses(cached_network);
+    EXPECT_GT(misses_after_import, 0u);
+
+    auto request = cached_network.create_infer_request();
+    request.set_input_tensor(0, ov::Tensor(ov::element::f32, {8, 64}));
+    request.set_input_tensor(1, ov::Tensor(ov::element::f32, {8, 64}));
+    request.infer();
+    EXPECT_EQ(misses_after_import, GetRuntimeCacheMisses(cached_network));
+
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeDir(cache_dir);
+}
+
 }  // namespace
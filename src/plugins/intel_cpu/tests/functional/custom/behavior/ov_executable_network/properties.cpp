@@ -48,6 +48,11 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::log::level.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
         RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
+        RO_property(ov::intel_cpu::enable_inter_op_parallel.name()),
+        RO_property(ov::intel_cpu::enable_lm_head_slicing.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_warmup.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
         RO_property(ov::hint::dynamic_quantization_group_size.name()),
         RO_property(ov::hint::kv_cache_precision.name()),
         RO_property(ov::key_cache_precision.name()),
@@ -254,6 +254,36 @@ TEST_P(ConcatSDPTest, CompareWithRefs) {
     }
 }
 
+TEST_P(ConcatSDPTest, TrimStateCompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    // with beam search the trimmed steps have already reordered the beam table of the remaining tokens
+    if (targetStaticShapes[0][0][0] != 1) {
+        GTEST_SKIP() << "Trimming restores the state of the greedy search only";
+    }
+    prepare();
+    auto infer = [&](int idx) {
+        generate(idx, targetStaticShapes[idx]);
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+        }
+        inferRequest.infer();
+        auto outputTensor = inferRequest.get_output_tensor(0);
+        ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+        outputTensor.copy_to(copy);
+        return copy;
+    };
+    infer(0);
+    auto expected_1 = infer(1);
+    auto expected_2 = infer(2);
+    // roll back the last two tokens and generate them again
+    for (auto&& state : inferRequest.query_state()) {
+        state.trim(2);
+    }
+    ov::test::utils::compare(expected_1, infer(1), abs_threshold, rel_threshold);
+    ov::test::utils::compare(expected_2, infer(2), abs_threshold, rel_threshold);
+    reset();
+}
+
 
 }  // namespace test
 }  // namespace ov
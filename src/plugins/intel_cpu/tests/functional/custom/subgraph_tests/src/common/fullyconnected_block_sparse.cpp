@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using FCBlockSparseTestParams = std::tuple<InputShape,         // activations shape
+                                           ov::Shape,          // weights shape [N, K]
+                                           ov::element::Type,  // weights precision
+                                           size_t>;            // one of this number of blocks is nonzero
+
+/*
+ * Weights with all but one of every zero_blocks_period 32-element blocks equal to the zero point:
+ *
+ *  Constant(weiType) -> [Convert -> [Subtract(zp)] -> Multiply(scale)]
+ *                                                     |
+ *  Parameter(f32) ------------------------------> MatMul(transpose_b)
+ */
+class FCBlockSparseCPUTest : public testing::WithParamInterface<FCBlockSparseTestParams>,
+                             virtual public SubgraphBaseTest,
+                             public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCBlockSparseTestParams>& obj) {
+        const auto& [input_shape, weights_shape, weights_precision, zero_blocks_period] = obj.param;
+        std::ostringstream results;
+        results << "IS=" << ov::test::utils::partialShape2str({input_shape.first}) << "_TS=(";
+        for (const auto& item : input_shape.second) {
+            results << ov::test::utils::vec2str(item) << "_";
+        }
+        results << ")_WS=" << ov::test::utils::vec2str(weights_shape) << "_weiType=" << weights_precision
+                << "_zeroBlocksPeriod=" << zero_blocks_period;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [input_shape, weights_shape, weights_precision, zero_blocks_period] = this->GetParam();
+        init_input_shapes({input_shape});
+        configuration.insert({ov::hint::inference_precision(ov::element::f32)});
+        configuration.insert({ov::intel_cpu::sparse_weights_decompression_rate(0.8f)});
+
+        const bool compressed = weights_precision != ov::element::f32;
+        const bool with_zero_point = weights_precision == ov::element::u8 || weights_precision == ov::element::u4;
+        const float zero_point = with_zero_point ? 8.f : 0.f;
+
+        const size_t N = weights_shape[0];
+        const size_t K = weights_shape[1];
+        std::vector<float> weights_data(N * K);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t k = 0; k < K; k++) {
+                const bool zero_block = ((n + k / 32) % zero_blocks_period) != 0;
+                const auto value = compressed ? static_cast<float>(static_cast<int>((n * 7 + k * 3) % 15) - 7)
+                                              : std::sin(static_cast<float>(n * K + k));
+                weights_data[n * K + k] = zero_block ? zero_point : zero_point + value;
+            }
+        }
+
+        auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        std::shared_ptr<ov::Node> weights =
+            ov::op::v0::Constant::create(weights_precision, weights_shape, weights_data);
+        if (compressed) {
+            weights = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+            if (with_zero_point) {
+                auto zp = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {zero_point});
+                weights = std::make_shared<ov::op::v1::Subtract>(weights, zp);
+            }
+            std::vector<float> scales(N);
+            for (size_t n = 0; n < N; n++) {
+                scales[n] = 0.01f * static_cast<float>(n % 5 + 1);
+            }
+            auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{N, 1}, scales);
+            weights = std::make_shared<ov::op::v1::Multiply>(weights, scale);
+        }
+        auto fc = std::make_shared<ov::op::v0::MatMul>(data, weights, false, true);
+        function = std::make_shared<ov::Model>(ov::OutputVector{fc}, ov::ParameterVector{data}, "FCBlockSparse");
+
+        selectedType = makeSelectedTypeStr("gemm_sparse", ov::element::f32);
+        // the rate of the zero blocks has to reach the configured one
+        block_sparse = 1.f - 1.f / static_cast<float>(zero_blocks_period) >= 0.8f;
+    }
+
+    bool block_sparse = false;
+};
+
+TEST_P(FCBlockSparseCPUTest, CompareWithRefs) {
+    run();
+    if (block_sparse) {
+        CheckPluginRelatedResults(compiledModel, "FullyConnected");
+        return;
+    }
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rt_info = node->get_rt_info();
+        if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() == "FullyConnected") {
+            const auto impl_type = rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            EXPECT_EQ(impl_type.find("gemm_sparse"), std::string::npos) << impl_type;
+        }
+    }
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{-1, 128}, {{1, 128}, {19, 128}, {1, 128}}},
+    {{-1, -1, 128}, {{1, 7, 128}, {2, 1, 128}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCBlockSparse,
+                         FCBlockSparseCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::Shape{64, 128}),
+                                            ::testing::Values(ov::element::f32,
+                                                              ov::element::u8,
+                                                              ov::element::i8,
+                                                              ov::element::u4,
+                                                              ov::element::i4),
+                                            ::testing::Values(8)),
+                         FCBlockSparseCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCBlockSparse_Dense,
+                         FCBlockSparseCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::Shape{64, 128}),
+                                            ::testing::Values(ov::element::f32, ov::element::u8),
+                                            ::testing::Values(2)),
+                         FCBlockSparseCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following inception-like subgraph:
+
+                         Param
+                /      /       \       \
+             Conv    Conv      Conv    Relu
+              |       |         |       |  \
+             Relu    Conv      Add      |  Add (may modify the Relu output in-place)
+              |       |         |       |   |
+               \      |        /       /    |
+                     Concat               Result
+                       |
+                     Result
+
+The main purpose of the test is to check that the concurrent execution of the independent branches
+(ENABLE_INTER_OP_PARALLEL) provides the same results as the sequential one, including the memory reuse
+between the branches and the in-place memory modifications.
+*/
+
+namespace ov {
+namespace test {
+
+using InterOpParallelParams = bool;  // enable inter-op parallelism
+
+class InterOpParallelCPUTest : public testing::WithParamInterface<InterOpParallelParams>,
+                               virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelParams>& obj) {
+        std::ostringstream result;
+        result << "InterOpParallel=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::enable_inter_op_parallel.name(), GetParam()});
+
+        const auto precision = ov::element::f32;
+        init_input_shapes({InputShape{{}, {{1, 16, 14, 14}}}});
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front())};
+
+        auto make_conv = [&](const ov::Output<ov::Node>& input, size_t kernel) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return ov::test::utils::make_convolution(input,
+                                                     precision,
+                                                     {kernel, kernel},
+                                                     {1, 1},
+                                                     {pad, pad},
+                                                     {pad, pad},
+                                                     {1, 1},
+                                                     ov::op::PadType::EXPLICIT,
+                                                     8);
+        };
+        auto add_const = std::make_shared<ov::op::v0::Constant>(precision, ov::Shape{1}, std::vector<float>({1.0f}));
+
+        auto branch_1 = std::make_shared<ov::op::v0::Relu>(make_conv(params[0], 1));
+        auto branch_2 = make_conv(make_conv(params[0], 1), 3);
+        auto branch_3 = ov::test::utils::make_eltwise(make_conv(params[0], 5), add_const, utils::EltwiseTypes::ADD);
+        auto relu = std::make_shared<ov::op::v0::Relu>(params[0]);
+        auto branch_4 = ov::test::utils::make_eltwise(relu, add_const, utils::EltwiseTypes::ADD);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::NodeVector{branch_1, branch_2, branch_3, relu}, 1);
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(concat),
+                                 std::make_shared<ov::op::v0::Result>(branch_4)};
+        function = std::make_shared<ov::Model>(results, params, "InterOpParallel");
+    }
+};
+
+TEST_P(InterOpParallelCPUTest, CompareWithRefs) {
+    run();
+}
+
+/*This test runs the following stateful subgraph:
+
+                  Param
+                 /     \
+              Conv     Conv
+             /    \     |
+        Assign  Result  Conv
+                        |
+                    ReadValue (init subgraph)
+                        |
+                      Result
+
+The Assign is placed on an earlier execution level than the ReadValue, so the test checks that the ReadValue
+still reads the state of the previous inference when the levels are executed concurrently.
+*/
+
+class InterOpParallelStateCPUTest : public testing::WithParamInterface<InterOpParallelParams>,
+                                    virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelParams>& obj) {
+        std::ostringstream result;
+        result << "InterOpParallel=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::enable_inter_op_parallel.name(), GetParam()});
+
+        init_input_shapes({InputShape{{}, {tensor_shape}}});
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(net_prc, inputDynamicShapes.front())};
+
+        auto make_conv = [&](const ov::Output<ov::Node>& input) {
+            return ov::test::utils::make_convolution(input,
+                                                     net_prc,
+                                                     {1, 1},
+                                                     {1, 1},
+                                                     {0, 0},
+                                                     {0, 0},
+                                                     {1, 1},
+                                                     ov::op::PadType::EXPLICIT,
+                                                     tensor_shape[1]);
+        };
+
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{inputDynamicShapes.front(), net_prc, "variable0"});
+        auto read = std::make_shared<ov::op::v6::ReadValue>(make_conv(make_conv(params[0])), variable);
+        auto state = make_conv(params[0]);
+        auto assign = std::make_shared<ov::op::v6::Assign>(state, variable);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(read),
+                                 std::make_shared<ov::op::v0::Result>(state)};
+        function = std::make_shared<ov::Model>(results, ov::SinkVector{assign}, params, "InterOpParallelState");
+    }
+
+    const ov::Shape tensor_shape = {1, 8, 7, 7};
+    const ElementType net_prc = element::f32;
+};
+
+TEST_P(InterOpParallelStateCPUTest, CompareWithRefs) {
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+    ASSERT_TRUE(inferRequest);
+
+    auto compiledReferenceModel = core->compile_model(function, ov::test::utils::DEVICE_TEMPLATE);
+    auto inferRequestRef = compiledReferenceModel.create_infer_request();
+    ASSERT_TRUE(inferRequestRef);
+
+    constexpr int infer_count = 3;
+    for (int i = 0; i < infer_count; ++i) {
+        // a new input every iteration, so the state read back differs from the one being assigned
+        using ov::test::utils::InputGenerateData;
+        auto input =
+            ov::test::utils::create_and_fill_tensor(net_prc, tensor_shape, InputGenerateData{-5, 10, 1, i + 1});
+        inferRequest.set_tensor(function->inputs().front(), input);
+        inferRequestRef.set_tensor(function->inputs().front(), input);
+
+        inferRequest.infer();
+        inferRequestRef.infer();
+
+        for (const auto& output : function->outputs()) {
+            ov::test::utils::compare(inferRequest.get_tensor(output), inferRequestRef.get_tensor(output), 1e-4, 1e-4);
+        }
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallel,
+                         InterOpParallelCPUTest,
+                         ::testing::Values(true, false),
+                         InterOpParallelCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallelState,
+                         InterOpParallelStateCPUTest,
+                         ::testing::Values(true, false),
+                         InterOpParallelStateCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the LM head of a language model with ENABLE_LM_HEAD_SLICING:
+
+        Param(hidden_states)       ReadValue
+              |          \             |
+              |           \---------Concat
+              |                        |
+           MatMul(vocab)             Assign
+              |
+        Result("logits")
+
+The stateful model generates the tokens, so only the logits of the last prompt token are computed. The state is
+optional: a stateless model may need the logits of all the tokens (e.g. to score the prompt), so they are kept.
+*/
+
+namespace ov {
+namespace test {
+
+using LMHeadSlicingParams = bool;  // stateful model
+
+class LMHeadSlicingCPUTest : public testing::WithParamInterface<LMHeadSlicingParams>,
+                             virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LMHeadSlicingParams>& obj) {
+        std::ostringstream result;
+        result << "Stateful=" << obj.param;
+        return result.str();
+    }
+
+    static constexpr size_t hidden_size = 16;
+    static constexpr size_t vocab_size = 64;
+    static constexpr size_t prompt_len = 5;
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const auto precision = ov::element::f32;
+        const ov::PartialShape hidden_shape{1, -1, static_cast<int64_t>(hidden_size)};
+        auto hidden_states = std::make_shared<ov::op::v0::Parameter>(precision, hidden_shape);
+
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 32;
+        auto weights_tensor =
+            ov::test::utils::create_and_fill_tensor(precision, ov::Shape{hidden_size, vocab_size}, in_data);
+        auto weights = std::make_shared<ov::op::v0::Constant>(weights_tensor);
+        auto logits = std::make_shared<ov::op::v0::MatMul>(hidden_states, weights);
+        logits->output(0).set_names({"logits"});
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(logits)};
+        ov::SinkVector sinks;
+        if (GetParam()) {
+            auto variable = std::make_shared<ov::op::util::Variable>(
+                ov::op::util::VariableInfo{hidden_shape, precision, "past_hidden_states"});
+            auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+            auto present = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, hidden_states}, 1);
+            sinks.push_back(std::make_shared<ov::op::v6::Assign>(present, variable));
+        }
+        function = std::make_shared<ov::Model>(results, sinks, ov::ParameterVector{hidden_states}, "LMHead");
+    }
+
+    ov::Tensor infer(bool enable_lm_head_slicing, const ov::Tensor& hidden_states) {
+        configuration[ov::intel_cpu::enable_lm_head_slicing.name()] = enable_lm_head_slicing;
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(hidden_states);
+        inferRequest.infer();
+        auto output = inferRequest.get_output_tensor();
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+};
+
+TEST_P(LMHeadSlicingCPUTest, CompareWithRefs) {
+    ov::test::utils::InputGenerateData in_data;
+    in_data.start_from = -1;
+    in_data.range = 2;
+    in_data.resolution = 32;
+    auto hidden_states =
+        ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, prompt_len, hidden_size}, in_data);
+
+    auto full_logits = infer(false, hidden_states);
+    ASSERT_EQ(ov::Shape({1, prompt_len, vocab_size}), full_logits.get_shape());
+
+    auto logits = infer(true, hidden_states);
+    if (GetParam()) {
+        // the logits of the last prompt token only
+        ASSERT_EQ(ov::Shape({1, 1, vocab_size}), logits.get_shape());
+        ov::Tensor last_logits{ov::element::f32, ov::Shape{1, 1, vocab_size}};
+        std::memcpy(last_logits.data(),
+                    full_logits.data<float>() + (prompt_len - 1) * vocab_size,
+                    last_logits.get_byte_size());
+        ov::test::utils::compare(last_logits, logits, abs_threshold, rel_threshold);
+    } else {
+        ASSERT_EQ(full_logits.get_shape(), logits.get_shape());
+        ov::test::utils::compare(full_logits, logits, abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_LMHeadSlicing,
+                         LMHeadSlicingCPUTest,
+                         ::testing::Values(true, false),
+                         LMHeadSlicingCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
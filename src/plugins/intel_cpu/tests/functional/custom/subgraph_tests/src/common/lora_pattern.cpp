@@ -9,6 +9,7 @@
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -282,6 +283,68 @@ protected:
     static constexpr size_t num_channels = 64ul;
 };
 
+class LoraPatternMultiAdapterCPUTest : public LoraPatternBaseCPUTest {
+protected:
+    void init_function() override {
+        ov::PartialShape shape_x = {-1, -1, K};
+        ov::PartialShape shape_w = {N, K};
+
+        auto param_y = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_y, param_w, false, true);
+
+        // stacked LoRA adapters from states, the adapter of each batch row is selected by the indices
+        const std::vector<ov::PartialShape> shapes =
+            transpose_adapters ? std::vector<ov::PartialShape>{{-1, N, -1}, {-1, 1, -1}, {-1, -1, K}}
+                               : std::vector<ov::PartialShape>{{-1, -1, N}, {-1, 1, -1}, {-1, K, -1}};
+        auto states = create_states(shapes, {t4_name, t5_name, t6_name});
+        ov::OutputVector adapters;
+        for (const auto& state : states.first) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            adapters.push_back(std::make_shared<ov::op::v8::Gather>(state, param_indices, axis));
+        }
+
+        auto t5810 = std::make_shared<ov::op::v0::MatMul>(param_y, adapters[2], false, transpose_adapters);
+        auto t5811 = std::make_shared<ov::op::v1::Multiply>(t5810, adapters[1]);
+        auto t5812 = std::make_shared<ov::op::v0::MatMul>(t5811, adapters[0], false, transpose_adapters);
+
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, t5812);
+
+        auto result_x = std::make_shared<ov::op::v0::Result>(tx);
+        auto result_z = std::make_shared<ov::op::v0::Result>(tz);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector({result_x, result_z}),
+                                               states.second,
+                                               ov::ParameterVector({param_y, param_w, param_indices}));
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        SubgraphBaseTest::generate_inputs(targetInputStaticShapes);
+        // rows with the different adapters, the same adapter in the non-adjacent rows and the negative index
+        const auto& param_indices = function->get_parameters()[2];
+        ov::Tensor indices(ov::element::i32, targetInputStaticShapes[2]);
+        const std::vector<int32_t> values{3, 0, 3, -1};
+        for (size_t i = 0; i < indices.get_size(); ++i) {
+            indices.data<int32_t>()[i] = values[i % values.size()];
+        }
+        inputs[param_indices] = indices;
+    }
+
+    static constexpr size_t K = 563ul;
+    static constexpr size_t N = 2048ul;
+    // the adapters are stored as [num_adapters, rank, K] and [num_adapters, N, rank] when true
+    bool transpose_adapters = true;
+};
+
+class LoraPatternMultiAdapterNoTransposeCPUTest : public LoraPatternMultiAdapterCPUTest {
+public:
+    LoraPatternMultiAdapterNoTransposeCPUTest() {
+        transpose_adapters = false;
+    }
+};
+
 TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     targetStaticShapes = {{{{1, 20, K}}, {{N, K}}}};
     run_test();
@@ -289,6 +352,13 @@ TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
 }
 
+TEST_P(LoraPatternMultiAdapterNoTransposeCPUTest, CompareWithRefs) {
+    targetStaticShapes = {{{{4, 20, K}}, {{N, K}}, {{4}}}};
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+}
+
 TEST_P(LoraPatternConvolutionCPUTest, CompareWithRefs) {
     targetStaticShapes = {{{1, num_channels, 10, 15}}};
     run_test();
@@ -296,6 +366,20 @@ TEST_P(LoraPatternConvolutionCPUTest, CompareWithRefs) {
     CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 0);
 }
 
+TEST_P(LoraPatternMultiAdapterCPUTest, CompareWithRefs) {
+    targetStaticShapes = {{{{4, 20, K}}, {{N, K}}, {{4}}}};
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+}
+
+TEST_P(LoraPatternMultiAdapterNoTransposeCPUTest, CompareWithRefs) {
+    targetStaticShapes = {{{{4, 20, K}}, {{N, K}}, {{4}}}};
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+}
+
 const ov::element::TypeVector states_precisions {ov::element::f32, ov::element::f16};
 const std::vector<StatesPolicy> states_policies {StatesPolicy::EMPTY_TENSORS, StatesPolicy::RANDOM_TENSORS};
 
@@ -311,5 +395,17 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPU
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_LoRA_CPU_MultiAdapter, LoraPatternMultiAdapterCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(states_precisions),
+                                 ::testing::Values(StatesPolicy::RANDOM_TENSORS)),
+                         LoraPatternBaseCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoRA_CPU_MultiAdapterNoTranspose, LoraPatternMultiAdapterNoTransposeCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(states_precisions),
+                                 ::testing::Values(StatesPolicy::RANDOM_TENSORS)),
+                         LoraPatternBaseCPUTest::getTestCaseName);
+
 }  // namespace test
 }  // namespace ov
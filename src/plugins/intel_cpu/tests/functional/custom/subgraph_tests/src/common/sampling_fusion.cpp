@@ -0,0 +1,225 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <map>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using SamplingFusionTestParams = std::tuple<InputShape,  // logits shape
+                                            float,       // temperature, 0 - no scaling
+                                            size_t>;     // top_k, 0 - no TopK
+
+class SamplingFusionCPUTest : public testing::WithParamInterface<SamplingFusionTestParams>,
+                              virtual public SubgraphBaseTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SamplingFusionTestParams>& obj) {
+        const auto& [input_shape, temperature, top_k] = obj.param;
+        std::ostringstream results;
+        results << "IS=" << ov::test::utils::partialShape2str({input_shape.first}) << "_TS=(";
+        for (const auto& item : input_shape.second) {
+            results << ov::test::utils::vec2str(item) << "_";
+        }
+        results << ")_temperature=" << temperature << "_top_k=" << top_k;
+        return results.str();
+    }
+
+    // every row has a single dominating logit, so the sampled token does not depend on the random generator
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& model_inputs = function->inputs();
+        const auto& shape = targetInputStaticShapes[0];
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = 0;
+        in_data.range = 1;
+        in_data.resolution = 1000;
+        auto logits = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, in_data);
+        auto* data = logits.data<float>();
+        for (size_t b = 0; b < shape[0]; b++) {
+            data[b * shape[1] + (b * 7919 + 13) % shape[1]] = 100.0f;
+        }
+        inputs.insert({model_inputs[0].get_node_shared_ptr(), logits});
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [input_shape, temperature, top_k] = this->GetParam();
+        init_input_shapes({input_shape});
+
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        ov::Output<ov::Node> scores = logits;
+        std::shared_ptr<ov::op::v11::TopK> topk;
+        if (top_k > 0) {
+            auto k = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {top_k});
+            topk = std::make_shared<ov::op::v11::TopK>(logits,
+                                                       k,
+                                                       1,
+                                                       ov::op::TopKMode::MAX,
+                                                       ov::op::TopKSortType::SORT_VALUES,
+                                                       ov::element::i32);
+            scores = topk->output(0);
+        }
+        if (temperature > 0) {
+            auto temperature_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {temperature});
+            scores = std::make_shared<ov::op::v1::Divide>(scores, temperature_const);
+        }
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(scores, -1);
+        auto num_samples = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+        ov::Output<ov::Node> ids =
+            std::make_shared<ov::op::v13::Multinomial>(softmax, num_samples, ov::element::i32, true, false, 1, 2);
+        if (topk) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {1});
+            ids = std::make_shared<ov::op::v8::Gather>(topk->output(1), ids, axis, 1);
+        }
+        function = std::make_shared<ov::Model>(ov::OutputVector{ids}, ov::ParameterVector{logits}, "Sampling");
+    }
+};
+
+TEST_P(SamplingFusionCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Sampling", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Multinomial", 0);
+    CheckNumberOfNodesWithType(compiledModel, "TopK", 0);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{-1, 1000}, {{1, 1000}, {4, 1000}, {1, 1000}}},
+    {{}, {{3, 32000}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SamplingFusion,
+                         SamplingFusionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(0.f, 0.7f),
+                                            ::testing::Values(0, 40)),
+                         SamplingFusionCPUTest::getTestCaseName);
+
+}  // namespace
+// The nucleus (top-p) filtering has no standard-op pattern, so the node is created with the attribute. Every row of
+// the batch samples its own random value, the frequencies of the sampled ids give the filtered distribution.
+struct SamplingTopPTestParams {
+    size_t vocab;
+    // the probabilities of the most probable tokens, the rest of the mass is shared evenly by the other tokens
+    std::map<size_t, float> probs;
+    size_t top_k;
+    float top_p;
+    // the expected distribution of the sampled ids
+    std::map<size_t, float> expected;
+};
+
+class SamplingTopPCPUTest : public testing::WithParamInterface<SamplingTopPTestParams>,
+                            virtual public SubgraphBaseTest,
+                            public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SamplingTopPTestParams>& obj) {
+        std::ostringstream results;
+        results << "vocab=" << obj.param.vocab << "_top_k=" << obj.param.top_k << "_top_p=" << obj.param.top_p;
+        return results.str();
+    }
+
+    static constexpr size_t batch = 4096;
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& param = this->GetParam();
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, param.vocab});
+        intel_cpu::SamplingNode::Config config;
+        config.top_k = param.top_k;
+        config.top_p = param.top_p;
+        config.global_seed = 1;
+        config.op_seed = 2;
+        auto sampling = std::make_shared<intel_cpu::SamplingNode>(logits, config);
+        function = std::make_shared<ov::Model>(ov::OutputVector{sampling}, ov::ParameterVector{logits}, "Sampling");
+    }
+
+    // the logits of every row are the logarithms of the probabilities
+    ov::Tensor make_logits() const {
+        const auto& param = this->GetParam();
+        float rest_mass = 1.0f;
+        for (const auto& [id, prob] : param.probs) {
+            rest_mass -= prob;
+        }
+        const auto rest_count = static_cast<float>(param.vocab - param.probs.size());
+        std::vector<float> row(param.vocab, std::log(rest_mass / rest_count));
+        for (const auto& [id, prob] : param.probs) {
+            row[id] = std::log(prob);
+        }
+        ov::Tensor logits(ov::element::f32, ov::Shape{batch, param.vocab});
+        for (size_t b = 0; b < batch; b++) {
+            std::copy(row.begin(), row.end(), logits.data<float>() + b * param.vocab);
+        }
+        return logits;
+    }
+};
+
+TEST_P(SamplingTopPCPUTest, CheckDistribution) {
+    const auto& param = this->GetParam();
+    compile_model();
+    CheckNumberOfNodesWithType(compiledModel, "Sampling", 1);
+    inferRequest = compiledModel.create_infer_request();
+    inferRequest.set_input_tensor(make_logits());
+    inferRequest.infer();
+    auto ids = inferRequest.get_output_tensor();
+    ASSERT_EQ(ov::Shape({batch, 1}), ids.get_shape());
+
+    std::map<size_t, size_t> counts;
+    for (size_t b = 0; b < batch; b++) {
+        const auto id = static_cast<size_t>(ids.data<int64_t>()[b]);
+        ASSERT_EQ(1u, param.expected.count(id)) << "the token " << id << " is out of the nucleus";
+        counts[id]++;
+    }
+    // 6 standard deviations of the frequency at most, the binomial deviation is not more than 0.5 / sqrt(batch)
+    const float tolerance = 3.0f / std::sqrt(static_cast<float>(batch));
+    for (const auto& [id, prob] : param.expected) {
+        EXPECT_NEAR(prob, static_cast<float>(counts[id]) / batch, tolerance) << "the token " << id;
+    }
+}
+
+namespace {
+
+std::map<size_t, float> uniform(size_t count, float mass) {
+    std::map<size_t, float> probs;
+    for (size_t id = 0; id < count; id++) {
+        probs[id] = mass / static_cast<float>(count);
+    }
+    return probs;
+}
+
+const std::vector<SamplingTopPTestParams> topPParams = {
+    // the nucleus 0.4 + 0.3 + 0.2 >= 0.85 is renormalized
+    {1000, {{17, 0.4f}, {503, 0.3f}, {250, 0.2f}}, 0, 0.85f, {{17, 4.f / 9}, {503, 3.f / 9}, {250, 2.f / 9}}},
+    // the most probable token covers 0.5 of the renormalized top 2 tokens
+    {1000, {{17, 0.4f}, {503, 0.3f}, {250, 0.2f}}, 2, 0.5f, {{17, 1.f}}},
+    // the nucleus of 800 equal tokens is longer than the first sorted prefix, the ties are taken in the id order
+    {2048, uniform(1000, 0.5f), 0, 0.39975f, uniform(800, 1.f)},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SamplingTopP,
+                         SamplingTopPCPUTest,
+                         ::testing::ValuesIn(topPParams),
+                         SamplingTopPCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/topk.hpp"
+
+namespace ov {
+namespace test {
+
+struct MoEFusionParams {
+    ov::test::InputShape inputShape;
+    size_t hidden_size;
+    size_t up_size;
+    size_t num_experts;
+    size_t top_k;
+    bool normalize_topk;
+};
+
+// The dense mixture of experts, where every expert MLP runs on all the tokens and is multiplied by its routing
+// weight, is fused into a single MoE node, the reference runs the decomposed subgraph
+class MoEFusionTest : public testing::WithParamInterface<MoEFusionParams>, public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MoEFusionParams>& obj) {
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({obj.param.inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : obj.param.inputShape.second) {
+            result << ov::test::utils::vec2str(shape);
+            result << "_";
+        }
+        result << "hidden_size=" << obj.param.hidden_size << "_";
+        result << "up_size=" << obj.param.up_size << "_";
+        result << "num_experts=" << obj.param.num_experts << "_";
+        result << "top_k=" << obj.param.top_k << "_";
+        result << "normalize_topk=" << obj.param.normalize_topk << "_";
+        result << obj.index;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        auto& param = this->GetParam();
+
+        configuration[ov::hint::inference_precision.name()] = "bf16";
+
+        auto logits_shape = param.inputShape;
+        logits_shape.first[2] = static_cast<int64_t>(param.num_experts);
+        for (auto& shape : logits_shape.second) {
+            shape[2] = param.num_experts;
+        }
+        init_input_shapes({param.inputShape, logits_shape});
+
+        auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[1]);
+
+        auto probs = std::make_shared<ov::op::v8::Softmax>(logits, -1);
+        auto k = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {param.top_k});
+        auto topk = std::make_shared<ov::op::v11::TopK>(probs, k, -1, "max", "value", ov::element::i64);
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {-1});
+        ov::Output<ov::Node> values = topk->output(0);
+        if (param.normalize_topk) {
+            values =
+                std::make_shared<ov::op::v1::Divide>(values, std::make_shared<ov::op::v1::ReduceSum>(values, axis, true));
+        }
+
+        std::shared_ptr<ov::Node> output;
+        for (size_t expert_id = 0; expert_id < param.num_experts; expert_id++) {
+            auto gate_weight = create_const(param.up_size, param.hidden_size, 100);
+            auto up_weight = create_const(param.up_size, param.hidden_size, 100);
+            // down_proj has special cache blocking along K dimension requires lower weight resolution
+            auto down_weight = create_const(param.hidden_size, param.up_size, 16);
+
+            auto gate_proj = std::make_shared<ov::op::v0::MatMul>(src, gate_weight, false, true);
+            auto up_proj = std::make_shared<ov::op::v0::MatMul>(src, up_weight, false, true);
+            auto gate_act = std::make_shared<ov::op::v4::Swish>(gate_proj);
+            auto gate_up = std::make_shared<ov::op::v1::Multiply>(gate_act, up_proj);
+            auto mlp = std::make_shared<ov::op::v0::MatMul>(gate_up, down_weight, false, true);
+
+            auto id = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {expert_id});
+            auto mask = std::make_shared<ov::op::v0::Convert>(std::make_shared<ov::op::v1::Equal>(topk->output(1), id),
+                                                              ov::element::f32);
+            auto routing_weight =
+                std::make_shared<ov::op::v1::ReduceSum>(std::make_shared<ov::op::v1::Multiply>(values, mask), axis, true);
+            auto expert_out = std::make_shared<ov::op::v1::Multiply>(mlp, routing_weight);
+            output = output ? std::static_pointer_cast<ov::Node>(std::make_shared<ov::op::v1::Add>(output, expert_out))
+                            : expert_out;
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{output}, ov::ParameterVector{src, logits});
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        const auto& funcInputs = function->inputs();
+
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -0.5;
+        in_data.range = 1;
+        in_data.resolution = 128;
+        auto t_src = ov::test::utils::create_and_fill_tensor(ov::element::f32, targetInputStaticShapes[0], in_data);
+
+        // the router logits of every token are distinct and exact in bf16, so the precision of the plugin does not
+        // change the chosen experts, and the experts vary from token to token
+        const auto& logits_shape = targetInputStaticShapes[1];
+        const auto num_experts = logits_shape[2];
+        ov::Tensor t_logits = ov::Tensor(ov::element::f32, logits_shape);
+        auto* ptr = t_logits.data<float>();
+        for (size_t token = 0; token < ov::shape_size(logits_shape) / num_experts; token++) {
+            for (size_t expert = 0; expert < num_experts; expert++) {
+                ptr[token * num_experts + expert] = static_cast<float>((expert + token) % num_experts) * 0.5f;
+            }
+        }
+
+        inputs.clear();
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), t_src});
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), t_logits});
+    }
+
+    static std::shared_ptr<ov::Node> create_const(size_t OC, size_t IC, int resolution) {
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -0.5;
+        in_data.range = 1;
+        in_data.resolution = resolution;
+        auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{OC, IC}, in_data);
+        return std::make_shared<ov::op::v0::Constant>(tensor);
+    }
+
+    void check_results() {
+        auto exec_model = compiledModel.get_runtime_model();
+
+        int fused_node_found = 0;
+        int mlp_node_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "MoE")
+                fused_node_found++;
+            if (layer_type == "LLMMLP")
+                mlp_node_found++;
+        }
+        ASSERT_EQ(fused_node_found, 1);
+        ASSERT_EQ(mlp_node_found, 0);
+    }
+};
+
+TEST_P(MoEFusionTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx512_core_amx_bf16())
+        GTEST_SKIP();
+    run();
+    check_results();
+}
+
+namespace {
+
+static ov::test::InputShape ishape{ov::PartialShape{-1, -1, 512}, {ov::Shape{1, 8, 512}, ov::Shape{3, 37, 512}}};
+
+const std::vector<MoEFusionParams> moe_params = {
+    {ishape, 512, 1024, 4, 2, false},
+    {ishape, 512, 1024, 4, 2, true},
+    {ishape, 512, 1024, 8, 1, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MoEFusion,
+                         MoEFusionTest,
+                         ::testing::ValuesIn(moe_params),
+                         MoEFusionTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
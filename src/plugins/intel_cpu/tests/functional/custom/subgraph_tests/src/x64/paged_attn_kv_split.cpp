@@ -0,0 +1,254 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#include "common_test_utils/include/common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+using namespace ov::op;
+
+namespace ov {
+namespace test {
+
+// The long decode item of a mixed batch is split along the kv length (flash decoding) and merged by the log-sum-exp
+// of the parts. The scores output needs the whole softmax of the item, so the same batch is not split when the scores
+// are requested, which gives the unsplit reference computed by the same kernels.
+class PagedAttnKVSplitTest : public testing::WithParamInterface<ElementType>,
+                             virtual public ov::test::SubgraphBaseTest,
+                             public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ElementType>& obj) {
+        std::ostringstream result;
+        result << "Prc=" << obj.param;
+        return result.str();
+    }
+
+    static constexpr int64_t head_num = 1;
+    static constexpr int64_t head_size = 64;
+    static constexpr size_t block_size = 32;
+    // kv length of the decoded sequence, the prompt of the other sequence of the batch is short
+    static constexpr size_t long_kv_len = 4096;
+    static constexpr size_t prompt_len = 16;
+
+    static std::shared_ptr<ov::op::v0::Parameter> make_param(const PartialShape& pshape,
+                                                             element::Type element_type,
+                                                             const std::string& name) {
+        auto param = std::make_shared<v0::Parameter>(element_type, pshape);
+        param->set_friendly_name(name);
+        param->get_output_tensor(0).set_names({name});
+        return param;
+    }
+
+    static std::shared_ptr<ov::Model> get_model(ov::element::Type data_type, bool output_score) {
+        auto q = make_param(PartialShape{ov::Dimension::dynamic(), head_num * head_size}, data_type, "q");
+        auto k = make_param(PartialShape{ov::Dimension::dynamic(), head_num * head_size}, data_type, "k");
+        auto v = make_param(PartialShape{ov::Dimension::dynamic(), head_num * head_size}, data_type, "v");
+        auto key_cache = make_param(PartialShape{ov::Dimension::dynamic(), 32, ov::Dimension::dynamic()},
+                                    ov::element::dynamic,
+                                    "key_cache.0");
+        auto value_cache = make_param(PartialShape{ov::Dimension::dynamic(), 32, ov::Dimension::dynamic()},
+                                      ov::element::dynamic,
+                                      "value_cache.0");
+        auto past_lens = make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "past_lens");
+        auto subsequence_begins =
+            make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "subsequence_begins");
+        auto block_indices = make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "block_indices");
+        auto block_indices_begins =
+            make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "block_indices_begins");
+        float scale_value = 1.0 / std::sqrt(head_size);
+        auto scale =
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{}, std::vector<float>{scale_value});
+        auto silding_windows =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{0});
+        auto alibi_slopes = std::make_shared<ov::op::v0::Constant>(ov::element::f32, Shape{0}, std::vector<float>{});
+        auto max_context_len = std::make_shared<ov::op::v0::Constant>(ov::element::i32,
+                                                                      Shape{},
+                                                                      std::vector<int32_t>{long_kv_len});
+        auto score_aggregation_window =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{1});
+        auto rotated_block_indices =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{0}, std::vector<int32_t>{});
+        auto rotation_deltas =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{0}, std::vector<int32_t>{});
+        auto rotation_trig_lut =
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, Shape{0}, std::vector<float>{});
+        auto xattention_threshold =
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, Shape{0}, std::vector<float>{});
+        auto xattention_block_size =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{0});
+        auto xattention_stride =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{0});
+        ParameterVector params =
+            {q, k, v, key_cache, value_cache, past_lens, subsequence_begins, block_indices, block_indices_begins};
+        auto paged_attn = std::make_shared<op::PagedAttentionExtension>(OutputVector{q,
+                                                                                     k,
+                                                                                     v,
+                                                                                     key_cache,
+                                                                                     value_cache,
+                                                                                     past_lens,
+                                                                                     subsequence_begins,
+                                                                                     block_indices,
+                                                                                     block_indices_begins,
+                                                                                     scale,
+                                                                                     silding_windows,
+                                                                                     alibi_slopes,
+                                                                                     max_context_len,
+                                                                                     score_aggregation_window,
+                                                                                     rotated_block_indices,
+                                                                                     rotation_deltas,
+                                                                                     rotation_trig_lut,
+                                                                                     xattention_threshold,
+                                                                                     xattention_block_size,
+                                                                                     xattention_stride});
+        paged_attn->get_rt_info()["num_k_heads"] = head_num;
+        paged_attn->get_rt_info()["k_head_size"] = head_size;
+        paged_attn->get_rt_info()["num_v_heads"] = head_num;
+        paged_attn->get_rt_info()["v_head_size"] = head_size;
+        OutputVector outputs{paged_attn};
+        if (output_score) {
+            outputs.push_back(paged_attn->output(1));
+        }
+        return std::make_shared<ov::Model>(outputs, params);
+    }
+
+    static ov::Tensor create_i32_tensor(const std::vector<int32_t>& values) {
+        ov::Tensor tensor(ov::element::i32, ov::Shape{values.size()});
+        std::copy(values.begin(), values.end(), tensor.data<int32_t>());
+        return tensor;
+    }
+
+    void SetUp() override {
+        const auto inType = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        rel_threshold = 1e-3f;
+        abs_threshold = 1e-4f;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        if (inType == ElementType::bf16) {
+            configuration[ov::hint::inference_precision.name()] = ov::element::bf16;
+            rel_threshold = 0.01f;
+            abs_threshold = 0.01f;
+        }
+
+        // the prompt of the long sequence, then its decode token followed by the prompt of the other sequence
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 128;
+        const auto tokens = long_kv_len + prompt_len;
+        for (int i = 0; i < 3; i++) {
+            in_data.seed = i + 1;
+            qkv.push_back(ov::test::utils::create_and_fill_tensor(inType,
+                                                                  ov::Shape{tokens, head_num * head_size},
+                                                                  in_data));
+        }
+    }
+
+    // runs the prompt of the long sequence and then the mixed batch, returns the output of the batch
+    ov::Tensor run_test(bool output_score) {
+        const auto inType = this->GetParam();
+        function = get_model(inType, output_score);
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+
+        const auto threads = compiledModel.get_property(ov::inference_num_threads);
+        // the single head decode item outweighs the average thread load with 2 threads and more
+        if (threads < 2) {
+            return {};
+        }
+
+        const size_t long_blocks = long_kv_len / block_size;
+        ov::Tensor key_cache, value_cache;
+        for (const auto& input : compiledModel.inputs()) {
+            for (auto& name : input.get_names()) {
+                ov::PartialShape pshape = input.get_partial_shape();
+                pshape[0] = long_blocks + 1;
+                if (name.find("key_cache.") == 0) {
+                    key_cache = ov::Tensor(input.get_element_type(), pshape.get_shape());
+                    std::memset(key_cache.data(), 0, key_cache.get_byte_size());
+                    break;
+                } else if (name.find("value_cache.") == 0) {
+                    value_cache = ov::Tensor(input.get_element_type(), pshape.get_shape());
+                    std::memset(value_cache.data(), 0, value_cache.get_byte_size());
+                    break;
+                }
+            }
+        }
+
+        auto infer = [&](size_t token_beg,
+                         size_t token_cnt,
+                         const std::vector<int32_t>& past_lens,
+                         const std::vector<int32_t>& subsequence_begins,
+                         const std::vector<int32_t>& block_indices,
+                         const std::vector<int32_t>& block_indices_begins) {
+            const auto& params = function->get_parameters();
+            for (size_t i = 0; i < 3; i++) {
+                const auto row_size = qkv[i].get_byte_size() / qkv[i].get_shape()[0];
+                ov::Tensor rows(qkv[i].get_element_type(), ov::Shape{token_cnt, qkv[i].get_shape()[1]});
+                std::memcpy(rows.data(),
+                            static_cast<uint8_t*>(qkv[i].data()) + token_beg * row_size,
+                            rows.get_byte_size());
+                inferRequest.set_tensor(params[i], rows);
+            }
+            inferRequest.set_tensor(params[3], key_cache);
+            inferRequest.set_tensor(params[4], value_cache);
+            inferRequest.set_tensor(params[5], create_i32_tensor(past_lens));
+            inferRequest.set_tensor(params[6], create_i32_tensor(subsequence_begins));
+            inferRequest.set_tensor(params[7], create_i32_tensor(block_indices));
+            inferRequest.set_tensor(params[8], create_i32_tensor(block_indices_begins));
+            inferRequest.infer();
+        };
+
+        std::vector<int32_t> long_block_indices(long_blocks);
+        std::iota(long_block_indices.begin(), long_block_indices.end(), 0);
+        const auto long_prompt_len = static_cast<int32_t>(long_kv_len - 1);
+        infer(0, long_kv_len - 1, {0}, {0, long_prompt_len}, long_block_indices, {0, static_cast<int32_t>(long_blocks)});
+
+        auto batch_block_indices = long_block_indices;
+        batch_block_indices.push_back(static_cast<int32_t>(long_blocks));
+        infer(long_kv_len - 1,
+              1 + prompt_len,
+              {long_prompt_len, 0},
+              {0, 1, static_cast<int32_t>(1 + prompt_len)},
+              batch_block_indices,
+              {0, static_cast<int32_t>(long_blocks), static_cast<int32_t>(long_blocks + 1)});
+
+        auto output = inferRequest.get_output_tensor(0);
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+
+    std::vector<ov::Tensor> qkv;
+};
+
+TEST_P(PagedAttnKVSplitTest, CompareWithUnsplit) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    if (this->GetParam() == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    auto split_output = run_test(false);
+    if (!split_output)
+        GTEST_SKIP() << "a single thread does not split the decode";
+    auto unsplit_output = run_test(true);
+    ov::test::utils::compare(unsplit_output, split_output, abs_threshold, rel_threshold);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnKVSplitTest,
+                         PagedAttnKVSplitTest,
+                         ::testing::Values(ElementType::f32, ElementType::bf16),
+                         PagedAttnKVSplitTest::getTestCaseName);
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
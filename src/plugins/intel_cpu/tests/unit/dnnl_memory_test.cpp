@@ -78,6 +78,33 @@ TEST(MemoryTest, ConcurrentResizeGetPrimitive) {
     }
 }
 
+TEST(MemoryTest, GrowableMemoryBlockKeepsData) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    // the block bound to the NUMA node keeps the data the same way
+    for (int numa_node : {-1, 0}) {
+        auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<GrowableMemoryBlock>(numa_node));
+        Memory cpu_mem(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16, 8}), block);
+        auto dnnl_mem = cpu_mem.getPrimitive();
+        size_t size = 16 * 8;
+        for (size_t i = 0; i < size; i++) {
+            cpu_mem.getDataAs<float>()[i] = static_cast<float>(i);
+        }
+        // grow along the outermost axis several times, the stored values are kept
+        for (size_t rows : {64, 1024, 65536}) {
+            cpu_mem.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{rows, 8}));
+            auto* data = cpu_mem.getDataAs<float>();
+            for (size_t i = 0; i < size; i++) {
+                ASSERT_EQ(data[i], static_cast<float>(i));
+            }
+            for (size_t i = size; i < rows * 8; i++) {
+                data[i] = static_cast<float>(i);
+            }
+            size = rows * 8;
+        }
+        ASSERT_EQ(cpu_mem.getPrimitive().get_data_handle(), cpu_mem.getData());
+    }
+}
+
 TEST(StaticMemoryTest, UnsupportedDnnlPrecision) {
     // in the context of this test, unsupported precision means a precision unsupported by oneDNN
     const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
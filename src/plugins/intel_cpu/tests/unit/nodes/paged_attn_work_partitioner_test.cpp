@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/paged_attn_work_partitioner.hpp"
+
+using namespace ov::Extensions::Cpu;
+
+namespace {
+
+constexpr size_t block_size = 32;
+
+// Work item costs of a continuous batch in the same order as WorkItems builds them
+std::vector<float> make_batch_costs(const std::vector<size_t>& prefill_lens, const std::vector<size_t>& decode_kv_lens) {
+    std::vector<float> costs;
+    for (auto q_len : prefill_lens) {
+        for (size_t q_beg = 0; q_beg < q_len; q_beg += block_size) {
+            const auto q_cnt = std::min(block_size, q_len - q_beg);
+            costs.push_back(PagedAttnWorkPartitioner::cost(q_cnt, q_beg + q_cnt));
+        }
+    }
+    for (auto kv_len : decode_kv_lens) {
+        costs.push_back(PagedAttnWorkPartitioner::cost(1, kv_len));
+    }
+    return costs;
+}
+
+// Max thread load of the dynamic scheduling of the (item, head) units in the given item order: every unit is picked by
+// the thread which becomes free first, as the loop over the units does when the costs are accurate
+float dynamic_max_load(const std::vector<float>& costs,
+                       const std::vector<int32_t>& order,
+                       size_t units_per_item,
+                       size_t nthr) {
+    std::vector<float> loads(nthr, 0.0F);
+    for (auto item : order) {
+        for (size_t unit = 0; unit < units_per_item; unit++) {
+            *std::min_element(loads.begin(), loads.end()) += costs[item];
+        }
+    }
+    return *std::max_element(loads.begin(), loads.end());
+}
+
+std::vector<int32_t> batch_order(size_t count) {
+    std::vector<int32_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    return order;
+}
+
+float lower_bound_load(const std::vector<float>& costs, size_t units_per_item, size_t nthr) {
+    const auto total = std::accumulate(costs.begin(), costs.end(), 0.0F) * static_cast<float>(units_per_item);
+    return std::max(total / static_cast<float>(nthr), *std::max_element(costs.begin(), costs.end()));
+}
+
+}  // namespace
+
+TEST(PagedAttnWorkPartitionerTest, OrdersEveryItemOnce) {
+    const auto costs = make_batch_costs({100, 7}, {1, 300, 5000});
+    PagedAttnWorkPartitioner partitioner;
+    partitioner.reset(costs);
+
+    auto order = partitioner.get_order();
+    ASSERT_EQ(order.size(), costs.size());
+    for (size_t i = 1; i < order.size(); i++) {
+        EXPECT_GE(costs[order[i - 1]], costs[order[i]]);
+    }
+    std::sort(order.begin(), order.end());
+    EXPECT_EQ(order, batch_order(costs.size()));
+}
+
+TEST(PagedAttnWorkPartitionerTest, KeepsOrderOfUniformBatch) {
+    const auto costs = make_batch_costs({}, std::vector<size_t>(16, 300));
+    PagedAttnWorkPartitioner partitioner;
+    partitioner.reset(costs);
+    EXPECT_EQ(partitioner.get_order(), batch_order(costs.size()));
+}
+
+TEST(PagedAttnWorkPartitionerTest, DecodeCostsMoreThanPrefillPair) {
+    EXPECT_GT(PagedAttnWorkPartitioner::cost(1, 1024), PagedAttnWorkPartitioner::cost(1, 512));
+    EXPECT_GT(PagedAttnWorkPartitioner::cost(block_size, 1024), PagedAttnWorkPartitioner::cost(1, 1024));
+    EXPECT_LT(PagedAttnWorkPartitioner::cost(block_size, 1024), PagedAttnWorkPartitioner::cost(1, block_size * 1024));
+}
+
+// Synthetic continuous batches: long prompts prefilled together with many short and long decode sequences
+TEST(PagedAttnWorkPartitionerTest, BalancesMixedBatches) {
+    struct Batch {
+        std::vector<size_t> prefill_lens;
+        std::vector<size_t> decode_kv_lens;
+        size_t heads;
+        size_t nthr;
+    };
+    std::vector<size_t> short_decodes(60, 300);
+    std::vector<size_t> mixed_decodes;
+    for (size_t i = 0; i < 100; i++) {
+        mixed_decodes.push_back(64 + (i * 977) % 8000);
+    }
+    const std::vector<Batch> batches = {
+        {{4096}, short_decodes, 8, 56},
+        {{2048, 17, 512}, mixed_decodes, 4, 112},
+        {{}, mixed_decodes, 8, 32},
+        {{8192}, {}, 2, 96},
+    };
+
+    for (const auto& batch : batches) {
+        const auto costs = make_batch_costs(batch.prefill_lens, batch.decode_kv_lens);
+        PagedAttnWorkPartitioner partitioner;
+        partitioner.reset(costs);
+
+        const auto sorted_load = dynamic_max_load(costs, partitioner.get_order(), batch.heads, batch.nthr);
+        const auto bound = lower_bound_load(costs, batch.heads, batch.nthr);
+        // the longest first list scheduling is within 4/3 of the optimum, in practice the units are small enough
+        // to be much closer
+        EXPECT_LE(sorted_load, 1.1F * bound);
+        // the same dynamic scheduling in the batch order, as the loop ran before
+        EXPECT_LE(sorted_load, dynamic_max_load(costs, batch_order(costs.size()), batch.heads, batch.nthr));
+    }
+}
+
+TEST(PagedAttnWorkPartitionerTest, SplitsLongDecodeOnly) {
+    const size_t kv_len = 32 * 1024;
+    const auto kv_blocks = kv_len / block_size;
+    // a single long decode sequence with 8 heads on 56 threads
+    const auto single_load = PagedAttnWorkPartitioner::cost(1, kv_len) * 8 / 56;
+    const auto split_blocks = PagedAttnWorkPartitioner::decode_kv_split_blocks(kv_len, block_size, single_load);
+    EXPECT_LT(split_blocks, kv_blocks);
+    EXPECT_GE(split_blocks * block_size, PagedAttnWorkPartitioner::min_kv_split_len);
+    EXPECT_LE(PagedAttnWorkPartitioner::cost(1, split_blocks * block_size), single_load);
+
+    // many sequences keep all the threads busy without the split
+    const auto batch_load = PagedAttnWorkPartitioner::cost(1, kv_len) * 8 * 64 / 56;
+    EXPECT_EQ(PagedAttnWorkPartitioner::decode_kv_split_blocks(kv_len, block_size, batch_load), kv_blocks);
+
+    // short contexts are never split below the minimal length
+    const size_t short_len = 300;
+    const auto short_load = PagedAttnWorkPartitioner::cost(1, short_len) / 56;
+    EXPECT_EQ(PagedAttnWorkPartitioner::decode_kv_split_blocks(short_len, block_size, short_load),
+              (short_len + block_size - 1) / block_size);
+}
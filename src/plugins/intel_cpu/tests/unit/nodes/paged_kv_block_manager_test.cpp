@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/paged_kv_block_manager.hpp"
+#include "openvino/core/except.hpp"
+#include "utils/plain_tensor.hpp"
+
+using namespace ov::Extensions::Cpu;
+
+namespace {
+
+std::vector<int64_t> make_tokens(size_t count, int64_t first = 0) {
+    std::vector<int64_t> tokens(count);
+    std::iota(tokens.begin(), tokens.end(), first);
+    return tokens;
+}
+
+}  // namespace
+
+TEST(PagedKVBlockManagerTest, SharesComputedPrefix) {
+    PagedKVBlockManager manager(16, 4);
+    // 2 full blocks of the common prefix and a tail
+    auto prompt = make_tokens(10);
+    EXPECT_EQ(manager.add_sequence(0, prompt), 0u);
+    manager.commit({0});
+
+    auto other = make_tokens(8);
+    other.push_back(100);
+    EXPECT_EQ(manager.add_sequence(1, other), 8u);
+    const auto& first = manager.get_block_table(0);
+    const auto& second = manager.get_block_table(1);
+    ASSERT_EQ(second.size(), 3u);
+    EXPECT_EQ(second[0], first[0]);
+    EXPECT_EQ(second[1], first[1]);
+    EXPECT_NE(second[2], first[2]);
+    EXPECT_EQ(manager.get_ref_count(first[0]), 2u);
+
+    const auto inputs = manager.get_inputs({1});
+    EXPECT_EQ(inputs.past_lens, std::vector<int32_t>({8}));
+    EXPECT_EQ(inputs.subsequence_begins, std::vector<int32_t>({0, 1}));
+    EXPECT_EQ(inputs.block_indices, second);
+    EXPECT_EQ(inputs.block_indices_begins, std::vector<int32_t>({0, 3}));
+}
+
+TEST(PagedKVBlockManagerTest, DoesNotShareDifferentPrefix) {
+    PagedKVBlockManager manager(16, 4);
+    manager.add_sequence(0, make_tokens(9));
+    manager.commit({0});
+    // the same second block after a different first one
+    auto prompt = make_tokens(9);
+    prompt[0] = 100;
+    EXPECT_EQ(manager.add_sequence(1, prompt), 0u);
+    // the whole prompt is never taken from the cache, the last token is computed
+    EXPECT_EQ(manager.add_sequence(2, make_tokens(8)), 4u);
+}
+
+TEST(PagedKVBlockManagerTest, CopiesSharedBlockOnWrite) {
+    PagedKVBlockManager manager(16, 4);
+    manager.add_sequence(0, make_tokens(6));
+    manager.commit({0});
+    manager.fork_sequence(0, 1);
+    EXPECT_EQ(manager.get_block_table(0), manager.get_block_table(1));
+
+    manager.append_tokens(0, {10});
+    manager.append_tokens(1, {20});
+    const auto copies = manager.take_copies();
+    ASSERT_EQ(copies.size(), 1u);
+    const auto& first = manager.get_block_table(0);
+    const auto& second = manager.get_block_table(1);
+    EXPECT_EQ(first[0], second[0]);
+    // the sequence writing the shared block first gets the copy
+    EXPECT_EQ(copies[0].src, second[1]);
+    EXPECT_EQ(copies[0].dst, first[1]);
+    EXPECT_EQ(manager.get_ref_count(first[0]), 2u);
+    EXPECT_EQ(manager.get_ref_count(first[1]), 1u);
+    EXPECT_TRUE(manager.take_copies().empty());
+
+    const auto inputs = manager.get_inputs({0, 1});
+    EXPECT_EQ(inputs.past_lens, std::vector<int32_t>({6, 6}));
+    EXPECT_EQ(inputs.subsequence_begins, std::vector<int32_t>({0, 1, 2}));
+    EXPECT_EQ(inputs.block_indices_begins, std::vector<int32_t>({0, 2, 4}));
+}
+
+TEST(PagedKVBlockManagerTest, EvictsCachedBlocks) {
+    PagedKVBlockManager manager(4, 4);
+    manager.add_sequence(0, make_tokens(9));
+    manager.commit({0});
+    manager.free_sequence(0);
+    EXPECT_EQ(manager.get_num_free_blocks(), 4u);
+
+    // the released blocks stay cached until they are needed
+    EXPECT_EQ(manager.add_sequence(1, make_tokens(9)), 8u);
+    manager.free_sequence(1);
+    EXPECT_EQ(manager.add_sequence(2, make_tokens(16, 100)), 0u);
+    EXPECT_EQ(manager.get_num_free_blocks(), 0u);
+    EXPECT_THROW(manager.add_sequence(3, make_tokens(2, 200)), ov::Exception);
+    manager.free_sequence(2);
+    EXPECT_EQ(manager.add_sequence(3, make_tokens(9)), 0u);
+}
+
+TEST(PagedKVBlockManagerTest, CommitsScheduledSequencesOnly) {
+    PagedKVBlockManager manager(16, 4);
+    manager.add_sequence(0, make_tokens(9));
+    manager.add_sequence(1, make_tokens(9, 100));
+    // the step executes the first sequence only, the second one is postponed
+    EXPECT_EQ(manager.get_inputs({0}).past_lens, std::vector<int32_t>({0}));
+    manager.commit({0});
+
+    const auto inputs = manager.get_inputs({0, 1});
+    EXPECT_EQ(inputs.past_lens, std::vector<int32_t>({9, 0}));
+    EXPECT_EQ(inputs.subsequence_begins, std::vector<int32_t>({0, 0, 9}));
+    // the blocks of the postponed sequence are not computed, so they are not shared
+    EXPECT_EQ(manager.add_sequence(2, make_tokens(9)), 8u);
+    EXPECT_EQ(manager.add_sequence(3, make_tokens(9, 100)), 0u);
+
+    manager.commit({1});
+    EXPECT_EQ(manager.get_inputs({1}).past_lens, std::vector<int32_t>({9}));
+    EXPECT_EQ(manager.add_sequence(4, make_tokens(9, 100)), 8u);
+}
+
+TEST(PagedKVBlockManagerTest, CopyBlocks) {
+    // [block_number, H, block_size, S]
+    std::vector<float> key(4 * 2 * 4 * 8), value(4 * 2 * 4 * 8);
+    std::iota(key.begin(), key.end(), 0.0f);
+    std::iota(value.begin(), value.end(), 1000.0f);
+    ov::intel_cpu::PlainTensor key_cache, value_cache;
+    key_cache.resize<float>({4, 2, 4, 8}, key.data());
+    value_cache.resize<float>({4, 2, 4, 8}, value.data());
+
+    copy_blocks(key_cache, value_cache, {{1, 3}});
+    for (size_t i = 0; i < 2 * 4 * 8; i++) {
+        EXPECT_EQ(*(key_cache.ptr<float>(3) + i), *(key_cache.ptr<float>(1) + i));
+        EXPECT_EQ(*(value_cache.ptr<float>(3) + i), *(value_cache.ptr<float>(1) + i));
+    }
+    EXPECT_EQ(*key_cache.ptr<float>(2), 2.0f * 2 * 4 * 8);
+}
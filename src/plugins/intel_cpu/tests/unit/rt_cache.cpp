@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
@@ -380,3 +381,103 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, Capacity) {
+    constexpr int capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    ASSERT_EQ(cache.getCapacity(), static_cast<size_t>(capacity));
+
+    for (int i = 0; i < 10 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    int cached = 0;
+    for (int i = 0; i < 10 * capacity; ++i) {
+        cached += cache.get({i}) == int() ? 0 : 1;
+    }
+    ASSERT_LE(cached, capacity);
+    ASSERT_EQ(cache.getEvictions(), static_cast<size_t>(10 * capacity - cached));
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(MultiCacheTests, Statistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i}, intBuilder).first, IntValueType());
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i}, intBuilder).first, IntValueType());
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.size(), 1);
+    ASSERT_EQ(statistics.begin()->first, "IntKey");
+    ASSERT_EQ(statistics.begin()->second.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(statistics.begin()->second.misses, static_cast<size_t>(2 * capacity));
+    ASSERT_EQ(statistics.begin()->second.evictions, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SmokeThreadSafeSharedCache) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 100;
+    constexpr int numKeys = 10;
+    constexpr size_t numThreads = 30;
+    constexpr int iterations = 100;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int iter = 0; iter < iterations; ++iter) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.size(), 2);
+    for (const auto& [name, entryStatistics] : statistics) {
+        ASSERT_EQ(entryStatistics.hits + entryStatistics.misses, numThreads * iterations * numKeys) << name;
+        // the records are never evicted, so each key is built at most once per thread racing for it
+        ASSERT_LE(entryStatistics.misses, numThreads * numKeys) << name;
+        ASSERT_EQ(entryStatistics.evictions, 0) << name;
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include <transformations/cpu_opset/common/op/sampling.hpp>
+#include <transformations/cpu_opset/common/pass/sampling_fusion.hpp>
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+class SamplingFusionTest : public TransformationTestsF {
+public:
+    SamplingFusionTest() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    }
+
+protected:
+    static std::shared_ptr<ov::Node> multinomial(const ov::Output<ov::Node>& probs,
+                                                 bool log_probs = false,
+                                                 int64_t num_samples = 1) {
+        auto num_samples_const = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{1}, {num_samples});
+        return std::make_shared<ov::op::v13::Multinomial>(probs, num_samples_const, ov::element::i32, true, log_probs,
+                                                          12, 34);
+    }
+
+    static SamplingNode::Config config(float temperature = 1.0F, size_t top_k = 0) {
+        SamplingNode::Config config;
+        config.temperature = temperature;
+        config.top_k = top_k;
+        config.global_seed = 12;
+        config.op_seed = 34;
+        config.output_type = ov::element::i32;
+        return config;
+    }
+};
+
+TEST_F(SamplingFusionTest, SoftmaxMultinomial) {
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(logits, -1);
+        model = std::make_shared<ov::Model>(ov::OutputVector{multinomial(softmax)}, ov::ParameterVector{logits});
+        manager.register_pass<SamplingFusion>();
+    }
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto sampling = std::make_shared<SamplingNode>(logits, config());
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{sampling}, ov::ParameterVector{logits});
+    }
+}
+
+TEST_F(SamplingFusionTest, TopKTemperatureLogSoftmaxMultinomial) {
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto k = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {50});
+        auto topk = std::make_shared<ov::op::v11::TopK>(logits,
+                                                        k,
+                                                        1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::SORT_VALUES,
+                                                        ov::element::i64);
+        auto temperature = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {0.7f});
+        auto scaled = std::make_shared<ov::op::v1::Divide>(topk->output(0), temperature);
+        auto log_softmax = std::make_shared<ov::op::v5::LogSoftmax>(scaled, 1);
+        auto samples = multinomial(log_softmax, true);
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {1});
+        auto ids = std::make_shared<ov::op::v8::Gather>(topk->output(1), samples, axis, 1);
+        model = std::make_shared<ov::Model>(ov::OutputVector{ids}, ov::ParameterVector{logits});
+        manager.register_pass<SamplingFusion>();
+    }
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto sampling_config = config(0.7f, 50);
+        sampling_config.output_type = ov::element::i64;
+        auto sampling = std::make_shared<SamplingNode>(logits, sampling_config);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{sampling}, ov::ParameterVector{logits});
+    }
+}
+
+TEST_F(SamplingFusionTest, MultipleSamplesNotFused) {
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(logits, -1);
+        model = std::make_shared<ov::Model>(ov::OutputVector{multinomial(softmax, false, 4)},
+                                            ov::ParameterVector{logits});
+        manager.register_pass<SamplingFusion>();
+    }
+}
+
+TEST_F(SamplingFusionTest, LogProbsMismatchNotFused) {
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32000});
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(logits, -1);
+        model = std::make_shared<ov::Model>(ov::OutputVector{multinomial(softmax, true)}, ov::ParameterVector{logits});
+        manager.register_pass<SamplingFusion>();
+    }
+}
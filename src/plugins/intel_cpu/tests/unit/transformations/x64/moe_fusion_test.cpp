@@ -0,0 +1,119 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+#include "transformations/cpu_opset/x64/pass/moe_fusion.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+
+using namespace testing;
+using namespace ov::pass;
+using namespace ov::op;
+using namespace ov;
+
+namespace {
+
+constexpr size_t hidden_size = 64;
+constexpr size_t up_size = 128;
+constexpr size_t num_experts = 4;
+constexpr size_t top_k = 2;
+
+intel_cpu::LLMMLPNode::Config makeMLPConfig() {
+    intel_cpu::LLMMLPNode::Config config{};
+    config.act = intel_cpu::LLMMLPNode::ACT_FN::SILU;
+    config.hidden_size = static_cast<int>(hidden_size);
+    config.up_size = static_cast<int>(up_size);
+    return config;
+}
+
+// weights of the expert are filled with its id to tell the experts apart
+OutputVector makeExpertWeights(int64_t expert_id) {
+    const auto value = static_cast<float>(expert_id);
+    return {v0::Constant::create(element::f16, Shape{up_size, hidden_size}, {value}),
+            v0::Constant::create(element::f16, Shape{up_size, hidden_size}, {value}),
+            v0::Constant::create(element::f16, Shape{hidden_size, up_size}, {value})};
+}
+
+// Dense mixture of experts: every expert runs on all the tokens and is multiplied by its routing weight
+std::shared_ptr<ov::Model> makeDenseMoE(const std::vector<int64_t>& expert_ids, bool normalize) {
+    auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int64_t>(hidden_size)});
+    auto logits = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int64_t>(num_experts)});
+    auto probs = std::make_shared<v8::Softmax>(logits, -1);
+    auto k = v0::Constant::create(element::i64, Shape{}, {top_k});
+    auto topk = std::make_shared<v11::TopK>(probs, k, -1, "max", "value", element::i64);
+    auto axis = v0::Constant::create(element::i64, Shape{1}, {-1});
+    Output<Node> values = topk->output(0);
+    if (normalize) {
+        values = std::make_shared<v1::Divide>(values, std::make_shared<v1::ReduceSum>(values, axis, true));
+    }
+
+    std::shared_ptr<Node> sum;
+    for (auto expert_id : expert_ids) {
+        OutputVector args{input};
+        auto expert_weights = makeExpertWeights(expert_id);
+        args.insert(args.end(), expert_weights.begin(), expert_weights.end());
+        auto mlp = std::make_shared<intel_cpu::LLMMLPNode>(args, makeMLPConfig());
+
+        auto id = v0::Constant::create(element::i64, Shape{}, {expert_id});
+        auto mask = std::make_shared<v0::Convert>(std::make_shared<v1::Equal>(topk->output(1), id), element::f32);
+        auto routing_weight =
+            std::make_shared<v1::ReduceSum>(std::make_shared<v1::Multiply>(values, mask), axis, true);
+        auto expert_out = std::make_shared<v1::Multiply>(mlp, routing_weight);
+        sum = sum ? std::static_pointer_cast<Node>(std::make_shared<v1::Add>(sum, expert_out)) : expert_out;
+    }
+    return std::make_shared<ov::Model>(OutputVector{sum}, ParameterVector{input, logits});
+}
+
+}  // namespace
+
+TEST_F(TransformationTestsF, MoEFusionTest) {
+    disable_rt_info_check();
+    disable_result_friendly_names_check();
+
+    {
+        model = makeDenseMoE({2, 0, 3, 1}, true);
+        manager.register_pass<ov::intel_cpu::MoEFusion>();
+    }
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int64_t>(hidden_size)});
+        auto logits = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int64_t>(num_experts)});
+
+        // experts inputs are sorted by the expert id
+        OutputVector args{input, logits};
+        for (int64_t expert_id = 0; expert_id < static_cast<int64_t>(num_experts); expert_id++) {
+            auto expert_weights = makeExpertWeights(expert_id);
+            args.insert(args.end(), expert_weights.begin(), expert_weights.end());
+        }
+        intel_cpu::MoENode::Config config{};
+        config.num_experts = static_cast<int>(num_experts);
+        config.top_k = static_cast<int>(top_k);
+        config.normalize_topk = true;
+        config.mlp = makeMLPConfig();
+        auto moe = std::make_shared<intel_cpu::MoENode>(args, config);
+        model_ref = std::make_shared<ov::Model>(OutputVector{moe}, ParameterVector{input, logits});
+    }
+}
+
+TEST_F(TransformationTestsF, MoEFusionMissingExpertTest) {
+    disable_rt_info_check();
+
+    model = makeDenseMoE({0, 1, 3}, false);
+    manager.register_pass<ov::intel_cpu::MoEFusion>();
+}
@@ -3,6 +3,7 @@
 //
 #pragma once
 
+#include <future>
 #include <thread>
 
 #include "shared_test_classes/base/ov_behavior_test_utils.hpp"
@@ -574,6 +575,22 @@ TEST_P(CoreThreadingTestsWithIter, smoke_CompileModel_MultipleCores) {
         numThreads);
 }
 
+// tested function: compile_model_async
+TEST_P(CoreThreadingTestsWithIter, smoke_CompileModelAsync) {
+    ov::Core core = ov::test::utils::create_core();
+    core.set_property(target_device, config);
+
+    SetupNetworks();
+
+    std::vector<std::future<ov::CompiledModel>> compiled_models;
+    for (const auto& model : models) {
+        compiled_models.push_back(core.compile_model_async(model, target_device));
+    }
+    for (auto& compiled_model : compiled_models) {
+        OV_ASSERT_NO_THROW((void)compiled_model.get());
+    }
+}
+
 TEST_P(CoreThreadingTestsWithIter, nightly_AsyncInfer_ShareInput) {
     SetupNetworks();
     auto model = models[0];